@@ -16,6 +16,7 @@
 #ifndef CACHEARRAY_H
 #define CACHEARRAY_H
 
+#include <new>
 #include <vector>
 
 #include <sst/core/output.h>
@@ -33,8 +34,26 @@ namespace SST { namespace MemHierarchy {
 /*
  * CacheArrays should  be templated on a line type
  * See the comment in lineTypes.h for the required API
+ *
+ * Storage is laid out for lookup speed:
+ *  - Line objects are constructed in a single contiguous block, ordered by set then way
+ *  - Tags (line addresses) are mirrored in a separate flat array so that a lookup
+ *    only touches one contiguous run of 'associativity' words and never dereferences
+ *    a line that does not match
+ *  - Replacement info is kept in a vector indexed directly by set
  */
 
+/* Return the first way in tags[0..ways) whose tag equals 'tag', or 'ways' if there is no match.
+ * The loop is a compare + min-reduction with no early exit so that the compiler can vectorize it */
+inline unsigned int matchTag(const Addr* tags, unsigned int ways, Addr tag) {
+    Addr way = ways;
+    for (Addr i = 0; i < ways; i++) {
+        Addr cand = (tags[i] == tag) ? i : ways;
+        way = (cand < way) ? cand : way;
+    }
+    return way;
+}
+
 template <class T>
 class CacheArray {
     protected:
@@ -49,9 +68,13 @@ class CacheArray {
         Addr            sliceSize_; // For cache slices
         Addr            sliceStep_; // For cache slices
         unsigned int    banks_;
-        vector<T*>      lines_; // The actual cache
-        State* setStates;
-        std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+        T*              lineStore_; // Contiguous storage for the lines
+        vector<T*>      lines_;     // The actual cache, points into lineStore_
+        vector<Addr>    tags_;      // Copy of each line's address, indexed the same as lines_
+        std::vector<std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+
+        /** Compute the set an address maps to */
+        unsigned int getSet(Addr addr) { return hash_->hash(0, toLineAddr(addr)) % numSets_; }
     public:
 
         CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash);
@@ -85,6 +108,9 @@ class CacheArray {
         /** Deallocate a line and notify replacement manager that it's been deallocated */
         void deallocate(T* candidate);
 
+        /** Move any line timestamp later than 'time' back to 'time' */
+        void clampTimestamps(uint64_t time);
+
     /**** Configuration and output */
         void setSliceAware(Addr size, Addr step);
         void setBanked(unsigned int numBanks);
@@ -115,37 +141,38 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
 
     lineOffset_ = log2Of(lineSize_);
     lines_.resize(numLines_);
+    tags_.resize(numLines_, 0);
 
     // Set later using setter functions
     sliceStep_ = 1;
     sliceSize_ = 1;
     banks_ = 1;
 
+    lineStore_ = static_cast<T*>(::operator new(sizeof(T) * numLines_));
     for (unsigned int i = 0; i < numLines_; i++) {
-        lines_[i] = new T(lineSize_, i);
+        lines_[i] = new (&lineStore_[i]) T(lineSize_, i);
+        tags_[i] = lines_[i]->getAddr();
     }
 
     // Construct rInfo
+    rInfo.resize(numSets_);
     for (unsigned int i = 0; i < numSets_; i++) {
-        std::vector<ReplacementInfo*> setInfo;
-        for (unsigned int j = 0; j < associativity; j++)
-            setInfo.push_back(lines_[i*associativity + j]->getReplacementInfo());
-        rInfo.insert(std::make_pair(i, setInfo));
+        rInfo[i].reserve(associativity_);
+        for (unsigned int j = 0; j < associativity_; j++)
+            rInfo[i].push_back(lines_[i*associativity_ + j]->getReplacementInfo());
     }
-    ReplacementInfo * info = rInfo.find(0)->second.front();
+    ReplacementInfo * info = rInfo[0].front();
     if (!replacementMgr_->checkCompatibility(info))
         dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: The replacement policy expects cache line state that is not provided by the cache line type of this cache. Check the type of the ReplacementInfo returned by the coherence protocol's line type and the ReplacementInfo type expected by the replacement policy.\n");
-
-    setStates = new State[associativity_];
 }
 
 template <class T>
 CacheArray<T>::~CacheArray() {
     for (size_t i = 0; i < lines_.size(); i++)
-        delete lines_[i];
+        lines_[i]->~T();
+    ::operator delete(lineStore_);
     delete replacementMgr_;
     delete hash_;
-    delete [] setStates;
 }
 
 template <class T>
@@ -158,27 +185,21 @@ Addr CacheArray<T>::toLineAddr(Addr addr) {
 
 template <class T>
 T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
-    Addr laddr = toLineAddr(addr);
-    int set = hash_->hash(0, laddr) % numSets_;
-    int setBegin = set * associativity_;
-    int setEnd = setBegin + associativity_;
-
-    for (int i = setBegin; i < setEnd; i++) {
-        if (lines_[i]->getAddr() == addr) {
-            if (updateReplacement)
-                replacementMgr_->update(i, lines_[i]->getReplacementInfo());
-            return lines_[i];
-        }
-    }
-    return nullptr; // Not found
+    unsigned int setBegin = getSet(addr) * associativity_;
+
+    unsigned int way = matchTag(&tags_[setBegin], associativity_, addr);
+    if (way == associativity_)
+        return nullptr; // Not found
+
+    unsigned int index = setBegin + way;
+    if (updateReplacement)
+        replacementMgr_->update(index, lines_[index]->getReplacementInfo());
+    return lines_[index];
 }
 
 template <class T>
 T * CacheArray<T>::findReplacementCandidate(Addr addr) {
-    Addr laddr = toLineAddr(addr);
-    int set = hash_->hash(0, laddr) % numSets_;
-
-    unsigned int id = replacementMgr_->findBestCandidate(rInfo[set]);
+    unsigned int id = replacementMgr_->findBestCandidate(rInfo[getSet(addr)]);
 
     return lines_[id];
 }
@@ -189,6 +210,7 @@ void CacheArray<T>::replace(Addr addr, T* candidate) {
     replacementMgr_->replaced(index);
     candidate->reset();
     candidate->setAddr(addr);
+    tags_[index] = addr;
     replacementMgr_->update(index, lines_[index]->getReplacementInfo());
 }
 
@@ -207,6 +229,14 @@ void CacheArray<T>::setSliceAware(Addr size, Addr step) {
     if (sliceStep_ == 0) sliceStep_ = 1;
 }
 
+template <class T>
+void CacheArray<T>::clampTimestamps(uint64_t time) {
+    for (T* line : lines_) {
+        if (line->getTimestamp() > time)
+            line->setTimestamp(time);
+    }
+}
+
 template <class T>
 void CacheArray<T>::setBanked(unsigned int numBanks) {
     banks_ = numBanks;
@@ -37,7 +37,9 @@ using namespace SST::MemHierarchy;
 /* Handle incoming event on the cache links */
 void Cache::handleEvent(SST::Event * ev) {
     MemEventBase* event = static_cast<MemEventBase*>(ev);
-    if (!clockIsOn_)
+    if (warmup_.active() && warmup_.endsWith(event, getCurrentSimCycle()))
+        endWarmup();
+    if (!clockIsOn_ && !warmup_.active())
         turnClockOn();
 
     // Record the time at which requests arrive for latency statistics
@@ -49,6 +51,9 @@ void Cache::handleEvent(SST::Event * ev) {
         statUncacheRecv[(int)event->getCmd()]->addData(1);
     } else {
         statCacheRecv[(int)event->getCmd()]->addData(1);
+        if (profiler_ && (event->getCmd() == Command::Inv || event->getCmd() == Command::ForceInv
+                    || event->getCmd() == Command::FetchInv || event->getCmd() == Command::FetchInvX))
+            profiler_->record(RegionEvent::Inv, static_cast<MemEvent*>(event)->getBaseAddr(), 0);
     }
     if (is_debug_event((event))) {
         dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Recv    (%s)\n",
@@ -57,6 +62,9 @@ void Cache::handleEvent(SST::Event * ev) {
     }
     
     eventBuffer_.push_back(event);
+
+    if (warmup_.active())
+        processWarmup();
 }
 
 /* 
@@ -73,10 +81,10 @@ void Cache::handlePrefetchEvent(SST::Event * ev) {
 void Cache::processPrefetchEvent(SST::Event * ev) {
     MemEvent * event = static_cast<MemEvent*>(ev);
     event->setBaseAddr(toBaseAddr(event->getAddr()));
-    event->setRqstr(getName());
-    event->setSrc(getName());
+    event->setRqstrID(nameID_);
+    event->setSrcID(nameID_);
 
-    if (!clockIsOn_) {
+    if (!clockIsOn_ && !warmup_.active()) {
         turnClockOn();
     }
 
@@ -87,6 +95,9 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
     statPrefetchRequest->addData(1);
     statCacheRecv[(int)event->getCmd()]->addData(1);
     prefetchBuffer_.push(event);
+
+    if (warmup_.active())
+        processWarmup();
 }
 
 /**************************************************************************
@@ -100,15 +111,19 @@ bool Cache::clockTick(Cycle_t time) {
     // Drain any outgoing messages
     bool idle = coherenceMgr_->sendOutgoingEvents();
 
+    bool linksIdle = true;
     if (clockUpLink_) {
-        idle &= linkUp_->clock();
+        linksIdle &= linkUp_->clock();
     }
     if (clockDownLink_) {
-        idle &= linkDown_->clock();
+        linksIdle &= linkDown_->clock();
     }
+    idle &= linksIdle;
 
     // MSHR occupancy
     statMSHROccupancy->addData(mshr_->getSize());
+    if (clockGating_)
+        statClockOnCycles->addData(1);
 
     // Clear bank status to prepare for event handling
     for (unsigned int bank = 0; bank < bankStatus_.size(); bank++)
@@ -164,6 +179,7 @@ bool Cache::clockTick(Cycle_t time) {
             it++;
         }
     }
+    bool progress = accepted != 0 || !prefetchBuffer_.empty();
     while (!prefetchBuffer_.empty()) {
         if (is_debug_event(prefetchBuffer_.front())) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Pref    (%s)\n",
@@ -182,6 +198,7 @@ bool Cache::clockTick(Cycle_t time) {
 
     // Push any events that need to be retried next cycle onto the retry buffer
     std::vector<MemEventBase*>* rBuf = coherenceMgr_->getRetryBuffer();
+    progress |= !rBuf->empty();
     std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
     coherenceMgr_->clearRetryBuffer();
 
@@ -193,19 +210,123 @@ bool Cache::clockTick(Cycle_t time) {
         return true;
     }
 
+    // With clock gating, also turn off if every buffered event was rejected this cycle.
+    // Nothing can change until a new event arrives (which turns the clock back on) or
+    // an outgoing event becomes ready to send, so wake up just in time for that.
+    if (clockGating_ && !progress && linksIdle) {
+        uint64_t nextSend = coherenceMgr_->getNextSendTime();
+        if (nextSend == 0 || nextSend > timestamp_ + 1) {
+            if (nextSend != 0) // Clock restarts the cycle after the wakeup
+                clockWakeupSelfLink_->send(nextSend - timestamp_ - 1, nullptr);
+            turnClockOff();
+            return true;
+        }
+    }
+
     // Keep the clock on
     return false;
 }
 
+/*
+ * Functional warm-up: handle buffered events until none can make progress,
+ * then send everything that resulted without waiting for the clock.
+ * Events still buffered are waiting on a response and are handled when it arrives.
+ */
+void Cache::processWarmup() {
+    // The clock is off, so keep the timestamp at the current cycle for the latencies the protocol computes
+    SimTime_t now = getCurrentSimTime(defaultTimeBase_);
+    if (now > timestamp_) {
+        timestamp_ = now;
+        coherenceMgr_->updateTimestamp(timestamp_);
+    }
+
+    bool progress = true;
+    while (progress) {
+        for (unsigned int bank = 0; bank < bankStatus_.size(); bank++)
+            bankStatus_[bank] = false;
+        addrsThisCycle_.clear();
+
+        int accepted = 0;
+        std::list<MemEventBase*>::iterator it = retryBuffer_.begin();
+        while (it != retryBuffer_.end()) {
+            if (processEvent(*it, true)) {
+                accepted++;
+                statRetryEvents->addData(1);
+                it = retryBuffer_.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        it = eventBuffer_.begin();
+        while (it != eventBuffer_.end()) {
+            if (processEvent(*it, false)) {
+                accepted++;
+                statRecvEvents->addData(1);
+                it = eventBuffer_.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        while (!prefetchBuffer_.empty()) {
+            if (processEvent(prefetchBuffer_.front(), false)) {
+                accepted++;
+            } else {
+                statPrefetchDrop->addData(1);
+                coherenceMgr_->removeRequestRecord(prefetchBuffer_.front()->getID());
+            }
+            prefetchBuffer_.pop();
+        }
+
+        // Retries are only generated by events that were accepted, so they are handled on the next pass
+        std::vector<MemEventBase*>* rBuf = coherenceMgr_->getRetryBuffer();
+        std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
+        coherenceMgr_->clearRetryBuffer();
+
+        progress = accepted != 0;
+    }
+
+    coherenceMgr_->sendOutgoingEvents();
+
+    // Links that buffer (e.g., to a network) drain on the clock
+    bool linksIdle = true;
+    if (clockUpLink_)
+        linksIdle &= linkUp_->clock();
+    if (clockDownLink_)
+        linksIdle &= linkDown_->clock();
+    if (!linksIdle && !clockIsOn_)
+        turnClockOn();
+}
+
+/* Leave functional warm-up. Anything still buffered is handled on the clock from here on. */
+void Cache::endWarmup() {
+    warmup_.end();
+    coherenceMgr_->setFunctional(false);
+    // Hits during warm-up still push line timestamps out by the access latency; don't make the first timed accesses wait on them
+    SimTime_t now = getCurrentSimTime(defaultTimeBase_);
+    if (now > timestamp_) {
+        timestamp_ = now;
+        coherenceMgr_->updateTimestamp(timestamp_);
+    }
+    coherenceMgr_->clampTimestamps(timestamp_);
+    out_->verbose(CALL_INFO, 2, 0, "%s, Ending functional warm-up at %" PRIu64 "ns\n", getName().c_str(), getCurrentSimTimeNano());
+    if (!clockIsOn_ && (!eventBuffer_.empty() || !retryBuffer_.empty()))
+        turnClockOn();
+}
+
+/* Handler for clockWakeupSelfLink_ */
+void Cache::clockWakeup(SST::Event * UNUSED(ev)) {
+    if (!clockIsOn_)
+        turnClockOn();
+}
+
 void Cache::turnClockOn() {
     if (clockIsOn_) return;
     Cycle_t time = reregisterClock(defaultTimeBase_, clockHandler_);
     timestamp_ = time - 1;
     coherenceMgr_->updateTimestamp(timestamp_);
-    int64_t cyclesOff = timestamp_ - lastActiveClockCycle_;
-    for (int64_t i = 0; i < cyclesOff; i++) {           // TODO more efficient way to do this? Don't want to add in one-shot or we get weird averages/sum sq.
-        statMSHROccupancy->addData(mshr_->getSize());
-    }
+    recordClockOffCycles(timestamp_);
     //dbg_->debug(_L3_, "%s turning clock ON at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), getCurrentSimCycle(), timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = true;
 }
@@ -216,6 +337,16 @@ void Cache::turnClockOff() {
     lastActiveClockCycle_ = timestamp_;
 }
 
+void Cache::recordClockOffCycles(SimTime_t cycle) {
+    int64_t cyclesOff = cycle - lastActiveClockCycle_;
+    if (cyclesOff > 0) {
+        statMSHROccupancy->addDataNTimes(cyclesOff, mshr_->getSize()); // One sample per skipped cycle so averages/sum sq. are unaffected
+        if (clockGating_)
+            statClockOffCycles->addData(cyclesOff);
+    }
+    lastActiveClockCycle_ = cycle;
+}
+
 /**************************************************************************
  * Event processing
  **************************************************************************/
@@ -230,6 +361,8 @@ void Cache::turnClockOff() {
  *   Returns: whether event was accepted/can be popped off event queue
  */
 bool Cache::processEvent(MemEventBase* ev, bool inMSHR) {
+    MEMH_TRACE_MARK(ev, Wait, getCurrentSimCycle());
+
     // Global noncacheable request flag
     if (allNoncacheableRequests_) {
         ev->setFlag(MemEvent::F_NONCACHEABLE);
@@ -455,7 +588,7 @@ void Cache::init(unsigned int phase) {
                 processInitCoherenceEvent(eventC, linkDown_->isSource(eventC->getSrc()));
             } else if (event->getInitCmd() == MemEventInit::InitCommand::Endpoint) {
                 MemEventInit * mEv = event->clone();
-                mEv->setSrc(getName());
+                mEv->setSrcID(nameID_);
                 linkDown_->sendUntimedData(mEv);
             }
             delete event;
@@ -482,14 +615,14 @@ void Cache::init(unsigned int phase) {
                 processInitCoherenceEvent(eventC, true);
             } else if (memEvent->getInitCmd() == MemEventInit::InitCommand::Endpoint ) {
                 MemEventInit * mEv = memEvent->clone();
-                mEv->setSrc(getName());
+                mEv->setSrcID(nameID_);
                 linkDown_->sendUntimedData(mEv);
             }
         } else {
             dbg_->debug(_L10_, "I: %-20s   Event:Init      (%s)\n",
                     getName().c_str(), memEvent->getVerboseString().c_str());
             MemEventInit * mEv = memEvent->clone();
-            mEv->setSrc(getName());
+            mEv->setSrcID(nameID_);
             linkDown_->sendUntimedData(mEv, false);
         }
         delete memEvent;
@@ -505,7 +638,7 @@ void Cache::init(unsigned int phase) {
                 processInitCoherenceEvent(eventC, false);
             } else if (memEvent->getInitCmd() == MemEventInitEndpoint::InitCommand::Endpoint) {
                 MemEventInit * mEv = memEvent->clone();
-                mEv->setSrc(getName());
+                mEv->setSrcID(nameID_);
                 linkUp_->sendUntimedData(mEv);
             }
         }
@@ -531,11 +664,13 @@ void Cache::setup() {
 
 
 void Cache::finish() {
-    if (!clockIsOn_) { // Correct statistics
-        turnClockOn();
+    if (!clockIsOn_) { // Correct statistics for the off period still open at the end of simulation
+        recordClockOffCycles(getCurrentSimTime(defaultTimeBase_));
     }
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->printStats(*out_);
+    if (profiler_)
+        profiler_->finish();
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
 }
@@ -34,6 +34,8 @@
 #include "sst/elements/memHierarchy/coherencemgr/coherenceController.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
+#include "sst/elements/memHierarchy/regionProfiler.h"
+#include "sst/elements/memHierarchy/warmup.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 
 namespace SST { namespace MemHierarchy {
@@ -80,6 +82,7 @@ public:
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
             {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
             {"maxRequestDelay",         "(uint) Set an error timeout if memory requests take longer than this in ns (0: disable)", "0"},
+            {"clock_gating",            "(bool) Turn the clock off whenever a cycle makes no progress, even if events are buffered, instead of only when the cache is empty. The clock restarts when an event arrives or when the next outgoing event is ready to send. Options: 0[off], 1[on]", "false"},
             {"snoop_l1_invalidations",  "(bool) Forward invalidations from L1s to processors. Options: 0[off], 1[on]", "false"},
             {"llsc_block_cycles",       "(uint64_t) Number of cycles to prevent competing access to an LL/LR line. Encourages forward progress", "0"},
             {"debug",                   "(uint) Where to send output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
@@ -90,6 +93,8 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"warmup_time",             "(string) Run functionally (no clock, latency, or bandwidth limits) until this simulated time, then switch to timing. Specify in s (SI prefixes ok). '0ns' for no time limit. Statistics include warm-up traffic unless enabled with a 'startat' time.", "0ns"},
+            {"warmup_signal_addr",      "(uint) If set, run functionally until a request to this address arrives. Use a noncacheable access so that all levels see it.", ""},
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -120,6 +125,8 @@ public:
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
             {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address.", "events", 1},
+            {"Clock_on_cycles",         "Cycles in which the clock handler ran. Only recorded if clock_gating is on.", "cycles", 1},
+            {"Clock_off_cycles",        "Cycles skipped while the clock was off. Only recorded if clock_gating is on.", "cycles", 1},
             /*Event receives */
             {"GetS_recv",               "Event received: GetS", "count", 2},
             {"GetX_recv",               "Event received: GetX", "count", 2},
@@ -166,7 +173,8 @@ public:
             {"prefetcher", "Prefetcher(s)", "SST::MemHierarchy::CacheListener"},
             {"listener", "Cache listener(s) for statistics, tracing, etc. In contrast to prefetcher, cannot send events to cache", "SST::MemHierarchy::CacheListener"},
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"profiler", "Optional profiler that records accesses, misses, evictions, and invalidations by address region", "SST::MemHierarchy::RegionProfiler"} )
 
 /* Class definition */
     friend class InstructionStream; // TODO what is this?
@@ -239,6 +247,10 @@ private:
     // Clock helpers - turn clock on & off
     void turnClockOn();
     void turnClockOff();
+    void recordClockOffCycles(SimTime_t cycle); // Statistics for the cycles between turning the clock off and 'cycle'
+
+    // Handler for clockWakeupSelfLink_
+    void clockWakeup(SST::Event * ev);
 
     // Trigger timeouts if events sit in MSHR for too long
     void timeoutWakeup(SST::Event * ev);
@@ -251,13 +263,19 @@ private:
     // Process coherence initialization events
     void processInitCoherenceEvent(MemEventInitCoherence* event, bool src);
 
+    // Functional warm-up - handle buffered events immediately and switch to timing when warm-up ends
+    void processWarmup();
+    void endWarmup();
+
 
     /** Cache structures *******************************************************/
     std::vector<CacheListener*> listeners_; // Cache listeners, including prefetchers
+    RegionProfiler* profiler_;              // Address region profiler, null if not enabled
     MemLinkBase* linkUp_;                   // link manager up (towards CPU)
     MemLinkBase* linkDown_;                 // link manager down (towards memory)
     Link* prefetchSelfLink_;                // link to delay prefetch request receive
     Link* timeoutSelfLink_;                 // link to check for timeouts (possible deadlock)
+    Link* clockWakeupSelfLink_;             // link to restart the clock when clock gating is on
     MSHR* mshr_;                            // MSHR
     CoherenceController* coherenceMgr_;     // Coherence protocol - where most of the event handling happens
 
@@ -266,6 +284,7 @@ private:
 
     /** Cache configuration ****************************************************/
     uint64_t            lineSize_;
+    EndpointID          nameID_;        // Interned getName()
     bool                allNoncacheableRequests_;
     int                 maxRequestsPerCycle_;
     MemRegion           region_; // Memory region handled by this cache
@@ -280,6 +299,8 @@ private:
     bool                    clockUpLink_;   // Whether link actually needs clock() called or not
     bool                    clockDownLink_; // Whether link actually needs clock() called or not
     SimTime_t               lastActiveClockCycle_;  // Cycle we turned the clock off at - for re-syncing stats
+    bool                    clockGating_;   // Whether to turn the clock off while events are buffered but none can make progress
+    Warmup                  warmup_;        // Functional warm-up state
 
     /** Cache state ************************************************************/
     uint64_t                    timestamp_;
@@ -300,6 +321,8 @@ private:
     /** Statistics *************************************************************/
     Statistic<uint64_t>* statMSHROccupancy;
     Statistic<uint64_t>* statBankConflicts;
+    Statistic<uint64_t>* statClockOnCycles;
+    Statistic<uint64_t>* statClockOffCycles;
 
     // Prefetch statistics
     Statistic<uint64_t>* statPrefetchRequest;
@@ -50,6 +50,7 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     /* Pull out parameters that the cache keeps - the rest will be pulled as needed */
     lineSize_ = params.find<uint64_t>("cache_line_size", 64);
+    nameID_ = EndpointRegistry::intern(getName());
 
     /* Construct cache structures */
     createCacheArray(params);
@@ -82,6 +83,15 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     createCoherenceManager(params);
 
+    /* Functional warm-up */
+    UnitAlgebra warmupTime(params.find<std::string>("warmup_time", "0ns"));
+    if (!warmupTime.hasUnits("s")) {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: warmup_time - must have units of s (SI prefixes ok). You specified '%s'\n", getName().c_str(), warmupTime.toString().c_str());
+    }
+    Addr warmupSignal = params.find<Addr>("warmup_signal_addr", 0, found);
+    warmup_.configure(warmupTime.isValueZero() ? 0 : getTimeConverter(warmupTime)->getFactor(), found, warmupSignal);
+    coherenceMgr_->setFunctional(warmup_.active());
+
     /* Register statistics */
     registerStatistics();
 
@@ -204,6 +214,7 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceMgr_->setLinks(linkUp_, linkDown_);
     coherenceMgr_->setMSHR(mshr_);
     coherenceMgr_->setCacheListener(listeners_, dropPrefetchLevel, maxOutstandingPrefetch);
+    coherenceMgr_->setRegionProfiler(profiler_);
     coherenceMgr_->setDebug(DEBUG_ADDR);
     coherenceMgr_->setSliceAware(region_.interleaveSize, region_.interleaveStep);
     coherenceMgr_->registerClockEnableFunction(std::bind(&Cache::turnClockOn, this));
@@ -629,6 +640,9 @@ void Cache::createListeners(Params &params) {
         Params emptyParams;
         listeners_.push_back(loadAnonymousSubComponent<CacheListener>("memHierarchy.emptyCacheListener", "listener", 0, ComponentInfo::SHARE_NONE, emptyParams));
     }
+
+    /* Configure address region profiler */
+    profiler_ = loadUserSubComponent<RegionProfiler>("profiler");
 }
 
 uint64_t Cache::createMSHR(Params &params, uint64_t accessLatency, bool L1) {
@@ -728,6 +742,11 @@ void Cache::createClock(Params &params) {
     timestamp_ = 0;
     lastActiveClockCycle_ = 0;
 
+    clockGating_ = params.find<bool>("clock_gating", false);
+    clockWakeupSelfLink_ = nullptr;
+    if (clockGating_)
+        clockWakeupSelfLink_ = configureSelfLink("clockWakeup", defaultTimeBase_, new Event::Handler<Cache>(this, &Cache::clockWakeup));
+
     // Deadlock timeout
     timeout_ = params.find<SimTime_t>("maxRequestDelay", 0);
     if (timeout_ > 0) {
@@ -794,4 +813,9 @@ void Cache::registerStatistics() {
 
     statMSHROccupancy               = registerStatistic<uint64_t>("MSHR_occupancy");
     statBankConflicts               = registerStatistic<uint64_t>("Bank_conflicts");
+    statClockOnCycles = statClockOffCycles = nullptr;
+    if (clockGating_) {
+        statClockOnCycles           = registerStatistic<uint64_t>("Clock_on_cycles");
+        statClockOffCycles          = registerStatistic<uint64_t>("Clock_off_cycles");
+    }
 }
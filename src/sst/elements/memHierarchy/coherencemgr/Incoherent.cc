@@ -35,7 +35,7 @@ using namespace SST::MemHierarchy;
 bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
     PrivateCacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ? line->getState() : I;
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -662,9 +662,9 @@ void Incoherent::retry(Addr addr) {
             if (!mshr_->getInProgress(addr))
                 retryBuffer_.push_back(mshr_->getFrontEvent(addr));
         } else { // Pointer -> another request is waiting to evict this address
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
         }
@@ -714,7 +714,7 @@ SimTime_t Incoherent::sendResponseUp(MemEvent * event, vector<uint8_t> * data, b
 
 
 void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty) {
-    MemEvent * writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd);
+    MemEvent * writeback = new MemEvent(cachenameID_, line->getAddr(), line->getAddr(), cmd);
     writeback->setSize(lineSize_);
 
     uint64_t latency = tagLatency_;
@@ -726,7 +726,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     time += latency;
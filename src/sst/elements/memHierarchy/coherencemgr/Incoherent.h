@@ -266,6 +266,7 @@ public:
 
     Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) { cacheArray_->setSliceAware(interleaveSize, interleaveStep); }
+    void clampTimestamps(uint64_t time) { cacheArray_->clampTimestamps(time); }
 
     MemEventInitCoherence * getInitCoherenceEvent();
 
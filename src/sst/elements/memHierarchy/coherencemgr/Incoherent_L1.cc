@@ -38,7 +38,7 @@ using namespace SST::MemHierarchy;
 bool IncoherentL1::handleGetS(MemEvent* event, bool inMSHR){
     Addr addr = event->getBaseAddr();
     L1CacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ? line->getState() : I;
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -411,7 +411,7 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool inMSHR) {
     stat_eventState[(int)(event->getCmd())][state]->addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
 
    if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::GetSResp, (localPrefetch ? "-pref" : ""), addr, state);
@@ -742,9 +742,9 @@ void IncoherentL1::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -770,9 +770,9 @@ void IncoherentL1::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
                 retryBuffer_.push_back(mshr_->getFrontEvent(addr));
             }
         } else {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                 retryBuffer_.push_back(ev);
             }
         }
@@ -784,9 +784,9 @@ void IncoherentL1::retry(Addr addr) {
         if (mshr_->getFrontType(addr) == MSHREntryType::Event) {
             retryBuffer_.push_back(mshr_->getFrontEvent(addr));
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                 retryBuffer_.push_back(ev);
             }
         }
@@ -884,7 +884,7 @@ void IncoherentL1::forwardFlush(MemEvent * event, L1CacheLine * line, bool evict
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd, getCurrentSimTimeNano());
+    MemEvent* writeback = new MemEvent(cachenameID_, line->getAddr(), line->getAddr(), cmd, getCurrentSimTimeNano());
     writeback->setSize(lineSize_);
 
     uint64_t latency = tagLatency_;
@@ -901,7 +901,7 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -48,7 +48,7 @@ using namespace SST::MemHierarchy;
 bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
     SharedCacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ? line->getState() : I;
 
     MemEventStatus status = MemEventStatus::OK;
@@ -110,7 +110,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             }
 
             recordPrefetchResult(line, statPrefetchHit);
-            line->addSharer(event->getSrc());
+            line->addSharer(event->getSrcID());
 
             sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime - 1);
@@ -171,10 +171,10 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                     if (inMSHR) mshr_->setProfiled(addr);
                 }
                 if (!line->hasSharers() && protocol_) {
-                    line->setOwner(event->getSrc());
+                    line->setOwner(event->getSrcID());
                     respcmd = Command::GetXResp;
                 } else {
-                    line->addSharer(event->getSrc());
+                    line->addSharer(event->getSrcID());
                     respcmd = Command::GetSResp;
                 }
             }
@@ -283,7 +283,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
 
             recordPrefetchResult(line, statPrefetchHit);
 
-            if (line->hasOtherSharers(event->getSrc())) {
+            if (line->hasOtherSharers(event->getSrcID())) {
                 if (!inMSHR)
                     status = allocateMSHR(event, false);
                 if (status == MemEventStatus::OK) {
@@ -317,9 +317,9 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 line->setState(E); // Clean/exclusive
             }
 
-            line->setOwner(event->getSrc());
-            if (line->isSharer(event->getSrc()))
-                line->removeSharer(event->getSrc());
+            line->setOwner(event->getSrcID());
+            if (line->isSharer(event->getSrcID()))
+                line->removeSharer(event->getSrcID());
             sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime);
 
@@ -381,7 +381,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
 
     if (event->getEvict()) {
         state = doEviction(event, line, state);
-        line->addSharer(event->getSrc());
+        line->addSharer(event->getSrcID());
         ack = true;
     }
 
@@ -406,7 +406,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
             if (mshr_->getFrontType(addr) == MSHREntryType::Event) {
                 MemEvent * headEvent = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
                 if (headEvent->getCmd() == Command::FetchInvX && !line->hasOwner()) { // Resolve race between downgrade request & this flush
-                    responses.find(addr)->second.erase(event->getSrc());
+                    responses.find(addr)->second.erase(event->getSrcID());
                     if (responses.find(addr)->second.empty()) responses.erase(addr);
                     retry(addr);
                 }
@@ -417,7 +417,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
         case E_InvX:
         case M_InvX:
             if (ack) {
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 mshr_->decrementAcksNeeded(addr);
                 state == E_InvX ? line->setState(E) : line->setState(M);
@@ -478,8 +478,8 @@ bool MESIInclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
     bool done = (mshr_->getAcksNeeded(addr) == 0);
     if (event->getEvict()) {
         state = doEviction(event, line, state);
-        if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-            responses.find(addr)->second.erase(event->getSrc());
+        if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcID()) != responses.find(addr)->second.end()) {
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
         }
         if (!done) {
@@ -600,8 +600,8 @@ bool MESIInclusive::handlePutS(MemEvent * event, bool inMSHR) {
     state = doEviction(event, line, state);
     stat_eventState[(int)Command::PutS][state]->addData(1);
 
-    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-        responses.find(addr)->second.erase(event->getSrc());
+    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcID()) != responses.find(addr)->second.end()) {
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty()) responses.erase(addr);
     }
 
@@ -683,8 +683,8 @@ bool MESIInclusive::handlePutE(MemEvent * event, bool inMSHR) {
     stat_eventState[(int)Command::PutE][state]->addData(1);
 
     state = doEviction(event, line, state);
-    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-        responses.find(addr)->second.erase(event->getSrc());
+    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcID()) != responses.find(addr)->second.end()) {
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty()) responses.erase(addr);
     }
 
@@ -747,8 +747,8 @@ bool MESIInclusive::handlePutM(MemEvent * event, bool inMSHR) {
     stat_eventState[(int)Command::PutM][state]->addData(1);
 
     state = doEviction(event, line, state);
-    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-        responses.find(addr)->second.erase(event->getSrc());
+    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcID()) != responses.find(addr)->second.end()) {
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty()) responses.erase(addr);
     }
 
@@ -807,7 +807,7 @@ bool MESIInclusive::handlePutX(MemEvent * event, bool inMSHR) {
     stat_eventState[(int)Command::PutX][state]->addData(1);
 
     state = doEviction(event, line, state);
-    line->addSharer(event->getSrc());
+    line->addSharer(event->getSrcID());
 
     if (sendWritebackAck_)
        sendAckPut(event);
@@ -819,13 +819,13 @@ bool MESIInclusive::handlePutX(MemEvent * event, bool inMSHR) {
         case E_Inv:
         case M_Inv:
             if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 retry(addr);
             }
             break;
         case E_InvX:
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             if (mshr_->getAcksNeeded(addr) && mshr_->decrementAcksNeeded(addr)) {
                 line->setState(E);
@@ -833,7 +833,7 @@ bool MESIInclusive::handlePutX(MemEvent * event, bool inMSHR) {
             }
             break;
         case M_InvX:
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             if (mshr_->getAcksNeeded(addr) && mshr_->decrementAcksNeeded(addr)) {
                 line->setState(M);
@@ -1050,7 +1050,7 @@ bool MESIInclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
             break;
         case SM_Inv: { // ForceInv if there's an un-inv'd sharer, else in mshr & stall
-            std::string src = mshr_->getFrontEvent(addr)->getSrc();
+            EndpointID src = mshr_->getFrontEvent(addr)->getSrcID();
             status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, true, 0);
             if (status != MemEventStatus::Reject) {
                 profile = true;
@@ -1176,7 +1176,7 @@ bool MESIInclusive::handleFetchInv(MemEvent * event, bool inMSHR) {
             status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, true, 0);
             if (status != MemEventStatus::Reject) {
                 profile = true;
-                std::string shr = mshr_->getFrontEvent(addr)->getSrc();
+                EndpointID shr = mshr_->getFrontEvent(addr)->getSrcID();
                 if (line->isSharer(shr)) {
                     invalidateSharer(shr, event, line, inMSHR);
                 }
@@ -1315,7 +1315,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
     //if (is_debug_addr(addr))
         //debug->debug(_L5_, "    Request: %s\n", req->getBriefString().c_str());
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     // Sanity check line state
@@ -1334,7 +1334,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (localPrefetch) {
         line->setPrefetch(true);
     } else {
-        line->addSharer(req->getSrc());
+        line->addSharer(req->getSrcID());
         Addr offset = req->getAddr() - req->getBaseAddr();
         uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp());
         line->setTimestamp(sendTime-1);
@@ -1364,7 +1364,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
 
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     std::vector<uint8_t> data;
@@ -1390,11 +1390,11 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
                     eventDI.action = "Done";
             } else {
                 if (protocol_ && line->getState() != S && mshr_->getSize(addr) == 1) {
-                    line->setOwner(req->getSrc());
+                    line->setOwner(req->getSrcID());
                     uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp(), Command::GetXResp);
                     line->setTimestamp(sendTime - 1);
                 } else {
-                    line->addSharer(req->getSrc());
+                    line->addSharer(req->getSrcID());
                     uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp(), Command::GetSResp);
                     line->setTimestamp(sendTime - 1);
                 }
@@ -1409,9 +1409,9 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
         case SM:
         {
             line->setState(M);
-            line->setOwner(req->getSrc());
-            if (line->isSharer(req->getSrc()))
-                line->removeSharer(req->getSrc());
+            line->setOwner(req->getSrcID());
+            if (line->isSharer(req->getSrcID()))
+                line->removeSharer(req->getSrcID());
 
             uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp());
             line->setTimestamp(sendTime-1);
@@ -1489,7 +1489,7 @@ bool MESIInclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
 
     // Do invalidation & update data
     state = doEviction(event, line, state);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     if (state == M_Inv) {
@@ -1529,9 +1529,9 @@ bool MESIInclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     mshr_->decrementAcksNeeded(addr);
 
     state = doEviction(event, line, state);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
-    line->addSharer(event->getSrc());
+    line->addSharer(event->getSrcID());
 
     if (state == M_InvX)
         line->setState(M);
@@ -1563,12 +1563,12 @@ bool MESIInclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
     stat_eventState[(int)Command::AckInv][state]->addData(1);
 
-    if (line->isSharer(event->getSrc()))
-        line->removeSharer(event->getSrc());
+    if (line->isSharer(event->getSrcID()))
+        line->removeSharer(event->getSrcID());
     else
         line->removeOwner();
 
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     bool done = mshr_->decrementAcksNeeded(addr);
@@ -1719,8 +1719,8 @@ bool MESIInclusive::handleNACK(MemEvent * event, bool inMSHR) {
         case Command::Inv:
         case Command::ForceInv:
             if (responses.find(addr) != responses.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst()) != responses.find(addr)->second.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst())->second == nackedEvent->getID()) {
+                    && responses.find(addr)->second.find(nackedEvent->getDstID()) != responses.find(addr)->second.end()
+                    && responses.find(addr)->second.find(nackedEvent->getDstID())->second == nackedEvent->getID()) {
                 resendEvent(nackedEvent, true); // Resend towards CPU
             } else {
                 if (is_debug_event(nackedEvent))
@@ -1892,9 +1892,9 @@ void MESIInclusive::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -1924,9 +1924,9 @@ void MESIInclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
             }
         } else {
             if (mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -1945,9 +1945,9 @@ void MESIInclusive::retry(Addr addr) {
         } else if (!(mshr_->pendingWriteback(addr))) {
             //if (is_debug_addr(addr))
             //    debug->debug(_L5_, "    Retry: Waiting Evict in MSHR, retrying eviction\n");
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
         }
@@ -1979,10 +1979,10 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
                 break;
         }
     }
-    if (line->getOwner() == event->getSrc())
+    if (line->getOwner() == event->getSrcID())
         line->removeOwner();
-    else if (line->isSharer(event->getSrc()))
-        line->removeSharer(event->getSrc());
+    else if (line->isSharer(event->getSrcID()))
+        line->removeSharer(event->getSrcID());
 
     event->setEvict(false); // Avoid doing an eviction twice if the event gets replayed
     line->setState(nState);
@@ -2080,7 +2080,7 @@ void MESIInclusive::forwardFlush(MemEvent * event, SharedCacheLine * line, bool
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cachenameID_, line->getAddr(), line->getAddr(), cmd);
     writeback->setSize(lineSize_);
 
     uint64_t latency = tagLatency_;
@@ -2097,7 +2097,7 @@ void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -2126,9 +2126,9 @@ void MESIInclusive::sendAckPut(MemEvent * event) {
 
 void MESIInclusive::downgradeOwner(MemEvent * event, SharedCacheLine* line, bool inMSHR) {
     Addr addr = event->getBaseAddr();
-    MemEvent * fetch = new MemEvent(cachename_, addr, addr, Command::FetchInvX);
+    MemEvent * fetch = new MemEvent(cachenameID_, addr, addr, Command::FetchInvX);
     fetch->copyMetadata(event);
-    fetch->setDst(line->getOwner());
+    fetch->setDstID(line->getOwner());
     fetch->setSize(lineSize_);
 
     mshr_->incrementAcksNeeded(addr);
@@ -2136,7 +2136,7 @@ void MESIInclusive::downgradeOwner(MemEvent * event, SharedCacheLine* line, bool
     if (responses.find(addr) != responses.end()) {
         responses.find(addr)->second.insert(std::make_pair(line->getOwner(), fetch->getID())); // Record events we're waiting for to avoid trying to figure out what happened if we get a NACK
     } else {
-        std::map<std::string,MemEvent::id_type> respid;
+        std::map<EndpointID,MemEvent::id_type> respid;
         respid.insert(std::make_pair(line->getOwner(), fetch->getID()));
         responses.insert(std::make_pair(addr, respid));
     }
@@ -2159,12 +2159,12 @@ void MESIInclusive::downgradeOwner(MemEvent * event, SharedCacheLine* line, bool
 
 bool MESIInclusive::invalidateExceptRequestor(MemEvent * event, SharedCacheLine * line, bool inMSHR) {
     uint64_t deliveryTime = 0;
-    std::string rqstr = event->getSrc();
+    EndpointID rqstr = event->getSrcID();
 
-    for (set<std::string>::iterator it = line->getSharers()->begin(); it != line->getSharers()->end(); it++) {
-        if (*it == rqstr) continue;
+    for (EndpointID sharer : line->getSharers()->sortedByName()) {
+        if (sharer == rqstr) continue;
 
-        deliveryTime =  invalidateSharer(*it, event, line, inMSHR);
+        deliveryTime =  invalidateSharer(sharer, event, line, inMSHR);
     }
 
     if (deliveryTime != 0) line->setTimestamp(deliveryTime);
@@ -2180,8 +2180,8 @@ bool MESIInclusive::invalidateAll(MemEvent * event, SharedCacheLine * line, bool
     } else {
         if (cmd == Command::NULLCMD)
             cmd = Command::Inv;
-        for (std::set<std::string>::iterator it = line->getSharers()->begin(); it != line->getSharers()->end(); it++) {
-            deliveryTime = invalidateSharer(*it, event, line, inMSHR, cmd);
+        for (EndpointID sharer : line->getSharers()->sortedByName()) {
+            deliveryTime = invalidateSharer(sharer, event, line, inMSHR, cmd);
         }
         if (deliveryTime != 0) {
             line->setTimestamp(deliveryTime);
@@ -2191,21 +2191,21 @@ bool MESIInclusive::invalidateAll(MemEvent * event, SharedCacheLine * line, bool
     return false;
 }
 
-uint64_t MESIInclusive::invalidateSharer(std::string shr, MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd) {
+uint64_t MESIInclusive::invalidateSharer(EndpointID shr, MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd) {
     if (line->isSharer(shr)) {
         Addr addr = line->getAddr();
-        MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+        MemEvent * inv = new MemEvent(cachenameID_, addr, addr, cmd);
         if (event) {
             inv->copyMetadata(event);
         } else {
-            inv->setRqstr(cachename_);
+            inv->setRqstrID(cachenameID_);
         }
-        inv->setDst(shr);
+        inv->setDstID(shr);
         inv->setSize(lineSize_);
         if (responses.find(addr) != responses.end()) {
             responses.find(addr)->second.insert(std::make_pair(shr, inv->getID())); // Record events we're waiting for to avoid trying to figure out what happened if we get a NACK
         } else {
-            std::map<std::string,MemEvent::id_type> respid;
+            std::map<EndpointID,MemEvent::id_type> respid;
             respid.insert(std::make_pair(shr, inv->getID()));
             responses.insert(std::make_pair(addr, respid));
         }
@@ -2228,26 +2228,26 @@ uint64_t MESIInclusive::invalidateSharer(std::string shr, MemEvent * event, Shar
 
 bool MESIInclusive::invalidateOwner(MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd) {
     Addr addr = line->getAddr();
-    if (line->getOwner() == "")
+    if (!line->hasOwner())
         return false;
 
-    MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * inv = new MemEvent(cachenameID_, addr, addr, cmd);
     if (event) {
         inv->copyMetadata(event);
     } else {
-        inv->setRqstr(cachename_);
+        inv->setRqstrID(cachenameID_);
     }
-    inv->setDst(line->getOwner());
+    inv->setDstID(line->getOwner());
     inv->setSize(lineSize_);
 
     mshr_->incrementAcksNeeded(addr);
 
     // Record events we're waiting for to avoid trying to figure out what happened if we get a NACK
     if (responses.find(addr) != responses.end()) {
-        responses.find(addr)->second.insert(std::make_pair(inv->getDst(), inv->getID()));
+        responses.find(addr)->second.insert(std::make_pair(inv->getDstID(), inv->getID()));
     } else {
-        std::map<std::string,MemEvent::id_type> respid;
-        respid.insert(std::make_pair(inv->getDst(), inv->getID()));
+        std::map<EndpointID,MemEvent::id_type> respid;
+        respid.insert(std::make_pair(inv->getDstID(), inv->getID()));
         responses.insert(std::make_pair(addr,respid));
     }
 
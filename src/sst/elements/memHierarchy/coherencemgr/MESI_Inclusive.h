@@ -503,6 +503,7 @@ public:
     /** Cache interface **/
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
+    virtual void clampTimestamps(uint64_t time) { cacheArray_->clampTimestamps(time); }
 
     /** Initialization **/
     MemEventInitCoherence * getInitCoherenceEvent();
@@ -551,7 +552,7 @@ private:
     /** Invalidation **/
     bool invalidateExceptRequestor(MemEvent * event, SharedCacheLine * line, bool inMSHR);
     bool invalidateAll(MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd = Command::NULLCMD);
-    uint64_t invalidateSharer(std::string shr, MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd = Command::Inv);
+    uint64_t invalidateSharer(EndpointID shr, MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd = Command::Inv);
     bool invalidateOwner(MemEvent * event, SharedCacheLine * line, bool inMSHR, Command cmd = Command::FetchInv);
 
     /** Forward flush line request, with or without data */
@@ -593,7 +594,7 @@ private:
     State protocolState_;       // State to transition to on exclusive response to read/shared request
     bool protocol_;             // True for MESI, false for MSI
 
-    std::map<Addr, std::map<std::string, MemEvent::id_type> > responses;
+    std::map<Addr, std::map<EndpointID, MemEvent::id_type> > responses;
 
     /* Statistics */
     Statistic<uint64_t>* stat_latencyGetS[3]; // HIT, MISS, INV
@@ -44,7 +44,7 @@ using namespace SST::MemHierarchy;
 bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
     L1CacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ?  line->getState() : I;
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -840,7 +840,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     stat_eventState[(int)Command::GetSResp][state]->addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
 
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), req->getThreadID(), Command::GetSResp, (localPrefetch ? "-pref" : ""), addr, state);
@@ -891,7 +891,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     stat_eventState[(int)Command::GetXResp][state]->addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
 
     if (is_debug_addr(addr)) {
         std::string mod = localPrefetch ? "-pref" : (req->isLoadLink() ? "-LL" : (req->isStoreConditional() ? "-SC" : ""));
@@ -1287,9 +1287,9 @@ void MESIL1::cleanUpAfterRequest(MemEvent * event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting to evict this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -1319,9 +1319,9 @@ void MESIL1::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
                 mshr_->addPendingRetry(addr);
             }
         } else { // Pointer to an eviction
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
         }
@@ -1336,9 +1336,9 @@ void MESIL1::retry(Addr addr) {
             retryBuffer_.push_back(mshr_->getFrontEvent(addr));
             mshr_->addPendingRetry(addr);
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
         }
@@ -1464,7 +1464,7 @@ void MESIL1::forwardFlush(MemEvent* event, L1CacheLine* line, bool evict) {
  * Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cachenameID_, line->getAddr(), line->getAddr(), cmd);
     writeback->setSize(lineSize_);
 
     uint64_t latency = tagLatency_;
@@ -1480,7 +1480,7 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty) {
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -1493,7 +1493,7 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty) {
 void MESIL1::snoopInvalidation(MemEvent * event, L1CacheLine * line) {
     if (snoopL1Invs_ && line) {
         for (auto it = cpus.begin(); it != cpus.end(); it++) {
-            MemEvent * snoop = new MemEvent(cachename_, event->getAddr(), event->getBaseAddr(), Command::Inv);
+            MemEvent * snoop = new MemEvent(cachenameID_, event->getAddr(), event->getBaseAddr(), Command::Inv);
             uint64_t baseTime = timestamp_ > line->getTimestamp() ? timestamp_ : line->getTimestamp();
             uint64_t deliveryTime = baseTime + tagLatency_;
             snoop->setDst(*it);
@@ -387,6 +387,7 @@ public:
     MemEventInitCoherence* getInitCoherenceEvent();
     virtual std::set<Command> getValidReceiveEvents();
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep);
+    void clampTimestamps(uint64_t time) { cacheArray_->clampTimestamps(time); }
 
     void printStatus(Output& out);
 
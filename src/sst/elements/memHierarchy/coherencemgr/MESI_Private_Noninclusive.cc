@@ -2072,9 +2072,9 @@ void MESIPrivNoninclusive::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -2106,9 +2106,9 @@ void MESIPrivNoninclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
             }
         } else {
             if (mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -2123,9 +2123,9 @@ void MESIPrivNoninclusive::retry(Addr addr) {
             retryBuffer_.push_back(mshr_->getFrontEvent(addr));
             mshr_->addPendingRetry(addr);
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
         }
@@ -2258,7 +2258,7 @@ uint64_t MESIPrivNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
  */
 
 uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command cmd, std::vector<uint8_t>* data, bool dirty, uint64_t startTime) {
-    MemEvent* writeback = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent* writeback = new MemEvent(cachenameID_, addr, addr, cmd);
     writeback->setSize(size);
 
     uint64_t latency = tagLatency_;
@@ -2275,7 +2275,7 @@ uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command c
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t sendTime = timestamp_ > startTime ? timestamp_ : startTime;
     sendTime += latency;
@@ -2289,7 +2289,7 @@ uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command c
 
 uint64_t MESIPrivNoninclusive::sendFwdRequest(MemEvent * event, Command cmd, std::string dst, uint32_t size, uint64_t startTime, bool inMSHR) {
     Addr addr = event->getBaseAddr();
-    MemEvent * req = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * req = new MemEvent(cachenameID_, addr, addr, cmd);
     req->copyMetadata(event);
     req->setDst(dst);
     req->setSize(size);
@@ -444,6 +444,7 @@ public:
 
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
+    virtual void clampTimestamps(uint64_t time) { cacheArray_->clampTimestamps(time); }
 
     /* Initialization */
     virtual void hasUpperLevelCacheName(std::string cachename);
@@ -38,7 +38,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
     DataLine * data = (tag) ? dataArray_->lookup(addr, true) : nullptr;
     if (data && data->getTag() != tag) data = nullptr;
 
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
     Command respcmd;
@@ -106,7 +106,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
             recordPrefetchResult(tag, statPrefetchHit);
 
             if (data || mshr_->hasData(addr)) {
-                tag->addSharer(event->getSrc());
+                tag->addSharer(event->getSrcID());
                 if (mshr_->hasData(addr))
                     sendTime = sendResponseUp(event, &(mshr_->getData(addr)), inMSHR, tag->getTimestamp());
                 else
@@ -122,7 +122,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 }
                 if (status == MemEventStatus::OK) {
                     recordLatencyType(event->getID(), LatType::INV);
-                    sendTime = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), inMSHR, tag->getTimestamp());
+                    sendTime = sendFetch(Command::Fetch, event, tag->getSharers()->firstByName(), inMSHR, tag->getTimestamp());
                     tag->setState(S_D);
                     tag->setTimestamp(sendTime - 1);
                     if (is_debug_event(event))
@@ -170,10 +170,10 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 recordLatencyType(event->getID(), LatType::HIT);
                 if (tag->hasSharers()) {
                     respcmd = Command::GetSResp;
-                    tag->addSharer(event->getSrc());
+                    tag->addSharer(event->getSrcID());
                 } else {
                     respcmd = Command::GetXResp;
-                    tag->setOwner(event->getSrc());
+                    tag->setOwner(event->getSrcID());
                 }
                 if (mshr_->hasData(addr))
                     sendTime = sendResponseUp(event, &(mshr_->getData(addr)), inMSHR, tag->getTimestamp(), respcmd);
@@ -188,7 +188,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                         mshr_->setProfiled(addr, event->getID());
                 }
                 if (status == MemEventStatus::OK) {
-                    sendTime = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), inMSHR, tag->getTimestamp());
+                    sendTime = sendFetch(Command::Fetch, event, tag->getSharers()->firstByName(), inMSHR, tag->getTimestamp());
                     state == E ? tag->setState(E_D) : tag->setState(M_D);
                     tag->setTimestamp(sendTime - 1);
                     if (is_debug_event(event))
@@ -294,7 +294,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
             }
         case E:
         case M:
-            if (!tag->hasOtherSharers(event->getSrc()) && !tag->hasOwner()) {
+            if (!tag->hasOtherSharers(event->getSrcID()) && !tag->hasOwner()) {
                 if (is_debug_event(event))
                     eventDI.reason = "hit";
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
@@ -303,9 +303,9 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                     stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                     stat_hits->addData(1);
                 }
-                tag->setOwner(event->getSrc());
-                if (tag->isSharer(event->getSrc())) {
-                    tag->removeSharer(event->getSrc());
+                tag->setOwner(event->getSrcID());
+                if (tag->isSharer(event->getSrcID())) {
+                    tag->removeSharer(event->getSrcID());
                     sendTime = sendResponseUp(event, nullptr, inMSHR, tag->getTimestamp(), Command::GetXResp);
                 } else if (mshr_->hasData(addr))
                     sendTime = sendResponseUp(event, &(mshr_->getData(addr)), inMSHR, tag->getTimestamp(), Command::GetXResp);
@@ -327,8 +327,8 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                     mshr_->setProfiled(addr);
                 }
                 recordLatencyType(event->getID(), LatType::INV);
-                if (tag->hasOtherSharers(event->getSrc())) {
-                    invalidateExceptRequestor(event, tag, inMSHR, !data && !tag->isSharer(event->getSrc()));
+                if (tag->hasOtherSharers(event->getSrcID())) {
+                    invalidateExceptRequestor(event, tag, inMSHR, !data && !tag->isSharer(event->getSrcID()));
                 } else {
                     invalidateOwner(event, tag, inMSHR, Command::FetchInv);
                 }
@@ -423,7 +423,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
                 }
                 if (event->getEvict()) {
                     removeOwnerViaInv(event, tag, data, false);
-                    tag->addSharer(event->getSrc());
+                    tag->addSharer(event->getSrcID());
                     event->setEvict(false); // Don't stall
                 } else if (tag->hasOwner()) {
                     uint64_t sendTime = sendFetch(Command::FetchInvX, event, tag->getOwner(), inMSHR, tag->getTimestamp());
@@ -443,7 +443,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 removeOwnerViaInv(event, tag, data, true);
-                tag->addSharer(event->getSrc());
+                tag->addSharer(event->getSrcID());
 
                 mshr_->decrementAcksNeeded(addr);
                 tag->setState(NextState[tag->getState()]);
@@ -456,7 +456,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_Inv:
             if (event->getEvict()) {
                 removeOwnerViaInv(event, tag, data, false);
-                tag->addSharer(event->getSrc());
+                tag->addSharer(event->getSrcID());
                 event->setEvict(false);
             }
             break;
@@ -587,7 +587,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case SM_D:
         case SB_D:
             if (event->getEvict()) {
-                if (*(tag->getSharers()->begin()) == event->getSrc()) {
+                if (tag->getSharers()->firstByName() == event->getSrcID()) {
                     removeSharerViaInv(event, tag, data, true);
                     mshr_->decrementAcksNeeded(addr);
                     tag->setState(NextState[tag->getState()]);
@@ -660,7 +660,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 stat_eventState[(int)Command::PutS][I]->addData(1);
             }
-            tag->removeSharer(event->getSrc());
+            tag->removeSharer(event->getSrcID());
             sendWritebackAck(event);
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -684,7 +684,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false, 1);   // Put just after the Flush, will handle next
                 break;
             }
-            tag->removeSharer(event->getSrc());
+            tag->removeSharer(event->getSrcID());
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
                 stat_eventState[(int)Command::PutS][state]->addData(1);
@@ -695,11 +695,11 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
         case E_D:
         case M_D:
         case SB_D:
-            if (event->getSrc() == *(tag->getSharers()->begin())) { // Sent fetch to this requestor
+            if (event->getSrcID() == tag->getSharers()->firstByName()) { // Sent fetch to this requestor
                 // Retry the pending fetch
                 mshr_->decrementAcksNeeded(addr);
                 mshr_->setData(addr, event->getPayload());
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty())
                     responses.erase(addr);
                 tag->setState(NextState[state]);
@@ -707,7 +707,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
 
                 // Handle PutS now if we can, later if not
                 if (tag->numSharers() > 1) {
-                    tag->removeSharer(event->getSrc());
+                    tag->removeSharer(event->getSrcID());
                     sendWritebackAck(event);
                     if (inMSHR || !mshr_->getProfiled(addr)) {
                         stat_eventState[(int)Command::PutS][state]->addData(1);
@@ -724,7 +724,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 }
                 break;
             }
-            tag->removeSharer(event->getSrc());
+            tag->removeSharer(event->getSrcID());
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
                 stat_eventState[(int)Command::PutS][state]->addData(1);
@@ -799,7 +799,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
                 mshr_->setData(addr, event->getPayload());
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
             tag->setState(NextState[state]);
@@ -811,7 +811,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                     stat_eventState[(int)Command::PutE][state]->addData(1);
                 }
             } else {
-                tag->addSharer(event->getSrc());
+                tag->addSharer(event->getSrcID());
                 event->setCmd(Command::PutS);
                 if (inMSHR)
                     mshr_->removeFront(addr); // Need to reinsert after the conflicting request
@@ -829,7 +829,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
                 mshr_->setData(addr, event->getPayload());
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
             sendWritebackAck(event);
@@ -906,7 +906,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
         case M_InvX:
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
             tag->setState(M);
@@ -922,7 +922,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 sendWritebackAck(event);
                 cleanUpEvent(event, inMSHR);
             } else {
-                tag->addSharer(event->getSrc());
+                tag->addSharer(event->getSrcID());
                 event->setCmd(Command::PutS);
                 mshr_->setData(addr, event->getPayload());
                 if (inMSHR)
@@ -946,7 +946,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
                 mshr_->setData(addr, event->getPayload());
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
             sendWritebackAck(event);
@@ -984,7 +984,7 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
         mshr_->removePendingRetry(addr);
 
     tag->removeOwner();
-    tag->addSharer(event->getSrc());
+    tag->addSharer(event->getSrcID());
 
     sendWritebackAck(event);
 
@@ -1095,7 +1095,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
                     mshr_->setProfiled(addr);
                     tag->setState(S_D);
                     if (!applyPendingReplacement(addr))
-                        sendTime = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), inMSHR, tag->getTimestamp());
+                        sendTime = sendFetch(Command::Fetch, event, tag->getSharers()->firstByName(), inMSHR, tag->getTimestamp());
                 }
             }
             break;
@@ -1121,7 +1121,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
                     tag->setState(SM_D);
-                    sendTime = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), inMSHR, tag->getTimestamp());
+                    sendTime = sendFetch(Command::Fetch, event, tag->getSharers()->firstByName(), inMSHR, tag->getTimestamp());
                 }
             }
             break;
@@ -1145,7 +1145,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
                     tag->setState(SB_D);
-                    sendTime = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), inMSHR, tag->getTimestamp());
+                    sendTime = sendFetch(Command::Fetch, event, tag->getSharers()->firstByName(), inMSHR, tag->getTimestamp());
                 }
             }
             break;
@@ -1774,7 +1774,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 mshr_->setProfiled(addr);
             } else if (!data && !mshr_->hasData(addr)) {
                 if (!applyPendingReplacement(addr)) {
-                    sendTime = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), inMSHR, tag->getTimestamp());
+                    sendTime = sendFetch(Command::Fetch, event, tag->getSharers()->firstByName(), inMSHR, tag->getTimestamp());
                     tag->setTimestamp(sendTime-1);
                 }
                 state == E ? tag->setState(E_D) : tag->setState(M_D);
@@ -1799,7 +1799,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             // Clean up so that when we replay the replacement we get the right downgraded state
             req->setCmd(Command::PutS);
             tag->removeOwner();
-            tag->addSharer(req->getSrc());
+            tag->addSharer(req->getSrcID());
             tag->setState(SA);
             delete event;
             break;
@@ -1840,7 +1840,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     if (is_debug_event(event))
@@ -1860,7 +1860,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
         if (is_debug_event(event))
             eventDI.action = "Done";
     } else {
-        tag->addSharer(req->getSrc());
+        tag->addSharer(req->getSrcID());
         uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetSResp);
         tag->setTimestamp(sendTime-1);
     }
@@ -1888,7 +1888,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     if (is_debug_event(event))
@@ -1917,11 +1917,11 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
                     eventDI.action = "Done";
             } else {
                 if (tag->getState() == S || !protocol_ || mshr_->getSize(addr) > 1) {
-                    tag->addSharer(req->getSrc());
+                    tag->addSharer(req->getSrcID());
                     uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetSResp);
                     tag->setTimestamp(sendTime - 1);
                 } else {
-                    tag->setOwner(req->getSrc());
+                    tag->setOwner(req->getSrcID());
                     uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetXResp);
                     tag->setTimestamp(sendTime - 1);
                 }
@@ -1934,10 +1934,10 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
         case SM:
         {
             tag->setState(M);
-            tag->setOwner(req->getSrc());
+            tag->setOwner(req->getSrcID());
             uint64_t sendTime = 0;
-            if (tag->isSharer(req->getSrc())) {
-                tag->removeSharer(req->getSrc());
+            if (tag->isSharer(req->getSrcID())) {
+                tag->removeSharer(req->getSrcID());
                 sendTime = sendResponseUp(req, nullptr, true, tag->getTimestamp(), Command::GetXResp);
             } else if (event->getPayloadSize() != 0) {
                 sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetXResp);
@@ -2038,7 +2038,7 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
     bool done = mshr_->decrementAcksNeeded(addr);
 
     // Remove response from expected response list & extract payload
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty())
         responses.erase(addr);
 
@@ -2063,14 +2063,14 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
             break;
         case S_Inv:
         case SB_Inv:
-            tag->removeSharer(event->getSrc());
+            tag->removeSharer(event->getSrcID());
             if (done) {
                 tag->setState(S);
                 retry(addr);
             }
             break;
         case SM_Inv:
-            tag->removeSharer(event->getSrc());
+            tag->removeSharer(event->getSrcID());
             if (done) {
                 tag->setState(SM);
                 if (!mshr_->getInProgress(addr))
@@ -2080,7 +2080,7 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
         case E_InvX:
         case M_InvX:
             tag->removeOwner();
-            tag->addSharer(event->getSrc());
+            tag->addSharer(event->getSrcID());
             tag->setState(NextState[state]); // E or M
             retry(addr);
             break;
@@ -2089,7 +2089,7 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
             if (tag->hasOwner())
                 tag->removeOwner();
             else
-                tag->removeSharer(event->getSrc());
+                tag->removeSharer(event->getSrcID());
             if (done) {
                 tag->setState(NextState[state]);    // E or M
                 retry(addr);
@@ -2133,12 +2133,12 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     mshr_->decrementAcksNeeded(addr);
 
     // Clear expected responses
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     // Update coherence state
     tag->removeOwner();
-    tag->addSharer(event->getSrc());
+    tag->addSharer(event->getSrcID());
 
     if (state == M_InvX || event->getDirty())
         tag->setState(M);
@@ -2179,12 +2179,12 @@ bool MESISharNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
     stat_eventState[(int)Command::AckInv][state]->addData(1);
 
-    if (tag->isSharer(event->getSrc()))
-        tag->removeSharer(event->getSrc());
+    if (tag->isSharer(event->getSrcID()))
+        tag->removeSharer(event->getSrcID());
     else
         tag->removeOwner();
 
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     bool done = mshr_->decrementAcksNeeded(addr);
@@ -2376,8 +2376,8 @@ bool MESISharNoninclusive::handleNACK(MemEvent* event, bool inMSHR) {
             if (is_debug_addr(addr)) {
             }
             if (responses.find(addr) != responses.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst()) != responses.find(addr)->second.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst())->second == nackedEvent->getID()) {
+                    && responses.find(addr)->second.find(nackedEvent->getDstID()) != responses.find(addr)->second.end()
+                    && responses.find(addr)->second.find(nackedEvent->getDstID())->second == nackedEvent->getID()) {
 
                 resendEvent(nackedEvent, true); // Resend towards CPU
             } else {
@@ -2706,9 +2706,9 @@ void MESISharNoninclusive::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -2740,9 +2740,9 @@ void MESISharNoninclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
             }
         } else {
             if (mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                    MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
             }
@@ -2763,9 +2763,9 @@ void MESISharNoninclusive::retry(Addr addr) {
                     eventDI.reason = "retry";
             }
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+            MSHREvictPointers* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictPointers::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MemEvent * ev = new MemEvent(cachenameID_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
             if (is_debug_addr(addr)) {
@@ -2868,7 +2868,7 @@ uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* tag, DataLine* data, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, tag->getAddr(), tag->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cachenameID_, tag->getAddr(), tag->getAddr(), cmd);
     writeback->setSize(lineSize_);
 
     uint64_t latency = tagLatency_;
@@ -2885,7 +2885,7 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > tag->getTimestamp()) ? timestamp_ : tag->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -2895,7 +2895,7 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
 }
 
 void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, tag->getAddr(), tag->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cachenameID_, tag->getAddr(), tag->getAddr(), cmd);
     writeback->setSize(lineSize_);
 
     uint64_t latency = tagLatency_;
@@ -2912,7 +2912,7 @@ void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > tag->getTimestamp()) ? timestamp_ : tag->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -2932,11 +2932,11 @@ void MESISharNoninclusive::sendWritebackAck(MemEvent * event) {
         eventDI.action = "Ack";
 }
 
-uint64_t MESISharNoninclusive::sendFetch(Command cmd, MemEvent * event, std::string dst, bool inMSHR, uint64_t ts) {
+uint64_t MESISharNoninclusive::sendFetch(Command cmd, MemEvent * event, EndpointID dst, bool inMSHR, uint64_t ts) {
     Addr addr = event->getBaseAddr();
-    MemEvent * fetch = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * fetch = new MemEvent(cachenameID_, addr, addr, cmd);
     fetch->copyMetadata(event);
-    fetch->setDst(dst);
+    fetch->setDstID(dst);
     fetch->setSize(event->getSize());
 
     mshr_->incrementAcksNeeded(addr);
@@ -2944,7 +2944,7 @@ uint64_t MESISharNoninclusive::sendFetch(Command cmd, MemEvent * event, std::str
     if (responses.find(addr) != responses.end()) {
         responses.find(addr)->second.insert(std::make_pair(dst, fetch->getID())); // Record events we're waiting for to avoid trying to figure out what happened if we get a NACK
     } else {
-        std::map<std::string,MemEvent::id_type> respid;
+        std::map<EndpointID,MemEvent::id_type> respid;
         respid.insert(std::make_pair(dst, fetch->getID()));
         responses.insert(std::make_pair(addr, respid));
     }
@@ -2963,20 +2963,20 @@ uint64_t MESISharNoninclusive::sendFetch(Command cmd, MemEvent * event, std::str
 
 bool MESISharNoninclusive::invalidateExceptRequestor(MemEvent * event, DirectoryLine * tag, bool inMSHR, bool needData) {
     uint64_t deliveryTime = 0;
-    std::string rqstr = event->getSrc();
+    EndpointID rqstr = event->getSrcID();
 
     bool getData = needData;
-    if (getData && tag->isSharer(event->getSrc()))
+    if (getData && tag->isSharer(event->getSrcID()))
         getData = false;
 
-    for (set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
-        if (*it == rqstr) continue;
+    for (EndpointID sharer : tag->getSharers()->sortedByName()) {
+        if (sharer == rqstr) continue;
 
         if (getData) { // FetchInv
             getData = false;
-            deliveryTime =  invalidateSharer(*it, event, tag, inMSHR, Command::FetchInv);
+            deliveryTime =  invalidateSharer(sharer, event, tag, inMSHR, Command::FetchInv);
         } else { // Inv
-            deliveryTime =  invalidateSharer(*it, event, tag, inMSHR);
+            deliveryTime =  invalidateSharer(sharer, event, tag, inMSHR);
         }
     }
 
@@ -2993,8 +2993,8 @@ bool MESISharNoninclusive::invalidateAll(MemEvent * event, DirectoryLine * tag,
     } else {
         if (cmd == Command::NULLCMD)
             cmd = Command::Inv;
-        for (std::set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
-            deliveryTime = invalidateSharer(*it, event, tag, inMSHR, cmd);
+        for (EndpointID sharer : tag->getSharers()->sortedByName()) {
+            deliveryTime = invalidateSharer(sharer, event, tag, inMSHR, cmd);
         }
         if (deliveryTime != 0) {
             tag->setTimestamp(deliveryTime);
@@ -3006,33 +3006,33 @@ bool MESISharNoninclusive::invalidateAll(MemEvent * event, DirectoryLine * tag,
 
 void MESISharNoninclusive::invalidateSharers(MemEvent * event, DirectoryLine * tag, bool inMSHR, bool needData, Command cmd) {
     uint64_t deliveryTime = 0;
-    for (std::set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
+    for (EndpointID sharer : tag->getSharers()->sortedByName()) {
         if (needData) {
-            deliveryTime = invalidateSharer(*it, event, tag, inMSHR, Command::FetchInv);
+            deliveryTime = invalidateSharer(sharer, event, tag, inMSHR, Command::FetchInv);
             needData = false;
         } else {
-            deliveryTime = invalidateSharer(*it, event, tag, inMSHR, cmd);
+            deliveryTime = invalidateSharer(sharer, event, tag, inMSHR, cmd);
         }
     }
     tag->setTimestamp(deliveryTime);
 
 }
 
-uint64_t MESISharNoninclusive::invalidateSharer(std::string shr, MemEvent * event, DirectoryLine * tag, bool inMSHR, Command cmd) {
+uint64_t MESISharNoninclusive::invalidateSharer(EndpointID shr, MemEvent * event, DirectoryLine * tag, bool inMSHR, Command cmd) {
     if (tag->isSharer(shr)) {
         Addr addr = tag->getAddr();
-        MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+        MemEvent * inv = new MemEvent(cachenameID_, addr, addr, cmd);
         if (event) {
             inv->copyMetadata(event);
         } else {
-            inv->setRqstr(cachename_);
+            inv->setRqstrID(cachenameID_);
         }
-        inv->setDst(shr);
+        inv->setDstID(shr);
         inv->setSize(lineSize_);
         if (responses.find(addr) != responses.end()) {
             responses.find(addr)->second.insert(std::make_pair(shr, inv->getID())); // Record events we're waiting for to avoid trying to figure out what happened if we get a NACK
         } else {
-            std::map<std::string,MemEvent::id_type> respid;
+            std::map<EndpointID,MemEvent::id_type> respid;
             respid.insert(std::make_pair(shr, inv->getID()));
             responses.insert(std::make_pair(addr, respid));
         }
@@ -3056,7 +3056,7 @@ uint64_t MESISharNoninclusive::invalidateSharer(std::string shr, MemEvent * even
 
 bool MESISharNoninclusive::invalidateOwner(MemEvent * metaEvent, DirectoryLine * tag, bool inMSHR, Command cmd) {
     Addr addr = tag->getAddr();
-    if (tag->getOwner() == "")
+    if (!tag->hasOwner())
         return false;
 
     if (is_debug_addr(addr)) {
@@ -3064,23 +3064,23 @@ bool MESISharNoninclusive::invalidateOwner(MemEvent * metaEvent, DirectoryLine *
         eventDI.reason = "Inv owner";
     }
 
-    MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * inv = new MemEvent(cachenameID_, addr, addr, cmd);
     if (metaEvent) {
         inv->copyMetadata(metaEvent);
     } else {
-        inv->setRqstr(cachename_);
+        inv->setRqstrID(cachenameID_);
     }
-    inv->setDst(tag->getOwner());
+    inv->setDstID(tag->getOwner());
     inv->setSize(lineSize_);
 
     mshr_->incrementAcksNeeded(addr);
 
     // Record events we're waiting for to avoid trying to figure out what happened if we get a NACK
     if (responses.find(addr) != responses.end()) {
-        responses.find(addr)->second.insert(std::make_pair(inv->getDst(), inv->getID()));
+        responses.find(addr)->second.insert(std::make_pair(inv->getDstID(), inv->getID()));
     } else {
-        std::map<std::string,MemEvent::id_type> respid;
-        respid.insert(std::make_pair(inv->getDst(), inv->getID()));
+        std::map<EndpointID,MemEvent::id_type> respid;
+        respid.insert(std::make_pair(inv->getDstID(), inv->getID()));
         responses.insert(std::make_pair(addr,respid));
     }
 
@@ -3102,10 +3102,10 @@ bool MESISharNoninclusive::applyPendingReplacement(Addr addr) {
             mshr_->incrementAcksNeeded(addr);
             mshr_->moveEntryToFront(addr, i);
             if (responses.find(addr) != responses.end()) {
-                responses.find(addr)->second.insert(std::make_pair(evb->getSrc(), evb->getID()));
+                responses.find(addr)->second.insert(std::make_pair(evb->getSrcID(), evb->getID()));
             } else {
-                std::map<std::string,MemEvent::id_type> respid;
-                respid.insert(std::make_pair(evb->getSrc(), evb->getID()));
+                std::map<EndpointID,MemEvent::id_type> respid;
+                respid.insert(std::make_pair(evb->getSrcID(), evb->getID()));
                 responses.insert(std::make_pair(addr,respid));
             }
             retry(addr);
@@ -3135,12 +3135,12 @@ void MESISharNoninclusive::forwardByDestination(MemEventBase* ev, Cycle_t timest
 
 void MESISharNoninclusive::removeSharerViaInv(MemEvent * event, DirectoryLine * tag, DataLine * data, bool remove) {
     Addr addr = event->getBaseAddr();
-    tag->removeSharer(event->getSrc());
+    tag->removeSharer(event->getSrcID());
     if (!data && !mshr_->hasData(addr))
         mshr_->setData(addr, event->getPayload());
 
     if (remove) {
-        responses.find(addr)->second.erase(event->getSrc());
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty())
             responses.erase(addr);
     }
@@ -3167,7 +3167,7 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     }
 
     if (remove) {
-        responses.find(addr)->second.erase(event->getSrc());
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty())
             responses.erase(addr);
     }
@@ -546,6 +546,7 @@ public:
         dirArray_->setSliceAware(size, step);
         dataArray_->setSliceAware(size, step);
     }
+    virtual void clampTimestamps(uint64_t time) { dirArray_->clampTimestamps(time); } // Data lines have no timestamp
 
     std::set<Command> getValidReceiveEvents() {
         std::set<Command> cmds = { Command::GetS,
@@ -589,7 +590,7 @@ private:
     /** Invalidate sharers and/or owner; returns either the new line timestamp (or 0 if no invalidation) or a bool indicating whether anything was invalidated */
     bool invalidateExceptRequestor(MemEvent * event, DirectoryLine * line, bool inMSHR, bool needData);
     bool invalidateAll(MemEvent * event, DirectoryLine * line, bool inMSHR, Command cmd = Command::NULLCMD);
-    uint64_t invalidateSharer(std::string shr, MemEvent * event, DirectoryLine * line, bool inMSHR, Command cmd = Command::Inv);
+    uint64_t invalidateSharer(EndpointID shr, MemEvent * event, DirectoryLine * line, bool inMSHR, Command cmd = Command::Inv);
     void invalidateSharers(MemEvent * event, DirectoryLine * line, bool inMSHR, bool needData, Command cmd);
     bool invalidateOwner(MemEvent * event, DirectoryLine * line, bool inMSHR, Command cmd = Command::FetchInv);
 
@@ -607,7 +608,7 @@ private:
     void sendWritebackFromMSHR(Command cmd, DirectoryLine* tag, bool dirty);
     void sendWritebackAck(MemEvent* event);
 
-    uint64_t sendFetch(Command cmd, MemEvent * event, std::string dst, bool inMSHR, uint64_t ts);
+    uint64_t sendFetch(Command cmd, MemEvent * event, EndpointID dst, bool inMSHR, uint64_t ts);
 
     /** Call through to coherenceController with statistic recording */
     void forwardByAddress(MemEventBase* ev, Cycle_t timestamp);
@@ -633,7 +634,7 @@ private:
     bool protocol_;  // True for MESI, false for MSI
     State protocolState_;
 
-    std::map<Addr, std::map<std::string, MemEvent::id_type> > responses;
+    std::map<Addr, std::map<EndpointID, MemEvent::id_type> > responses;
 
     // Map an outstanding eviction (key = replaceAddr,newAddr) to whether it is a directory eviction (true) or data eviction (false)
     std::map<std::pair<Addr,Addr>, bool> evictionType_;
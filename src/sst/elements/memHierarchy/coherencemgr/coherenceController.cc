@@ -25,6 +25,9 @@ using namespace SST::MemHierarchy;
 CoherenceController::CoherenceController(ComponentId_t id, Params &params, Params& ownerParams, bool prefetch) : SubComponent(id) {
     params.insert(ownerParams); // Combine params
 
+    profiler_ = nullptr;
+    functional_ = false;
+
     /* Output stream */
     output = new Output("", 1, 0, SST::Output::STDOUT);
 
@@ -85,6 +88,7 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
 
     // Get parent component's name
     cachename_ = getParentComponentName();
+    cachenameID_ = EndpointRegistry::intern(cachename_);
 
     // Register statistics - only those that are common across all coherence managers
     // Give  all array entries a default statistic so we don't end up with segfaults during execution
@@ -150,8 +154,13 @@ ReplacementPolicy* CoherenceController::createReplacementPolicy(uint64_t lines,
     }
     if (policy == "random") return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.random", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
     if (policy == "nmru")   return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.nmru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "tree-plru") return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.tree-plru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "bit-plru")  return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.bit-plru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "srrip")     return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.srrip", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "brrip")     return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.brrip", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (policy == "lru-stack") return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.lru-stack", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
 
-    debug->fatal(CALL_INFO, -1, "%s, Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', and 'nmru'. You specified '%s'.\n", getName().c_str(), policy.c_str());
+    debug->fatal(CALL_INFO, -1, "%s, Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', 'nmru', 'tree-plru', 'bit-plru', 'srrip', 'brrip', and 'lru-stack'. You specified '%s'.\n", getName().c_str(), policy.c_str());
     return nullptr;
 }
 
@@ -334,9 +343,9 @@ bool CoherenceController::sendOutgoingEvents() {
 
     // Check for ready events in outgoing 'down' queue
     uint64_t bytesLeft = maxBytesDown;
-    while (!outgoingEventQueueDown_.empty() && outgoingEventQueueDown_.front().deliveryTime <= timestamp_) {
+    while (!outgoingEventQueueDown_.empty() && (functional_ || outgoingEventQueueDown_.front().deliveryTime <= timestamp_)) {
         MemEventBase *outgoingEvent = outgoingEventQueueDown_.front().event;
-        if (maxBytesDown != 0) {
+        if (maxBytesDown != 0 && !functional_) {
             if (bytesLeft == 0) break;
             if (bytesLeft >= outgoingEventQueueDown_.front().size) {
                 bytesLeft -= outgoingEventQueueDown_.front().size;  // Send this many bytes
@@ -352,6 +361,7 @@ bool CoherenceController::sendOutgoingEvents() {
                     getCurrentSimCycle(), timestamp_, cachename_.c_str(), outgoingEvent->getBriefString().c_str());
         }
 
+        MEMH_TRACE_MARK(outgoingEvent, Access, getCurrentSimCycle());
         linkDown_->send(outgoingEvent);
         outgoingEventQueueDown_.pop_front();
 
@@ -359,9 +369,9 @@ bool CoherenceController::sendOutgoingEvents() {
 
     // Check for ready events in outgoing 'up' queue
     bytesLeft = maxBytesUp;
-    while (!outgoingEventQueueUp_.empty() && outgoingEventQueueUp_.front().deliveryTime <= timestamp_) {
+    while (!outgoingEventQueueUp_.empty() && (functional_ || outgoingEventQueueUp_.front().deliveryTime <= timestamp_)) {
         MemEventBase * outgoingEvent = outgoingEventQueueUp_.front().event;
-        if (maxBytesUp != 0) {
+        if (maxBytesUp != 0 && !functional_) {
             if (bytesLeft == 0) break;
             if (bytesLeft >= outgoingEventQueueUp_.front().size) {
                 bytesLeft -= outgoingEventQueueUp_.front().size;
@@ -382,6 +392,7 @@ bool CoherenceController::sendOutgoingEvents() {
             startTimes_.erase(outgoingEvent->getResponseToID());
         }
 
+        MEMH_TRACE_MARK(outgoingEvent, Access, getCurrentSimCycle());
         linkUp_->send(outgoingEvent);
         outgoingEventQueueUp_.pop_front();
     }
@@ -394,6 +405,15 @@ bool CoherenceController::checkIdle() {
     return outgoingEventQueueDown_.empty() && outgoingEventQueueUp_.empty();
 }
 
+uint64_t CoherenceController::getNextSendTime() {
+    uint64_t next = 0;
+    if (!outgoingEventQueueDown_.empty())
+        next = outgoingEventQueueDown_.front().deliveryTime;
+    if (!outgoingEventQueueUp_.empty() && (next == 0 || outgoingEventQueueUp_.front().deliveryTime < next))
+        next = outgoingEventQueueUp_.front().deliveryTime;
+    return next;
+}
+
 
 /* Forward an event using memory address to locate a destination. */
 void CoherenceController::forwardByAddress(MemEventBase * event) {
@@ -401,16 +421,16 @@ void CoherenceController::forwardByAddress(MemEventBase * event) {
 }
 
 void CoherenceController::forwardByAddress(MemEventBase * event, Cycle_t ts) {
-    event->setSrc(cachename_);
-    std::string dst = linkDown_->findTargetDestination(event->getRoutingAddress());
-    if (dst != "") { /* Common case */
-        event->setDst(dst);
+    event->setSrcID(cachenameID_);
+    EndpointID dst = linkDown_->findTargetDestinationID(event->getRoutingAddress());
+    if (dst != EndpointRegistry::NO_ENDPOINT) { /* Common case */
+        event->setDstID(dst);
         Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
         addToOutgoingQueue(fwdReq);
     } else {
-        dst = linkUp_->findTargetDestination(event->getRoutingAddress());
-        if (dst != "") {
-            event->setDst(dst);
+        dst = linkUp_->findTargetDestinationID(event->getRoutingAddress());
+        if (dst != EndpointRegistry::NO_ENDPOINT) {
+            event->setDstID(dst);
             Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
             addToOutgoingQueueUp(fwdReq);
         } else {
@@ -430,12 +450,12 @@ void CoherenceController::forwardByDestination(MemEventBase * event) {
 
 /* Forward an event to a specific destination */
 void CoherenceController::forwardByDestination(MemEventBase * event, Cycle_t ts) {
-    event->setSrc(cachename_);
+    event->setSrcID(cachenameID_);
     Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
     
-    if (linkUp_->isReachable(event->getDst())) {
+    if (linkUp_->isReachable(event->getDstID())) {
         addToOutgoingQueueUp(fwdReq);
-    } else if (linkDown_->isReachable(event->getDst())) {
+    } else if (linkDown_->isReachable(event->getDstID())) {
         addToOutgoingQueue(fwdReq);
     } else {
         output->fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
@@ -502,6 +522,12 @@ void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessT
 
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->notifyAccess(notify);
+
+    if (profiler_) {
+        profiler_->record(RegionEvent::Access, event->getBaseAddr(), event->getSrcID());
+        if (resultT == MISS)
+            profiler_->record(RegionEvent::Miss, event->getBaseAddr(), 0);
+    }
 }
 
 
@@ -511,6 +537,9 @@ void CoherenceController::notifyListenerOfEvict(Addr addr, uint32_t size, Addr i
     for (int i = 0; i < listeners_.size(); i++) {
         listeners_[i]->notifyAccess(notify);
     }
+
+    if (profiler_)
+        profiler_->record(RegionEvent::Evict, addr, 0);
 }
 
 
@@ -615,7 +644,7 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool fwdReq,
     // Screen prefetches first to ensure limits are not exceeeded:
     //      - Maximum number of outstanding prefetches
     //      - MSHR too full to accept prefetches
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cachenameID_) {
         if (dropPrefetchLevel_ <= mshr_->getSize()) {
             eventDI.action = "Reject";
             eventDI.reason = "Prefetch drop level";
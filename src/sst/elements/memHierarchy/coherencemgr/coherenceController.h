@@ -28,6 +28,7 @@
 
 #include "util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
+#include "sst/elements/memHierarchy/regionProfiler.h"
 #include "sst/elements/memHierarchy/mshr.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
@@ -110,6 +111,9 @@ public:
     /* Check whether the event queues are empty/subcomponent is doing anything */
     bool checkIdle();
 
+    /* Earliest timestamp at which the head of an outgoing queue can be sent, or 0 if both queues are empty */
+    uint64_t getNextSendTime();
+
     /* Get which bank an address maps to (call through to cache array) */
     virtual Addr getBank(Addr addr) = 0;
 
@@ -137,6 +141,12 @@ public:
         maxOutstandingPrefetch_ = maxOutPrefetches;
     }
 
+    /* Set address region profiler, may be null */
+    void setRegionProfiler(RegionProfiler* ptr) { profiler_ = ptr; }
+
+    /* Functional warm-up: send outgoing events as soon as they are queued, ignoring latency and bandwidth */
+    void setFunctional(bool functional) { functional_ = functional; }
+
     /* Set MSHR */
     void setMSHR(MSHR* ptr) { mshr_ = ptr; }
 
@@ -155,6 +165,10 @@ public:
     /* Call through to cache array to configure banking/slicing */
     virtual void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) = 0;
 
+    /* Call through to cache array to pull line timestamps back to 'time' when functional warm-up ends.
+     * Latency is still added to a line's timestamp on every warm-up access even though nothing waits for it. */
+    virtual void clampTimestamps(uint64_t time) = 0;
+
     /* Register callback to enable the cache's clock if needed */
     void registerClockEnableFunction(std::function<void()> fcn) { reenableClock_ = fcn; }
     
@@ -262,12 +276,14 @@ protected:
 
     /* Listeners: prefetchers, tracers, etc. */
     std::vector<CacheListener*> listeners_;
+    RegionProfiler* profiler_;
     size_t maxOutstandingPrefetch_;
     size_t dropPrefetchLevel_;
     size_t outstandingPrefetches_;
 
     /* Cache name - used for identifying where events came from/are going to */
     std::string cachename_;
+    EndpointID cachenameID_;
 
     /* Output & debug */
     Output* output; // Output stream for warnings, notices, fatal, etc.
@@ -348,6 +364,7 @@ protected:
     uint64_t maxBytesUp;
     uint64_t maxBytesDown;
     uint64_t packetHeaderBytes;
+    bool functional_;
 
     /* Prefetch statistics */
     Statistic<uint64_t>* statPrefetchEvict;
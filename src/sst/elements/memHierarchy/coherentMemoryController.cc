@@ -47,6 +47,11 @@ using namespace SST::MemHierarchy;
 CoherentMemController::CoherentMemController(ComponentId_t id, Params &params) : MemController(id, params) {
     directory_ = false; /* Updated during init */
     timestamp_ = 0;
+
+    if (warmup_.active()) {
+        out.verbose(CALL_INFO, 1, 0, "%s, WARNING: functional warm-up is not supported by this memory controller; 'warmup_time' and 'warmup_signal_addr' are ignored.\n", getName().c_str());
+        warmup_.end();
+    }
 }
 
 /**
@@ -327,7 +332,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
 
     MemEvent* put = NULL;
     if (ev->getPayloadSize() != 0) {
-        put = new MemEvent(getName(), ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
+        put = new MemEvent(nameID_, ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
         put->setFlag(MemEvent::F_NORESPONSE);
         outstandingEventList_.insert(std::make_pair(put->getID(), OutstandingEvent(put, put->getBaseAddr())));
         notifyListeners(ev);
@@ -412,7 +417,7 @@ void CoherentMemController::handleFetchResp(MemEvent * ev) {
 
     // Write dirty data if needed
     if (ev->getDirty()) {
-        MemEvent * write = new MemEvent(getName(), ev->getAddr(), baseAddr, Command::PutM, ev->getPayload());
+        MemEvent * write = new MemEvent(nameID_, ev->getAddr(), baseAddr, Command::PutM, ev->getPayload());
         write->copyMetadata(ev);
         ev->setFlag(MemEvent::F_NORESPONSE);
 
@@ -510,7 +515,7 @@ void CoherentMemController::handleCustomCmd(MemEventBase * evb) {
 bool CoherentMemController::doShootdown(Addr addr, MemEventBase * ev) {
     if (cacheStatus_.at(addr/lineSize_) == true) {
         Addr globalAddr = translateToGlobal(addr);
-        MemEvent * inv = new MemEvent(getName(), globalAddr, globalAddr, Command::FetchInv, lineSize_);
+        MemEvent * inv = new MemEvent(nameID_, globalAddr, globalAddr, Command::FetchInv, lineSize_);
         inv->copyMetadata(ev);
         inv->setDst(ev->getSrc());
 
@@ -0,0 +1,238 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_DESTINATIONINDEX_H
+#define MEMHIERARCHY_DESTINATIONINDEX_H
+
+#include <vector>
+#include <algorithm>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Address -> destination routing table for memory links
+ *
+ * Built from the (region, endpoint) pairs a link learns during init. The address
+ * space is cut at every region start/end into segments, so each segment is covered by
+ * a fixed list of regions. For a segment covered only by plain ranges, the answer is
+ * a single entry. For interleaved regions, the interleave pattern repeats every
+ * lcm(interleaveStep) bytes and is constant within each gcd-sized granule, so the
+ * segment stores a direct-mapped table with one slot per granule of one period.
+ * A lookup is a binary search over segments (usually just one) followed by an index.
+ *
+ * Results match a linear scan of the entries in insertion order: if regions overlap,
+ * the first one added that contains the address wins.
+ */
+class DestinationIndex {
+public:
+    struct Entry {
+        MemRegion region;
+        EndpointID id;          /* Destination name */
+        uint64_t netAddr;       /* Network address (if on a network) */
+    };
+
+    DestinationIndex() : built_(true) { }
+
+    void clear() {
+        entries_.clear();
+        segments_.clear();
+        built_ = true;
+    }
+
+    void add(const MemRegion& region, EndpointID id, uint64_t netAddr = 0) {
+        Entry entry;
+        entry.region = region;
+        entry.id = id;
+        entry.netAddr = netAddr;
+        entries_.push_back(entry);
+        built_ = false;
+    }
+
+    bool empty() const { return entries_.empty(); }
+    const std::vector<Entry>& getEntries() const { return entries_; }
+
+    /* Return the entry whose region contains addr or nullptr if there is none */
+    const Entry* find(Addr addr) {
+        if (!built_)
+            build();
+
+        // Last segment starting at or below addr
+        auto it = std::upper_bound(segments_.begin(), segments_.end(), addr,
+                [](Addr a, const Segment& seg) { return a < seg.start; });
+        if (it == segments_.begin())
+            return nullptr;
+        const Segment& seg = *(--it);
+        if (addr > seg.end)
+            return nullptr;
+
+        int32_t index;
+        if (seg.period == 0) {
+            index = seg.single;
+        } else if (!seg.slots.empty()) {
+            Addr offset = addr - seg.start;
+            offset = seg.pow2 ? (offset & (seg.period - 1)) >> seg.granuleShift : (offset % seg.period) / seg.granule;
+            index = seg.slots[offset];
+        } else {
+            index = -1;
+            for (uint32_t candidate : seg.candidates) {
+                if (entries_[candidate].region.contains(addr)) {
+                    index = candidate;
+                    break;
+                }
+            }
+        }
+        return index < 0 ? nullptr : &entries_[index];
+    }
+
+    /* Convenience: destination ID for addr or NO_ENDPOINT */
+    EndpointID findID(Addr addr) {
+        const Entry* entry = find(addr);
+        return entry ? entry->id : EndpointRegistry::NO_ENDPOINT;
+    }
+
+private:
+    /* Largest per-segment slot table; beyond this the segment falls back to scanning its candidates */
+    static constexpr Addr maxSlots = 1 << 16;
+
+    struct Segment {
+        Addr start;                         /* First address in segment */
+        Addr end;                           /* Last address in segment */
+        Addr period;                        /* 0 if the segment is not interleaved */
+        Addr granule;
+        bool pow2;                          /* period & granule are powers of 2 */
+        uint32_t granuleShift;
+        int32_t single;                     /* Entry index if not interleaved (-1 = none) */
+        std::vector<int32_t> slots;         /* Entry index per granule of one period */
+        std::vector<uint32_t> candidates;   /* Entries overlapping this segment, in insertion order */
+    };
+
+    static Addr gcd(Addr a, Addr b) {
+        while (b != 0) {
+            Addr t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    static bool isPow2(Addr x) { return x != 0 && (x & (x - 1)) == 0; }
+
+    void build() {
+        segments_.clear();
+        built_ = true;
+
+        // Segment boundaries
+        std::vector<Addr> points;
+        bool reachesMax = false;
+        for (const Entry& entry : entries_) {
+            if (entry.region.end < entry.region.start)
+                continue;
+            points.push_back(entry.region.start);
+            if (entry.region.end == MemRegion::REGION_MAX)
+                reachesMax = true;
+            else
+                points.push_back(entry.region.end + 1);
+        }
+        std::sort(points.begin(), points.end());
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+
+        for (size_t p = 0; p < points.size(); p++) {
+            Segment seg;
+            seg.start = points[p];
+            if (p + 1 < points.size())
+                seg.end = points[p + 1] - 1;
+            else if (reachesMax)
+                seg.end = MemRegion::REGION_MAX;
+            else
+                break; // Past the end of every region
+
+            for (uint32_t i = 0; i < entries_.size(); i++) {
+                const MemRegion& region = entries_[i].region;
+                if (region.start <= seg.start && region.end >= seg.start)
+                    seg.candidates.push_back(i);
+            }
+            if (seg.candidates.empty())
+                continue;
+
+            buildSegment(seg);
+            segments_.push_back(std::move(seg));
+        }
+    }
+
+    void buildSegment(Segment& seg) {
+        seg.period = 0;
+        seg.granule = 0;
+        seg.pow2 = false;
+        seg.granuleShift = 0;
+        seg.single = -1;
+
+        // Period and granule of the combined interleave pattern
+        Addr period = 1;
+        Addr granule = 0;
+        bool overflow = false;
+        for (uint32_t candidate : seg.candidates) {
+            const MemRegion& region = entries_[candidate].region;
+            if (region.interleaveSize == 0) {
+                if (granule == 0) { // No interleaved region before this one so it wins everywhere
+                    seg.single = candidate;
+                    seg.candidates.clear();
+                    return;
+                }
+                continue;
+            }
+            Addr step = region.interleaveStep;
+            Addr phase = (seg.start - region.start) % step;
+            granule = gcd(granule, gcd(step, gcd(region.interleaveSize, phase)));
+            Addr multiple = period / gcd(period, step);
+            if (multiple > MemRegion::REGION_MAX / step) { // Pattern too long to tabulate
+                overflow = true;
+                break;
+            }
+            period = multiple * step;
+        }
+
+        seg.period = period;
+        if (overflow || period / granule > maxSlots)
+            return; // Scan candidates on lookup
+
+        seg.granule = granule;
+        seg.pow2 = isPow2(period) && isPow2(granule);
+        seg.granuleShift = seg.pow2 ? __builtin_ctzll(granule) : 0;
+        seg.slots.assign(period / granule, -1);
+        for (Addr s = 0; s < seg.slots.size(); s++) {
+            Addr offset = s * granule;
+            for (uint32_t candidate : seg.candidates) {
+                const MemRegion& region = entries_[candidate].region;
+                if (region.interleaveSize == 0 || (((seg.start - region.start) % region.interleaveStep + offset) % region.interleaveStep) < region.interleaveSize) {
+                    seg.slots[s] = candidate;
+                    break;
+                }
+            }
+        }
+        seg.candidates.clear();
+    }
+
+    std::vector<Entry> entries_;
+    std::vector<Segment> segments_;
+    bool built_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_DESTINATIONINDEX_H */
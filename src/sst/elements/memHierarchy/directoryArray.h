@@ -0,0 +1,145 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_DIRECTORYARRAY_H
+#define MEMHIERARCHY_DIRECTORYARRAY_H
+
+#include <vector>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Set-associative storage for sparse directory entries
+ *
+ * All entries are allocated up front so the footprint is fixed by the entry count,
+ * independent of how much of the address space is touched. Lines are hashed to sets
+ * so that interleaving across directories does not leave sets unused. Find, allocate,
+ * and victim selection each look at one set, so their cost is bounded by the associativity.
+ *
+ * The array only tracks which ways are in use and their LRU order; whether an entry
+ * can be reused or evicted is up to the caller (see allocate() and findVictim()).
+ */
+template<class T>
+class SparseDirectoryArray {
+public:
+    SparseDirectoryArray(uint64_t entries, uint32_t associativity, uint64_t lineSize, const T& blank) :
+        assoc_(associativity), sets_(entries / associativity), lineSize_(lineSize), clock_(0),
+        ways_(entries), entries_(entries, blank) { }
+
+    uint64_t getSetCount() const { return sets_; }
+    uint32_t getAssociativity() const { return assoc_; }
+
+    /* Entry for addr or nullptr if it is not present. A hit makes the entry most recently used. */
+    T* find(Addr addr) {
+        size_t base = getSet(addr) * assoc_;
+        for (size_t i = base; i < base + assoc_; i++) {
+            if (ways_[i].valid && ways_[i].addr == addr) {
+                ways_[i].lastUse = ++clock_;
+                return &entries_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /*
+     * Assign a way in addr's set to addr. Empty ways are used first, then any way
+     * whose entry isFree(T&) accepts. Returns nullptr if the set has no such way.
+     * The caller is responsible for resetting the returned entry.
+     */
+    template<class F>
+    T* allocate(Addr addr, F isFree) {
+        size_t base = getSet(addr) * assoc_;
+        size_t slot = npos;
+        for (size_t i = base; i < base + assoc_; i++) {
+            if (!ways_[i].valid) {
+                slot = i;
+                break;
+            }
+            if (slot == npos && isFree(entries_[i]))
+                slot = i;
+        }
+        if (slot == npos)
+            return nullptr;
+
+        ways_[slot].addr = addr;
+        ways_[slot].valid = true;
+        ways_[slot].lastUse = ++clock_;
+        return &entries_[slot];
+    }
+
+    /* Least recently used entry in addr's set that canEvict(T&) accepts, or nullptr */
+    template<class F>
+    T* findVictim(Addr addr, F canEvict) {
+        size_t base = getSet(addr) * assoc_;
+        size_t victim = npos;
+        for (size_t i = base; i < base + assoc_; i++) {
+            if (!ways_[i].valid || !canEvict(entries_[i]))
+                continue;
+            if (victim == npos || ways_[i].lastUse < ways_[victim].lastUse)
+                victim = i;
+        }
+        return victim == npos ? nullptr : &entries_[victim];
+    }
+
+    /* Whether any entry in addr's set satisfies pred(T&) */
+    template<class F>
+    bool anyInSet(Addr addr, F pred) {
+        size_t base = getSet(addr) * assoc_;
+        for (size_t i = base; i < base + assoc_; i++) {
+            if (ways_[i].valid && pred(entries_[i]))
+                return true;
+        }
+        return false;
+    }
+
+    /* Call f(addr, T&) for each entry in use */
+    template<class F>
+    void forEach(F f) {
+        for (size_t i = 0; i < ways_.size(); i++) {
+            if (ways_[i].valid)
+                f(ways_[i].addr, entries_[i]);
+        }
+    }
+
+private:
+    static constexpr size_t npos = (size_t)-1;
+
+    struct Way {
+        Addr addr;
+        uint64_t lastUse;
+        bool valid;
+
+        Way() : addr(0), lastUse(0), valid(false) { }
+    };
+
+    uint64_t getSet(Addr addr) const {
+        uint64_t line = addr / lineSize_;
+        return ((line * 0x9E3779B97F4A7C15ULL) >> 32) % sets_;
+    }
+
+    uint32_t assoc_;
+    uint64_t sets_;
+    uint64_t lineSize_;
+    uint64_t clock_;
+    std::vector<Way> ways_;
+    std::vector<T> entries_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_DIRECTORYARRAY_H */
@@ -41,6 +41,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     dlevel = debugLevel;
     cacheLineSize = params.find<uint32_t>("cache_line_size", 64);
     lineSize = cacheLineSize;
+    nameID = EndpointRegistry::intern(getName());
 
     dbg.init("", debugLevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
 
@@ -113,6 +114,15 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     defaultTimeBase = registerClock(params.find<std::string>("clock", "1GHz"), clockHandler);
     clockOn = true;
 
+    UnitAlgebra warmupTime(params.find<std::string>("warmup_time", "0ns"));
+    if (!warmupTime.hasUnits("s")) {
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): warmup_time - must have units of s (SI prefixes ok). You specified %s\n",
+                getName().c_str(), warmupTime.toString().c_str());
+    }
+    bool warmupSignalFound;
+    Addr warmupSignal = params.find<Addr>("warmup_signal_addr", 0, warmupSignalFound);
+    warmup.configure(warmupTime.isValueZero() ? 0 : getTimeConverter(warmupTime)->getFactor(), warmupSignalFound, warmupSignal);
+
     /*
      *  *****************************
      *  Regions & memory name
@@ -131,6 +141,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
     cpuLink = loadUserSubComponent<MemLinkBase>("cpulink", ComponentInfo::SHARE_NONE, defaultTimeBase);
     memLink = loadUserSubComponent<MemLinkBase>("memlink", ComponentInfo::SHARE_NONE, defaultTimeBase);
+    profiler = loadUserSubComponent<RegionProfiler>("profiler");
     if (cpuLink || memLink) {
         if (!cpuLink) {
             cpuLink = memLink;
@@ -304,6 +315,18 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     entryCacheSize = 0;
     entrySize = 4; // Bytes, TODO parameterize
 
+    uint64_t sparseEntries = params.find<uint64_t>("sparse_entries", 0);
+    uint32_t sparseAssoc = params.find<uint32_t>("sparse_associativity", 8);
+    sparseDir = nullptr;
+    stat_dirEvictions = nullptr;
+    if (sparseEntries != 0) {
+        if (sparseAssoc == 0 || sparseEntries % sparseAssoc != 0)
+            dbg.fatal(CALL_INFO, -1, "Invalid param(%s): sparse_entries (%" PRIu64 ") must be a nonzero multiple of sparse_associativity (%" PRIu32 ")\n",
+                    getName().c_str(), sparseEntries, sparseAssoc);
+        sparseDir = new SparseDirectoryArray<DirEntry>(sparseEntries, sparseAssoc, lineSize, DirEntry(0, &sharerIndex));
+        stat_dirEvictions = registerStatistic<uint64_t>("directory_evictions");
+    }
+
     string protstr  = params.find<std::string>("coherence_protocol", "MESI");
     if (protstr == "mesi" || protstr == "MESI") protocol = CoherenceProtocol::MESI;
     else if (protstr == "msi" || protstr == "MSI") protocol = CoherenceProtocol::MSI;
@@ -325,6 +348,7 @@ DirectoryController::~DirectoryController(){
         delete i->second;
     }
     directory.clear();
+    delete sparseDir;
 }
 
 
@@ -332,7 +356,9 @@ DirectoryController::~DirectoryController(){
 void DirectoryController::handlePacket(SST::Event *event){
     MemEventBase *evb = static_cast<MemEventBase*>(event);
     evb->setDeliveryTime(getCurrentSimTimeNano());
-    if (!clockOn) {
+    if (warmup.active() && warmup.endsWith(evb, getCurrentSimCycle()))
+        endWarmup();
+    if (!clockOn && !warmup.active()) {
         turnClockOn();
     }
 
@@ -348,6 +374,8 @@ void DirectoryController::handlePacket(SST::Event *event){
             handleNoncacheableRequest(evb);
         else
             handleNoncacheableResponse(evb);
+        if (warmup.active())
+            processWarmup();
         return;
 
     }
@@ -356,6 +384,64 @@ void DirectoryController::handlePacket(SST::Event *event){
     if (CommandClassArr[(int)ev->getCmd()] == CommandClass::Request)
         recordStartLatency(ev);
     eventBuffer.push_back(ev);
+
+    if (warmup.active())
+        processWarmup();
+}
+
+/*
+ * Functional warm-up: handle buffered events until none can make progress,
+ * then send everything that resulted without waiting for the clock.
+ */
+void DirectoryController::processWarmup() {
+    // The clock is off, so keep the timestamp at the current cycle for outgoing event times
+    SimTime_t now = getCurrentSimTime(defaultTimeBase);
+    if (now > timestamp)
+        timestamp = now;
+
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        addrsThisCycle.clear();
+
+        std::list<MemEvent*>::iterator it = retryBuffer.begin();
+        while (it != retryBuffer.end()) {
+            if (processPacket(*it, true)) {
+                progress = true;
+                it = retryBuffer.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        it = eventBuffer.begin();
+        while (it != eventBuffer.end()) {
+            if (processPacket(*it, false)) {
+                progress = true;
+                it = eventBuffer.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+
+    sendOutgoingEvents();
+
+    bool idle = true;
+    if (clockCpuLink)
+        idle &= cpuLink->clock();
+    if (clockMemLink)
+        idle &= memLink->clock();
+    if (!idle && !clockOn)
+        turnClockOn();
+}
+
+/* Leave functional warm-up. Anything still buffered is handled on the clock from here on. */
+void DirectoryController::endWarmup() {
+    warmup.end();
+    out.verbose(CALL_INFO, 2, 0, "%s, Ending functional warm-up at %" PRIu64 "ns\n", getName().c_str(), getCurrentSimTimeNano());
+    if (!clockOn && (!eventBuffer.empty() || !retryBuffer.empty() || !cpuMsgQueue.empty() || !memMsgQueue.empty()))
+        turnClockOn();
 }
 
 /**
@@ -428,6 +514,8 @@ bool DirectoryController::clock(SST::Cycle_t cycle){
 
 
 bool DirectoryController::processPacket(MemEvent * ev, bool replay) {
+    MEMH_TRACE_MARK(ev, Wait, getCurrentSimCycle());
+
     bool dbgevent = false;
     if (is_debug_event(ev)) {
         fflush(stdout);
@@ -458,6 +546,8 @@ bool DirectoryController::processPacket(MemEvent * ev, bool replay) {
 
     if (!replay) {
         stat_eventRecv[(int)cmd]->addData(1);
+        if (profiler && CommandClassArr[(int)cmd] == CommandClass::Request)
+            profiler->record(RegionEvent::Access, addr, ev->getSrcID());
     }
 
     if (!ev->isAddrGlobal()) {
@@ -465,6 +555,18 @@ bool DirectoryController::processPacket(MemEvent * ev, bool replay) {
         return true;
     }
 
+    /* With a sparse directory, the line needs an entry before it can be handled */
+    if (sparseDir && !sparseDir->find(addr) && !allocateSparseEntry(addr)) {
+        if (is_debug_addr(addr)) {
+            std::stringstream id;
+            id << "<" << ev->getID().first << "," << ev->getID().second << ">";
+            dbg.debug(_L5_, "A: %-20" PRIu64 " %-20" PRIu64 " %-20s %-13s 0x%-16" PRIx64 " %-15s %-6s %-6s %-10s %-15s\n",
+                    getCurrentSimCycle(), timestamp, getName().c_str(), CommandString[(int)ev->getCmd()],
+                    addr, id.str().c_str(), "", "", "Stall", "(dir full)");
+        }
+        return false;
+    }
+
     switch (cmd) {
         case Command::GetS:
             retval = handleGetS(ev, replay);
@@ -556,7 +658,7 @@ void DirectoryController::handleNoncacheableRequest(MemEventBase * ev) {
     }
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
-    ev->setSrc(getName());
+    ev->setSrcID(nameID);
     forwardByAddress(ev, timestamp + 1);
 }
 
@@ -567,7 +669,7 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
                 getName().c_str(), ev->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
     }
     ev->setDst(noncacheMemReqs[ev->getID()]);
-    ev->setSrc(getName());
+    ev->setSrcID(nameID);
 
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
@@ -603,6 +705,10 @@ void DirectoryController::printStatus(Output &statusOut) {
     for (std::unordered_map<Addr, DirEntry*>::iterator it = directory.begin(); it != directory.end(); it++) {
         statusOut.output("    0x%" PRIx64 " %s\n", it->first, it->second->getString().c_str());
     }
+    if (sparseDir) {
+        sparseDir->forEach([&statusOut](Addr addr, DirEntry& entry) {
+                statusOut.output("    0x%" PRIx64 " %s\n", addr, entry.getString().c_str()); });
+    }
     statusOut.output("End MemHierarchy::DirectoryController\n\n");
 }
 
@@ -662,7 +768,7 @@ void DirectoryController::init(unsigned int phase) {
                 }
             } else if (ev->getInitCmd() == MemEventInit::InitCommand::Endpoint) {
                 MemEventInit * mEv = ev->clone();
-                mEv->setSrc(getName());
+                mEv->setSrcID(nameID);
                 memLink->sendUntimedData(mEv);
             }
             delete ev;
@@ -694,7 +800,7 @@ void DirectoryController::init(unsigned int phase) {
                         waitWBAck = true;
                 } else if (initEv->getInitCmd() == MemEventInit::InitCommand::Endpoint) {
                     MemEventInit * mEv = initEv->clone();
-                    mEv->setSrc(getName());
+                    mEv->setSrcID(nameID);
                     cpuLink->sendUntimedData(mEv);
                 }
             }
@@ -706,6 +812,8 @@ void DirectoryController::init(unsigned int phase) {
 
 
 void DirectoryController::finish(void){
+    if (profiler)
+        profiler->finish();
     cpuLink->finish();
 }
 
@@ -759,12 +867,12 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
                         sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
                     } else if (protocol == CoherenceProtocol::MESI) {
                         entry->setState(M);
-                        entry->setOwner(event->getSrc());
+                        entry->setOwner(event->getSrcID());
                         sendDataResponse(event, entry, mshr->getData(addr), Command::GetXResp);
                         mshr->clearData(addr);
                     } else {
                         entry->setState(S);
-                        entry->addSharer(event->getSrc());
+                        entry->addSharer(event->getSrcID());
                         sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
                     }
                     if (is_debug_event(event)) {
@@ -787,7 +895,7 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
         case S:
             if (mshr->hasData(addr)) { // saved from earlier request
                 if (incoherentSrc.find(event->getSrc()) == incoherentSrc.end()) {
-                    entry->addSharer(event->getSrc());
+                    entry->addSharer(event->getSrcID());
                 }
                 sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
                 if (is_debug_event(event)) {
@@ -869,7 +977,7 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
                 } else {
                     if (incoherentSrc.find(event->getSrc()) == incoherentSrc.end()) {
                         entry->setState(M);
-                        entry->setOwner(event->getSrc());
+                        entry->setOwner(event->getSrcID());
                     }
                     sendDataResponse(event, entry, mshr->getData(addr), Command::GetXResp);
                     mshr->clearData(addr);
@@ -894,13 +1002,13 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
             // Upgrade request and no other sharers -> respond & M
             // Upgrade request and other sharers -> invalidate other sharers & S_Inv
             // Otherwise need data & invalidate sharers -> invalidate other sharers, request data from Memory, SM_Inv
-            if (entry->isSharer(event->getSrc())) { // Don't need data
+            if (entry->isSharer(event->getSrcID())) { // Don't need data
                 if (entry->getSharerCount() == 1) { // Also don't need to invalidate
                     if (mshr->hasData(addr))
                         mshr->clearData(addr);
                     entry->setState(M);
-                    entry->removeSharer(event->getSrc());
-                    entry->setOwner(event->getSrc());
+                    entry->removeSharer(event->getSrcID());
+                    entry->setOwner(event->getSrcID());
                     sendResponse(event);
                     if (is_debug_event(event)) {
                         eventDI.reason = "hit";
@@ -1092,7 +1200,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    entry->addSharer(event->getSrc());
+                    entry->addSharer(event->getSrcID());
                     mshr->setData(addr, event->getPayload(), event->getDirty());
                     event->setEvict(false);
                 } else if (entry->hasOwner()) {
@@ -1107,7 +1215,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_Inv:
             if (event->getEvict()) {
                 entry->removeOwner();
-                entry->addSharer(event->getSrc());
+                entry->addSharer(event->getSrcID());
                 mshr->setData(addr, event->getPayload(), event->getDirty());
                 event->setEvict(false);
                 entry->setState(S_Inv);
@@ -1116,11 +1224,11 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                entry->addSharer(event->getSrc());
+                entry->addSharer(event->getSrcID());
                 mshr->setData(addr, event->getPayload(), event->getDirty());
                 entry->setState(S);
                 mshr->decrementAcksNeeded(addr);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 retryBuffer.push_back(static_cast<MemEvent*>(mshr->getFrontEvent(addr)));
             }
@@ -1147,6 +1255,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     State state = entry->getState();
     bool cached = entry->isCached();
     MemEventStatus status = MemEventStatus::OK;
+    bool dirEvict = isSparseEviction(event);
 
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::FlushLineInv, false, addr, state);
@@ -1167,19 +1276,26 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
 
     switch (state) {
         case I:
-            if (status == MemEventStatus::OK)
-                issueFlush(event);
+            if (status == MemEventStatus::OK) {
+                if (dirEvict)
+                    finishSparseEviction(event);
+                else
+                    issueFlush(event);
+            }
             break;
         case S:
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
-                    entry->removeSharer(event->getSrc());
+                    entry->removeSharer(event->getSrcID());
                     event->setEvict(false);
                 }
 
                 if (entry->hasSharers()) {
                     entry->setState(S_Inv);
                     issueInvalidations(event, entry, Command::Inv);
+                } else if (dirEvict) {
+                    entry->setState(I);
+                    finishSparseEviction(event);
                 } else {
                     entry->setState(I_B);
                     issueFlush(event);
@@ -1197,6 +1313,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                 if (entry->hasOwner()) {
                     entry->setState(M_Inv);
                     issueFetch(event, entry, Command::FetchInv);
+                } else if (dirEvict) {
+                    entry->setState(I);
+                    finishSparseEviction(event);
                 } else {
                     entry->setState(I_B);
                     issueFlush(event);
@@ -1205,7 +1324,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_D:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(event->getSrcID());
                 event->setEvict(false);
                 if (!entry->hasSharers())
                     entry->setState(IS);
@@ -1213,7 +1332,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_B:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(event->getSrcID());
                 event->setEvict(false);
                 if (!entry->hasSharers())
                     entry->setState(I);
@@ -1224,7 +1343,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                 entry->removeOwner();
                 mshr->setData(addr, event->getPayload(), event->getDirty());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
 
                 if (mshr->decrementAcksNeeded(addr)) {
@@ -1235,9 +1354,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case SD_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(event->getSrcID());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->hasSharers() ? entry->setState(S_D) : entry->setState(IS);
@@ -1247,9 +1366,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case SM_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(event->getSrcID());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->setState(IM);
@@ -1258,9 +1377,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(event->getSrcID());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->hasSharers() ? entry->setState(S) : entry->setState(I);
@@ -1270,9 +1389,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case M_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(event->getSrcID());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->setState(I);
@@ -1317,11 +1436,11 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
     if (!inMSHR)
         stat_cacheHits->addData(1);
 
-    entry->removeSharer(event->getSrc());
+    entry->removeSharer(event->getSrcID());
     sendAckPut(event);
 
-    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-        responses.find(addr)->second.erase(event->getSrc());
+    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcID()) != responses.find(addr)->second.end()) {
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty()) responses.erase(addr);
     }
 
@@ -1400,7 +1519,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
         stat_cacheHits->addData(1);
 
     entry->removeOwner();
-    entry->addSharer(event->getSrc());
+    entry->addSharer(event->getSrcID());
 
     sendAckPut(event);
 
@@ -1419,7 +1538,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
             break;
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             mshr->setData(addr, event->getPayload(), event->getDirty());
             entry->setState(S);
@@ -1474,7 +1593,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
         case M_Inv:
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             mshr->setData(addr, event->getPayload(), event->getDirty());
             entry->setState(I);
@@ -1530,7 +1649,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
         case M_Inv:
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             mshr->setData(addr, event->getPayload(), event->getDirty());
             entry->setState(I);
@@ -1790,7 +1909,7 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
     }
     if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
         entry->setState(S);
-        entry->addSharer(reqEv->getSrc());
+        entry->addSharer(reqEv->getSrcID());
     } else if (state == IS) {
         entry->setState(I);
     } else {
@@ -1827,14 +1946,14 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
                 break;
             } else if (protocol == CoherenceProtocol::MESI) {
                 entry->setState(M);
-                entry->setOwner(reqEv->getSrc());
+                entry->setOwner(reqEv->getSrcID());
                 sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
                 break;
             }
         case S_D:
             entry->setState(S);
             if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
-                entry->addSharer(reqEv->getSrc());
+                entry->addSharer(reqEv->getSrcID());
             }
             sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
             mshr->setData(addr, event->getPayload(), false); // So subsequent GetS can get data
@@ -1842,7 +1961,7 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
         case IM:
             if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
                 entry->setState(M);
-                entry->setOwner(reqEv->getSrc());
+                entry->setOwner(reqEv->getSrcID());
             } else {
                 entry->setState(I);
             }
@@ -1960,13 +2079,13 @@ bool DirectoryController::handleAckInv(MemEvent* event, bool inMSHR) {
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
 
-    if (entry->isSharer(event->getSrc()))
-        entry->removeSharer(event->getSrc());
+    if (entry->isSharer(event->getSrcID()))
+        entry->removeSharer(event->getSrcID());
     else
         entry->removeOwner();
 
     bool done = mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     if (!done) {
@@ -2021,13 +2140,13 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
                 getName().c_str(), StateString[state], event->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
 
     mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
 
     entry->removeOwner();
-    entry->addSharer(event->getSrc());
+    entry->addSharer(event->getSrcID());
     entry->setState(S);
     retryBuffer.push_back(static_cast<MemEvent*>(mshr->getFrontEvent(addr)));
 
@@ -2056,7 +2175,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
     MemEvent * reqEv = static_cast<MemEvent*>(mshr->getFrontEvent(addr));
 
     mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty())
         responses.erase(addr);
     mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
@@ -2104,8 +2223,8 @@ bool DirectoryController::handleNACK(MemEvent* event, bool inMSHR) {
         case Command::ForceInv:
             // Only retry if we still need the response)
             if (responses.find(addr) != responses.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst()) != responses.find(addr)->second.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst())->second == nackedEvent->getID())
+                    && responses.find(addr)->second.find(nackedEvent->getDstID()) != responses.find(addr)->second.end()
+                    && responses.find(addr)->second.find(nackedEvent->getDstID())->second == nackedEvent->getID())
                 break;
             delete nackedEvent;
             return true;
@@ -2167,10 +2286,21 @@ bool DirectoryController::handleDirEntryResponse(MemEvent* event) {
  * Manage data structures
  ****************************/
 DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr addr) {
+    if (sparseDir) {
+        DirEntry* entry = sparseDir->find(addr);
+        if (!entry) {
+            if (!allocateSparseEntry(addr))
+                dbg.fatal(CALL_INFO, -1, "%s, Error: No sparse directory entry available for 0x%" PRIx64 ". Time: %" PRIu64 "ns\n",
+                        getName().c_str(), addr, getCurrentSimTimeNano());
+            entry = sparseDir->find(addr);
+        }
+        return entry;
+    }
+
     std::unordered_map<Addr,DirEntry*>::iterator i = directory.find(addr);
 
     if (directory.end() == i) {
-        directory[addr] = new DirEntry(addr);
+        directory[addr] = new DirEntry(addr, &sharerIndex);
         i = directory.find(addr);
         i->second->cacheIter = entryCache.end();
         i->second->setCached(true);
@@ -2206,7 +2336,7 @@ bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, boo
                     getName().c_str(), StateString[state], entry->getBaseAddr(), getCurrentSimTimeNano());
     }
 
-    MemEvent* me = new MemEvent(getName(), 0, 0, Command::GetS, lineSize);
+    MemEvent* me = new MemEvent(nameID, 0, 0, Command::GetS, lineSize);
     me->setAddrGlobal(false);
     me->setSize(entrySize);
     dirMemAccesses.insert(std::make_pair(me->getID(), event->getBaseAddr()));
@@ -2276,7 +2406,70 @@ void DirectoryController::cleanUpAfterResponse(MemEvent * event, bool inMSHR) {
     }
 }
 
+/*
+ * Give addr an entry in the sparse directory. An entry in state I with nothing in the MSHR can be
+ * reused right away. Otherwise, if the set is full, start evicting the least recently used stable
+ * entry by invalidating it like a FlushLineInv would and return false; the caller retries once the
+ * eviction is done.
+ */
+bool DirectoryController::allocateSparseEntry(Addr addr) {
+    DirEntry* entry = sparseDir->allocate(addr, [this](DirEntry& e) {
+            return e.getState() == I && !mshr->exists(e.getBaseAddr()); });
+    if (entry) {
+        entry->reset(addr);
+        return true;
+    }
+
+    // One eviction per set at a time
+    if (sparseDir->anyInSet(addr, [this](DirEntry& e) { return sparseEvictions.find(e.getBaseAddr()) != sparseEvictions.end(); }))
+        return false;
+
+    DirEntry* victim = sparseDir->findVictim(addr, [this](DirEntry& e) {
+            return (e.getState() == S || e.getState() == M) && !mshr->exists(e.getBaseAddr()); });
+    if (!victim) // Every line in the set is busy
+        return false;
+
+    Addr victimAddr = victim->getBaseAddr();
+    MemEvent* evict = new MemEvent(nameID, victimAddr, victimAddr, Command::FlushLineInv, lineSize);
+    if (allocateMSHR(evict, false) != MemEventStatus::OK) {
+        delete evict;
+        return false;
+    }
+
+    sparseEvictions.insert(std::make_pair(victimAddr, evict->getID()));
+    stat_dirEvictions->addData(1);
+    if (profiler)
+        profiler->record(RegionEvent::Evict, victimAddr, 0);
+    retryBuffer.push_back(evict);
+    return false;
+}
+
+bool DirectoryController::isSparseEviction(MemEvent* event) {
+    if (!sparseDir)
+        return false;
+    std::unordered_map<Addr, MemEvent::id_type>::iterator it = sparseEvictions.find(event->getBaseAddr());
+    return it != sparseEvictions.end() && it->second == event->getID();
+}
+
+/* The evicted line has been invalidated everywhere. Write back any dirty data and free the MSHR */
+void DirectoryController::finishSparseEviction(MemEvent* event) {
+    Addr addr = event->getBaseAddr();
+    if (mshr->hasData(addr) && mshr->getDataDirty(addr))
+        writebackDataFromMSHR(addr);
+
+    if (is_debug_event(event)) {
+        eventDI.action = "Done";
+        eventDI.reason = "dir evict";
+    }
+
+    sparseEvictions.erase(addr);
+    cleanUpAfterRequest(event, true);
+}
+
 void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a proper cache!
+    if (sparseDir) // Entries stay in the sparse directory and are reused once they reach I
+        return;
+
     if (0 == entryCacheMaxSize) {
         sendEntryToMemory(entry);
     } else {
@@ -2312,12 +2505,12 @@ void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a
 
 void DirectoryController::sendEntryToMemory(DirEntry *entry) {
     Addr entryAddr = 0;
-    MemEvent * me = new MemEvent(getName(), entryAddr, entryAddr, Command::PutE, lineSize);
+    MemEvent * me = new MemEvent(nameID, entryAddr, entryAddr, Command::PutE, lineSize);
     me->setSize(entrySize);
     me->setFlag(MemEventBase::F_NORESPONSE);
 
     uint64_t deliveryTime = timestamp + accessLatency;
-    me->setDst(memLink->getTargetDestination(0));
+    me->setDstID(memLink->getTargetDestinationID(0));
     memMsgQueue.insert(std::make_pair(deliveryTime, MemMsg(me, true)));
 }
 
@@ -2327,7 +2520,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry) {
 
 void DirectoryController::issueMemoryRequest(MemEvent* event, DirEntry* entry, bool lineGranularity) {
     MemEvent* reqEvent = new MemEvent(*event);
-    reqEvent->setSrc(getName());
+    reqEvent->setSrcID(nameID);
     if (lineGranularity)
         reqEvent->setSize(lineSize);
     uint64_t deliveryTime = timestamp + accessLatency;
@@ -2335,12 +2528,15 @@ void DirectoryController::issueMemoryRequest(MemEvent* event, DirEntry* entry, b
     forwardByAddress(reqEvent, deliveryTime);
 
     mshr->setInProgress(entry->getBaseAddr());
+
+    if (profiler)
+        profiler->record(RegionEvent::Miss, entry->getBaseAddr(), 0);
 }
 
 void DirectoryController::issueFlush(MemEvent* event) {
     Addr addr = event->getBaseAddr();
     MemEvent * flush = new MemEvent(*event);
-    flush->setSrc(getName());
+    flush->setSrcID(nameID);
 
     if (mshr->hasData(addr) && mshr->getDataDirty(addr)) { // also writeback dirty data
         flush->setEvict(true);
@@ -2359,11 +2555,11 @@ void DirectoryController::issueFlush(MemEvent* event) {
 
 void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command cmd) {
     Addr addr = event->getBaseAddr();
-    MemEvent * fetch = new MemEvent(getName(), event->getAddr(), addr, cmd, lineSize);
-    fetch->setDst(entry->getOwner());
+    MemEvent * fetch = new MemEvent(nameID, event->getAddr(), addr, cmd, lineSize);
+    fetch->setDstID(entry->getOwner());
 
     if (responses.find(addr) == responses.end()) {
-        std::map<std::string,MemEvent::id_type> resp;
+        std::map<EndpointID,MemEvent::id_type> resp;
         resp.insert(std::make_pair(entry->getOwner(), fetch->getID()));
         responses.insert(std::make_pair(addr, resp));
     } else {
@@ -2376,28 +2572,31 @@ void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command c
 }
 
 void DirectoryController::issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd) {
-    std::string rqstr = (event->getSrc());
+    EndpointID rqstr = event->getSrcID();
 
-    for (set<std::string>::iterator it = entry->getSharers()->begin(); it != entry->getSharers()->end(); it++) {
-        if (*it == rqstr) continue;
-        issueInvalidation(*it, event, entry, cmd);
-    }
+    entry->forEachSharer([&](EndpointID sharer) {
+        if (sharer != rqstr)
+            issueInvalidation(sharer, event, entry, cmd);
+    });
 }
 
-void DirectoryController::issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd) {
+void DirectoryController::issueInvalidation(EndpointID dst, MemEvent* event, DirEntry* entry, Command cmd) {
     Addr addr = entry->getBaseAddr();
-    MemEvent* inv = new MemEvent(getName(), addr, addr, cmd, lineSize);
+    MemEvent* inv = new MemEvent(nameID, addr, addr, cmd, lineSize);
     if (event) {
         inv->copyMetadata(event);
     } else {
-        inv->setRqstr(getName());
+        inv->setRqstrID(nameID);
     }
-    inv->setDst(dst);
+    inv->setDstID(dst);
 
     mshr->incrementAcksNeeded(addr);
 
+    if (profiler)
+        profiler->record(RegionEvent::Inv, addr, 0);
+
     if (responses.find(addr) == responses.end()) {
-        std::map<std::string,MemEvent::id_type> resp;
+        std::map<EndpointID,MemEvent::id_type> resp;
         resp.insert(std::make_pair(entry->getOwner(), inv->getID()));
         responses.insert(std::make_pair(addr, resp));
     } else {
@@ -2425,7 +2624,7 @@ void DirectoryController::sendResponse(MemEvent* event, uint32_t flags, uint32_t
 }
 
 void DirectoryController::writebackData(MemEvent* event) {
-    MemEvent * wb = new MemEvent(getName(), event->getBaseAddr(), event->getBaseAddr(), Command::PutM, lineSize);
+    MemEvent * wb = new MemEvent(nameID, event->getBaseAddr(), event->getBaseAddr(), Command::PutM, lineSize);
     wb->copyMetadata(event);
     wb->setPayload(event->getPayload());
     wb->setDirty(event->getDirty());
@@ -2438,7 +2637,7 @@ void DirectoryController::writebackData(MemEvent* event) {
 }
 
 void DirectoryController::writebackDataFromMSHR(Addr addr) {
-    MemEvent * wb = new MemEvent(getName(), addr, addr, Command::PutM, lineSize);
+    MemEvent * wb = new MemEvent(nameID, addr, addr, Command::PutM, lineSize);
     wb->setPayload(mshr->getData(addr));
     wb->setDirty(mshr->getDataDirty(addr));
     mshr->setDataDirty(addr, false);
@@ -2492,7 +2691,7 @@ void DirectoryController::sendNACK(MemEvent * event) {
 void DirectoryController::sendOutgoingEvents() {
 
     bool debugLine = false;
-    while (!cpuMsgQueue.empty() && cpuMsgQueue.begin()->first <= timestamp) {
+    while (!cpuMsgQueue.empty() && (warmup.active() || cpuMsgQueue.begin()->first <= timestamp)) {
         MemEventBase * ev = cpuMsgQueue.begin()->second;
 
         if (is_debug_event(ev)) {
@@ -2507,11 +2706,12 @@ void DirectoryController::sendOutgoingEvents() {
             startTimes.erase(ev->getResponseToID());
         }
         stat_eventSent[(int)ev->getCmd()]->addData(1);
+        MEMH_TRACE_MARK(ev, Access, getCurrentSimCycle());
         cpuLink->send(ev);
         cpuMsgQueue.erase(cpuMsgQueue.begin());
     }
 
-    while (!memMsgQueue.empty() && memMsgQueue.begin()->first <= timestamp) {
+    while (!memMsgQueue.empty() && (warmup.active() || memMsgQueue.begin()->first <= timestamp)) {
         MemEventBase * ev = memMsgQueue.begin()->second.event;
 
         if (is_debug_event(ev)) {
@@ -2527,6 +2727,7 @@ void DirectoryController::sendOutgoingEvents() {
         } else {
             stat_eventSent[(int)ev->getCmd()]->addData(1);
         }
+        MEMH_TRACE_MARK(ev, Access, getCurrentSimCycle());
         memLink->send(ev);
         memMsgQueue.erase(memMsgQueue.begin());
     }
@@ -2537,14 +2738,14 @@ void DirectoryController::sendOutgoingEvents() {
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool dirAccess) {
-    std::string dst = memLink->findTargetDestination(ev->getRoutingAddress());
-    if (dst != "") { /* Common case */
-        ev->setDst(dst);
+    EndpointID dst = memLink->findTargetDestinationID(ev->getRoutingAddress());
+    if (dst != EndpointRegistry::NO_ENDPOINT) { /* Common case */
+        ev->setDstID(dst);
         memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
     } else {
-        dst = cpuLink->findTargetDestination(ev->getRoutingAddress());
-        if (dst != "") {
-            ev->setDst(dst);
+        dst = cpuLink->findTargetDestinationID(ev->getRoutingAddress());
+        if (dst != EndpointRegistry::NO_ENDPOINT) {
+            ev->setDstID(dst);
             cpuMsgQueue.insert(std::make_pair(ts, ev));
         } else {
             std::string availableDests = "cpulink:\n" + cpuLink->getAvailableDestinationsAsString();
@@ -2559,9 +2760,9 @@ void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool d
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByDestination(MemEventBase* ev, Cycle_t ts, bool dirAccess) {
-    if (cpuLink->isReachable(ev->getDst())) {
+    if (cpuLink->isReachable(ev->getDstID())) {
         cpuMsgQueue.insert(std::make_pair(ts, ev));
-    } else if (memLink->isReachable(ev->getDst())) {
+    } else if (memLink->isReachable(ev->getDstID())) {
         memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
     } else {
         out.fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
@@ -37,6 +37,9 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/directoryArray.h"
+#include "sst/elements/memHierarchy/regionProfiler.h"
+#include "sst/elements/memHierarchy/warmup.h"
 
 using namespace std;
 
@@ -51,6 +54,8 @@ public:
     SST_ELI_DOCUMENT_PARAMS(
             {"clock",                   "Clock rate of controller.", "1GHz"},
             {"entry_cache_size",        "Size (in # of entries) the controller will cache.", "0"},
+            {"sparse_entries",          "If nonzero, track lines in a sparse directory with this many entries instead of a full directory backed by memory. Evicting an entry invalidates the line in the caches above. 'entry_cache_size' is ignored.", "0"},
+            {"sparse_associativity",    "Associativity of the sparse directory. 'sparse_entries' must be a multiple of it.", "8"},
             {"debug",                   "Where to send debug output. 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},
             {"debug_level",             "Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
             {"debug_addr",              "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""},
@@ -68,6 +73,8 @@ public:
             {"interleave_size",         "Size of interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"interleave_step",         "Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"node",					"Node number in multinode environment"},
+            {"warmup_time",             "Run functionally (no clock, latency, or bandwidth limits) until this simulated time, then switch to timing. Specify in s (SI prefixes ok). '0ns' for no time limit. Statistics include warm-up traffic unless enabled with a 'startat' time.", "0ns"},
+            {"warmup_signal_addr",      "If set, run functionally until a request to this address arrives. Use a noncacheable access so that all levels see it.", ""},
             /* Old parameters - deprecated or moved */
             {"network_num_vc",          "DEPRECATED. Number of virtual channels (VCs) on the on-chip network. memHierarchy only uses one VC.", "1"}, // Remove SST 9.0
             {"network_address",         "DEPRECATD - Now auto-detected by link control", ""},   // Remove SST 9.0
@@ -87,6 +94,7 @@ public:
             {"get_request_latency",         "Total latency in ns of all get* requests handled",                 "nanoseconds",  1},
             {"directory_cache_hits",        "Number of requests that hit in the directory cache",               "requests",     1},
             {"mshr_hits",                   "Number of requests that hit in the MSHRs",                         "requests",     1},
+            {"directory_evictions",         "Number of sparse directory entries evicted to make room for another line", "count", 1},
             /* Event received */
             {"GetS_recv",           "Event received: GetS (read-shared)", "count", 1},
             {"GetX_recv",           "Event received: GetX (write-exclusive)", "count", 1},
@@ -143,7 +151,8 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"cpulink", "CPU-side link manager, for single-link directories, use this one only", "SST::MemHierarchy::MemLinkBase"},
-            {"memlink", "Memory-side link manager", "SST::MemHierarchy::MemLinkBase"} )
+            {"memlink", "Memory-side link manager", "SST::MemHierarchy::MemLinkBase"},
+            {"profiler", "Optional profiler that records requests, memory fetches, directory evictions, and invalidations by address region", "SST::MemHierarchy::RegionProfiler"} )
 
 /* Begin class definition */
 private:
@@ -161,6 +170,9 @@ private:
     uint64_t    timestamp;
     int         maxRequestsPerCycle;
 
+    /* Functional warm-up */
+    Warmup      warmup;
+
     /* Turn clocks off when idle */
     bool        clockOn;
     Clock::Handler<DirectoryController>*  clockHandler;
@@ -168,7 +180,6 @@ private:
     SimTime_t   lastActiveClockCycle;
 
     std::map<SST::Event::id_type, uint64_t> startTimes;
-
     /* Statistics counters for profiling DC */
     Statistic<uint64_t> * stat_replacementRequestLatency;   // totalReplProcessTime
     Statistic<uint64_t> * stat_getRequestLatency;           // totalGetReqProcessTime;
@@ -181,6 +192,7 @@ private:
     Statistic<uint64_t> * stat_eventSent[(int)Command::LAST_CMD];
     Statistic<uint64_t> * stat_dirEntryReads;
     Statistic<uint64_t> * stat_dirEntryWrites;
+    Statistic<uint64_t> * stat_dirEvictions;
 
     Statistic<uint64_t> * stat_MSHROccupancy;
 
@@ -202,6 +214,9 @@ private:
 
     void turnClockOn();
 
+    void processWarmup();
+    void endWarmup();
+
     bool arbitrateAccess(Addr addr);
 
     inline void recordStartLatency(MemEventBase* ev);
@@ -296,35 +311,41 @@ private:
         Addr                addr;           // block address
         State               state;          // state
         std::list<DirEntry*>::iterator cacheIter;
-	std::set<std::string> sharers;      // set of sharers for block
-        std::string         owner;          // Owner of block
+	SharerSet           sharers;        // set of sharers for block, by index in sharerIndex
+        EndpointIndex*      sharerIndex;    // Directory's numbering of its sharers
+        EndpointID          owner;          // Owner of block
 
-        DirEntry(Addr a) {
+        DirEntry(Addr a, EndpointIndex* index) {
+            sharerIndex = index;
             clearEntry();
             addr = a;
             state = I;
             cached = false;
         }
 
+        /* Reuse a sparse directory entry for a new block */
+        void reset(Addr a) {
+            clearEntry();
+            addr = a;
+            state = I;
+        }
+
         void clearEntry(){
             cached = true;
             addr = 0;
             sharers.clear();
-            owner = "";
+            owner = EndpointRegistry::NO_ENDPOINT;
         }
 
         std::string getString() {
             std::ostringstream str;
             str << "State: " << StateString[state];
             str << " Sharers: [";
-            bool comma = false;
-            for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
-                if (comma)
-                    str << ",";
-                str << *it;
-                comma = true;
-            }
-            str << "] Owner: " << owner;
+            bool first = true;
+            forEachSharer([&](EndpointID shr) {
+                    str << (first ? "" : ",") << EndpointRegistry::getName(shr);
+                    first = false; });
+            str << "] Owner: " << EndpointRegistry::getName(owner);
             str << " Cached: " << (cached ? "y" : "n");
             return str.str();
         }
@@ -339,23 +360,45 @@ private:
 
         void clearSharers() { sharers.clear(); }
 
-        void addSharer(std::string shr) { sharers.insert(shr); }
+        void addSharer(EndpointID shr) { sharers.insert(sharerIndex->get(shr)); }
 
-        bool isSharer(std::string shr) { return sharers.find(shr) != sharers.end(); }
+        bool isSharer(EndpointID shr) {
+            uint32_t index = sharerIndex->find(shr);
+            return index != EndpointIndex::NO_INDEX && sharers.contains(index);
+        }
 
         bool hasSharers() { return !(sharers.empty()); }
 
-        std::set<std::string>* getSharers() { return &sharers; }
+        /* Visit sharers in order of name so that the order does not depend on event arrival order. Invalidations are sent in this order */
+        template <typename F>
+        void forEachSharer(F f) {
+            if (sharers.size() == 1) {
+                f(sharerIndex->getID(*sharers.begin()));
+                return;
+            }
+            std::vector<EndpointID> sorted;
+            sorted.reserve(sharers.size());
+            for (uint32_t index : sharers)
+                sorted.push_back(sharerIndex->getID(index));
+            std::sort(sorted.begin(), sorted.end(), [](EndpointID a, EndpointID b) {
+                    return EndpointRegistry::getName(a) < EndpointRegistry::getName(b); });
+            for (EndpointID id : sorted)
+                f(id);
+        }
 
-        void removeSharer(std::string shr) { sharers.erase(shr); }
+        void removeSharer(EndpointID shr) {
+            uint32_t index = sharerIndex->find(shr);
+            if (index != EndpointIndex::NO_INDEX)
+                sharers.erase(index);
+        }
 
-        std::string getOwner() { return owner; }
+        EndpointID getOwner() { return owner; }
 
-        bool hasOwner() { return owner != ""; }
+        bool hasOwner() { return owner != EndpointRegistry::NO_ENDPOINT; }
 
-        void removeOwner() { owner = ""; }
+        void removeOwner() { owner = EndpointRegistry::NO_ENDPOINT; }
 
-        void setOwner(std::string own) { owner = own; }
+        void setOwner(EndpointID own) { owner = own; }
 
         void setState(State nState) { state = nState; }
 
@@ -373,6 +416,10 @@ private:
     void cleanUpAfterRequest(MemEvent* event, bool inMSHR);
     void cleanUpAfterResponse(MemEvent* event, bool inMSHR);
 
+    bool allocateSparseEntry(Addr addr); // Find room in the sparse directory, evicting an entry if needed
+    bool isSparseEviction(MemEvent* event);
+    void finishSparseEviction(MemEvent* event);
+
     void updateCache(DirEntry * entry);
     void sendEntryToMemory(DirEntry* entry);
 
@@ -380,7 +427,7 @@ private:
     void issueFlush(MemEvent* event);
     void issueFetch(MemEvent* event, DirEntry* entry, Command cmd);
     void issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd);
-    void issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd);
+    void issueInvalidation(EndpointID dst, MemEvent* event, DirEntry* entry, Command cmd);
     void sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags = 0);
     void sendResponse(MemEvent* event, uint32_t flags = 0, uint32_t memflags = 0);
     void writebackData(MemEvent* event);
@@ -392,6 +439,13 @@ private:
     
     MSHR * mshr;
     std::unordered_map<Addr, DirEntry*> directory; // Master list of all directory entries, including noncached ones
+    EndpointIndex sharerIndex;
+
+    /* Sparse directory, replaces 'directory' if enabled */
+    SparseDirectoryArray<DirEntry>* sparseDir;
+
+    RegionProfiler* profiler;   // Null if not enabled
+    std::unordered_map<Addr, MemEvent::id_type> sparseEvictions; // Lines being evicted from sparseDir -> ID of the eviction
 
 
     struct MemMsg {
@@ -416,11 +470,12 @@ private:
     std::list<DirEntry*> entryCache;
 
     uint64_t lineSize;
+    EndpointID nameID;  // Interned getName()
 
     uint64_t accessLatency;
     uint64_t mshrLatency;
 
-    std::map<Addr, std::map<std::string, MemEvent::id_type> > responses;
+    std::map<Addr, std::map<EndpointID, MemEvent::id_type> > responses;
     
     std::map<MemEvent::id_type, Addr> dirMemAccesses;
     
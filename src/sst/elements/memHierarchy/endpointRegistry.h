@@ -0,0 +1,286 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ENDPOINTREGISTRY_H
+#define MEMHIERARCHY_ENDPOINTREGISTRY_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+
+#include <sst/core/output.h>
+#include <sst/core/serialization/serializer.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Compact integer handle for a memHierarchy endpoint name (a component's getName()).
+ * Events, coherence state, and network address maps carry EndpointIDs instead of
+ * strings so that copying and comparing an endpoint is a single word operation.
+ * Strings are only looked up for debug output and for serialization.
+ */
+typedef uint32_t EndpointID;
+
+/*
+ * Process-wide name <-> ID table
+ *
+ * IDs are assigned in the order names are first seen and are only meaningful within
+ * a single process, so anything that crosses a rank boundary must be serialized by name
+ * (see serializeEndpoint() below).
+ *
+ * Names are stored in fixed-size chunks that are never moved once allocated so that
+ * getName() does not need to take the lock. An ID is only ever handed out after its name
+ * has been written.
+ */
+class EndpointRegistry {
+public:
+    static constexpr EndpointID NO_ENDPOINT = 0;    // The empty name, ""
+    static constexpr EndpointID NONE_ENDPOINT = 1;  // The default name for events, NONE ("None")
+
+    /* Return the ID for 'name', assigning a new one if this is the first time it has been seen */
+    static EndpointID intern(const std::string& name) {
+        Table& table = getTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return table.insert(name);
+    }
+
+    /* Return the name associated with 'id' */
+    static const std::string& getName(EndpointID id) {
+        return getTable().chunks[id >> chunkBits][id & chunkMask];
+    }
+
+    /* Total number of IDs assigned so far */
+    static size_t size() {
+        Table& table = getTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return table.count;
+    }
+
+private:
+    static constexpr uint32_t chunkBits = 10;
+    static constexpr uint32_t chunkSize = 1 << chunkBits;
+    static constexpr uint32_t chunkMask = chunkSize - 1;
+    static constexpr uint32_t maxChunks = 4096;
+
+    struct Table {
+        std::mutex mutex;
+        std::unordered_map<std::string, EndpointID> ids;
+        std::unique_ptr<std::string[]> chunks[maxChunks];
+        uint32_t count;
+
+        Table() : count(0) {
+            insert("");
+            insert(NONE);
+        }
+
+        EndpointID insert(const std::string& name) {
+            auto it = ids.find(name);
+            if (it != ids.end())
+                return it->second;
+
+            EndpointID id = count;
+            uint32_t chunk = id >> chunkBits;
+            if (chunk == maxChunks)
+                Output::getDefaultObject().fatal(CALL_INFO, -1, "EndpointRegistry, Error: exceeded the maximum number of endpoint names (%" PRIu32 ") while adding '%s'\n",
+                        maxChunks * chunkSize, name.c_str());
+            if (!chunks[chunk])
+                chunks[chunk].reset(new std::string[chunkSize]);
+            chunks[chunk][id & chunkMask] = name;
+            ids.insert(std::make_pair(name, id));
+            count++;
+            return id;
+        }
+    };
+
+    static Table& getTable() {
+        static Table table;
+        return table;
+    }
+};
+
+/* Serialize an EndpointID by name so that it is valid on the receiving rank */
+inline void serializeEndpoint(SST::Core::Serialization::serializer &ser, EndpointID &id) {
+    std::string name;
+    if (ser.mode() != SST::Core::Serialization::serializer::UNPACK)
+        name = EndpointRegistry::getName(id);
+    ser & name;
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+        id = EndpointRegistry::intern(name);
+}
+
+/*
+ * Set of endpoints stored as a bit-vector indexed by EndpointID
+ * Used for sharer tracking in the coherence protocols
+ */
+class SharerSet {
+public:
+    SharerSet() : count_(0) { }
+
+    class iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef EndpointID value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const EndpointID* pointer;
+        typedef EndpointID reference;
+
+        iterator(const std::vector<uint64_t>* words, size_t index) : words_(words), index_(index) { advance(); }
+
+        EndpointID operator*() const { return index_; }
+        iterator& operator++() { index_++; advance(); return *this; }
+        bool operator==(const iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const iterator& other) const { return index_ != other.index_; }
+
+    private:
+        /* Move index_ forward to the next set bit, or to the end */
+        void advance() {
+            size_t end = words_->size() * 64;
+            while (index_ < end) {
+                uint64_t word = (*words_)[index_ >> 6] >> (index_ & 63);
+                if (word) {
+                    index_ += __builtin_ctzll(word);
+                    return;
+                }
+                index_ = (index_ | 63) + 1;
+            }
+            index_ = end;
+        }
+
+        const std::vector<uint64_t>* words_;
+        size_t index_;
+    };
+
+    iterator begin() const { return iterator(&words_, 0); }
+    iterator end() const { return iterator(&words_, words_.size() * 64); }
+
+    bool contains(EndpointID id) const {
+        size_t word = id >> 6;
+        return word < words_.size() && (words_[word] & (1ULL << (id & 63)));
+    }
+
+    void insert(EndpointID id) {
+        size_t word = id >> 6;
+        if (word >= words_.size())
+            words_.resize(word + 1, 0);
+        uint64_t bit = 1ULL << (id & 63);
+        if (!(words_[word] & bit)) {
+            words_[word] |= bit;
+            count_++;
+        }
+    }
+
+    void erase(EndpointID id) {
+        size_t word = id >> 6;
+        if (word >= words_.size())
+            return;
+        uint64_t bit = 1ULL << (id & 63);
+        if (words_[word] & bit) {
+            words_[word] &= ~bit;
+            count_--;
+        }
+    }
+
+    /* Keep the storage so that a recycled line does not need to reallocate */
+    void clear() {
+        std::fill(words_.begin(), words_.end(), 0);
+        count_ = 0;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /*
+     * Members in order of name rather than ID. Used wherever the order that events are sent to
+     * sharers matters: IDs follow the order names were first interned, which depends on component
+     * construction order and on partitioning, while names give the same order on every run.
+     */
+    std::vector<EndpointID> sortedByName() const {
+        std::vector<EndpointID> sorted(begin(), end());
+        if (sorted.size() > 1)
+            std::sort(sorted.begin(), sorted.end(), [](EndpointID a, EndpointID b) {
+                    return EndpointRegistry::getName(a) < EndpointRegistry::getName(b); });
+        return sorted;
+    }
+
+    /* Member with the lowest name, or NO_ENDPOINT if empty */
+    EndpointID firstByName() const {
+        EndpointID first = EndpointRegistry::NO_ENDPOINT;
+        for (EndpointID id : *this) {
+            if (first == EndpointRegistry::NO_ENDPOINT || EndpointRegistry::getName(id) < EndpointRegistry::getName(first))
+                first = id;
+        }
+        return first;
+    }
+
+    /* Comma-separated names, in name order */
+    std::string toString() const {
+        std::string str;
+        for (EndpointID id : sortedByName()) {
+            if (!str.empty()) str += ",";
+            str += EndpointRegistry::getName(id);
+        }
+        return str;
+    }
+
+private:
+    std::vector<uint64_t> words_;
+    size_t count_;
+};
+
+/*
+ * Dense, component-local numbering of endpoints
+ * A SharerSet indexed by EndpointID is as wide as the largest ID in the whole system.
+ * Indexing it by an EndpointIndex instead sizes the vector by the number of peers
+ * the component has actually seen, which is fixed once the system warms up.
+ */
+class EndpointIndex {
+public:
+    static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+    /* Local index for 'id', assigning the next one if this is the first time it has been seen */
+    uint32_t get(EndpointID id) {
+        if (id >= local_.size())
+            local_.resize(id + 1, NO_INDEX);
+        if (local_[id] == NO_INDEX) {
+            local_[id] = ids_.size();
+            ids_.push_back(id);
+        }
+        return local_[id];
+    }
+
+    /* Local index for 'id' or NO_INDEX if it has not been seen */
+    uint32_t find(EndpointID id) const {
+        return id < local_.size() ? local_[id] : NO_INDEX;
+    }
+
+    EndpointID getID(uint32_t index) const { return ids_[index]; }
+
+    size_t size() const { return ids_.size(); }
+
+private:
+    std::vector<uint32_t> local_;   /* EndpointID -> local index */
+    std::vector<EndpointID> ids_;   /* local index -> EndpointID */
+};
+
+}}
+
+#endif /* MEMHIERARCHY_ENDPOINTREGISTRY_H */
@@ -0,0 +1,185 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_LATENCYTRACE_H
+#define MEMHIERARCHY_LATENCYTRACE_H
+
+/*
+ * Per-request latency breakdown
+ *
+ * Stamps are compiled in only when MEMH_LATENCY_TRACE is defined (e.g., configure with
+ * CXXFLAGS="-DMEMH_LATENCY_TRACE"). Otherwise the macro at the bottom expands to nothing.
+ * The classes here are always defined and traces live in a side table rather than in the
+ * events, so the flag does not change the layout of any event or component class.
+ *
+ * A StandardInterface with 'latency_trace' set starts a trace on one request in every
+ * 'latency_trace_period'. The trace is keyed by the request's event ID. Copies of the request
+ * keep that ID and responses name it as their response-to ID, so every event on the request's
+ * path finds the same trace. Each component that handles one charges the time since the
+ * previous stamp to a stage:
+ *  Link      arrival over a point-to-point MemLink
+ *  Network   arrival over a MemNIC
+ *  Wait      waiting in a cache or directory before being handled (event buffer, MSHR, retries)
+ *  Access    from being handled until the resulting event is sent (tag/directory lookup, bandwidth)
+ *  Memory    memory controller and backend
+ * so the stages sum to the request's end-to-end latency.
+ *
+ * The table is per thread. Time a request spends on another thread or rank is charged to the
+ * first stage stamped after it returns.
+ *
+ * The interface writes a binary file, summarized by tools/latencyReport.py:
+ *  header:   { char magic[4] = "MHLT"; uint32 version = 1; uint32 stage_count; uint32 command_count; double ps_per_tick; }
+ *  commands: command_count NUL-terminated command names, indexed by the rows' command field
+ *  rows:     { uint64 command; uint64 total; uint64 stages[stage_count]; }, in ticks of the core time base
+ * all in host byte order.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <sst/core/event.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/slotTable.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+class LatencyTrace {
+public:
+    enum Stage { Link, Network, Wait, Access, Memory, NumStages };
+
+    LatencyTrace(SimTime_t now = 0) : start_(now), last_(now) {
+        for (int i = 0; i < NumStages; i++)
+            stages_[i] = 0;
+    }
+
+    uint64_t getStage(int stage) const { return stages_[stage]; }
+    uint64_t getTotal(SimTime_t now) const { return now - start_; }
+
+    /* Charge the time since the last stamp to 'stage' */
+    void mark(Stage stage, SimTime_t now) {
+        stages_[stage] += now - last_;
+        last_ = now;
+    }
+
+private:
+    SimTime_t start_;
+    SimTime_t last_;
+    uint64_t stages_[NumStages];
+};
+
+/* Traces in flight on this thread, keyed by the ID of the request each started on */
+class LatencyTraceTable {
+public:
+    static void begin(SST::Event::id_type id, SimTime_t now) {
+        traces().insert(id, LatencyTrace(now));
+    }
+
+    /* Charge the time since the last stamp to 'stage', if ev belongs to a traced request */
+    template<class E>
+    static void mark(E* ev, LatencyTrace::Stage stage, SimTime_t now) {
+        SlotTable<SST::Event::id_type, LatencyTrace>& table = traces();
+        if (table.empty())
+            return;
+        bool response = BasicCommandClassArr[(int)ev->getCmd()] == BasicCommandClass::Response;
+        LatencyTrace* trace = table.find(response ? ev->getResponseToID() : ev->getID());
+        if (trace)
+            trace->mark(stage, now);
+    }
+
+    /* Remove the trace started on request 'id'. Returns false if there is none */
+    static bool end(SST::Event::id_type id, LatencyTrace& trace) {
+        LatencyTrace* found = traces().find(id);
+        if (!found)
+            return false;
+        trace = *found;
+        traces().erase(id);
+        return true;
+    }
+
+private:
+    static SlotTable<SST::Event::id_type, LatencyTrace>& traces() {
+        static thread_local SlotTable<SST::Event::id_type, LatencyTrace> table;
+        return table;
+    }
+};
+
+/* Samples requests and writes their traces */
+class LatencyTraceWriter {
+public:
+    LatencyTraceWriter() : fp_(nullptr), period_(1), countdown_(1) { }
+    ~LatencyTraceWriter() { close(); }
+
+    /* Returns false if the file cannot be opened */
+    bool open(const std::string& filename, uint64_t period, double psPerTick) {
+        fp_ = fopen(filename.c_str(), "wb");
+        if (!fp_)
+            return false;
+        period_ = countdown_ = period;
+        uint32_t header[3] = { 1, LatencyTrace::NumStages, (uint32_t)Command::LAST_CMD };
+        fwrite("MHLT", 1, 4, fp_);
+        fwrite(header, sizeof(header), 1, fp_);
+        fwrite(&psPerTick, sizeof(psPerTick), 1, fp_);
+        for (uint32_t i = 0; i < (uint32_t)Command::LAST_CMD; i++)
+            fwrite(CommandString[i], 1, strlen(CommandString[i]) + 1, fp_);
+        return true;
+    }
+
+    /* Whether to trace the next request */
+    bool sample() {
+        if (!fp_ || --countdown_ != 0)
+            return false;
+        countdown_ = period_;
+        return true;
+    }
+
+    void write(Command command, const LatencyTrace& trace, SimTime_t now) {
+        if (!fp_)
+            return;
+        uint64_t row[2 + LatencyTrace::NumStages];
+        row[0] = (uint64_t)command;
+        row[1] = trace.getTotal(now);
+        for (int i = 0; i < LatencyTrace::NumStages; i++)
+            row[2 + i] = trace.getStage(i);
+        fwrite(row, sizeof(row), 1, fp_);
+    }
+
+    void close() {
+        if (fp_)
+            fclose(fp_);
+        fp_ = nullptr;
+    }
+
+private:
+    FILE* fp_;
+    uint64_t period_;
+    uint64_t countdown_;
+};
+
+}}
+
+#ifdef MEMH_LATENCY_TRACE
+
+#define MEMH_TRACE_MARK(ev, stage, now) SST::MemHierarchy::LatencyTraceTable::mark((ev), SST::MemHierarchy::LatencyTrace::stage, (now))
+
+#else
+
+#define MEMH_TRACE_MARK(ev, stage, now)
+
+#endif /* MEMH_LATENCY_TRACE */
+
+#endif /* MEMHIERARCHY_LATENCYTRACE_H */
@@ -22,6 +22,7 @@
 
 #include "sst/elements/memHierarchy/memTypes.h"
 #include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 
 using namespace std;
@@ -45,14 +46,14 @@ class DirectoryLine {
         const unsigned int index_;
         Addr addr_;
         State state_;
-        std::set<std::string> sharers_;
-        std::string owner_;
+        SharerSet sharers_;
+        EndpointID owner_;
         uint64_t lastSendTimestamp_;
         CoherenceReplacementInfo * info_;
         bool wasPrefetch_;
 
     public:
-        DirectoryLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), lastSendTimestamp_(0), wasPrefetch_(false) {
+        DirectoryLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), owner_(EndpointRegistry::NO_ENDPOINT), lastSendTimestamp_(0), wasPrefetch_(false) {
             info_ = new CoherenceReplacementInfo(index, I, false, false);
         }
         virtual ~DirectoryLine() { }
@@ -60,7 +61,7 @@ class DirectoryLine {
         void reset() {
             state_ = I;
             sharers_.clear();
-            owner_ = "";
+            owner_ = EndpointRegistry::NO_ENDPOINT;
             lastSendTimestamp_ = 0;
             wasPrefetch_ = false;
         }
@@ -77,29 +78,29 @@ class DirectoryLine {
         void setState(State state) { state_ = state; }
 
         // Sharers
-        set<std::string>* getSharers() { return &sharers_; }
-        bool isSharer(std::string shr) {   return sharers_.find(shr) != sharers_.end(); }
+        SharerSet* getSharers() { return &sharers_; }
+        bool isSharer(EndpointID shr) { return sharers_.contains(shr); }
         size_t numSharers() { return sharers_.size(); }
         bool hasSharers() { return !sharers_.empty(); }
-        bool hasOtherSharers(std::string shr) { return !(sharers_.empty() || (sharers_.size() == 1 && sharers_.find(shr) != sharers_.end())); }
-        void addSharer(std::string shr) {
+        bool hasOtherSharers(EndpointID shr) { return !(sharers_.empty() || (sharers_.size() == 1 && sharers_.contains(shr))); }
+        void addSharer(EndpointID shr) {
             sharers_.insert(shr);
             info_->setShared(true);
         }
-        void removeSharer(std::string shr) {
+        void removeSharer(EndpointID shr) {
             sharers_.erase(shr);
             info_->setShared(!sharers_.empty());
         }
 
         // Owner
-        std::string getOwner() { return owner_; }
-        bool hasOwner() { return !owner_.empty(); }
-        void setOwner(std::string owner) {
+        EndpointID getOwner() { return owner_; }
+        bool hasOwner() { return owner_ != EndpointRegistry::NO_ENDPOINT; }
+        void setOwner(EndpointID owner) {
             owner_ = owner;
             info_->setOwned(true);
         }
         void removeOwner() {
-            owner_.clear();
+            owner_ = EndpointRegistry::NO_ENDPOINT;
             info_->setOwned(false);
         }
 
@@ -118,13 +119,8 @@ class DirectoryLine {
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
-            str << "O: " << (owner_.empty() ? "-" : owner_);
-            str << " S: [";
-            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++) {
-                if (it != sharers_.begin()) str << ",";
-                str << *it;
-            }
-            str << "]";
+            str << "O: " << (hasOwner() ? EndpointRegistry::getName(owner_) : "-");
+            str << " S: [" << sharers_.toString() << "]";
             return str.str();
         }
 };
@@ -320,13 +316,13 @@ class L1CacheLine : public CacheLine {
 /* With owner/sharer state for shared caches */
 class SharedCacheLine : public CacheLine {
     private:
-        std::set<std::string> sharers_;
-        std::string owner_;
+        SharerSet sharers_;
+        EndpointID owner_;
         CoherenceReplacementInfo * info;
     protected:
         virtual void updateReplacement() { info->setState(state_); }
     public:
-        SharedCacheLine(uint32_t size, unsigned int index) : owner_(""), CacheLine(size, index) {
+        SharedCacheLine(uint32_t size, unsigned int index) : owner_(EndpointRegistry::NO_ENDPOINT), CacheLine(size, index) {
             info = new CoherenceReplacementInfo(index, I, false, false);
         }
 
@@ -337,33 +333,33 @@ class SharedCacheLine : public CacheLine {
         void reset() {
             CacheLine::reset();
             sharers_.clear();
-            owner_ = "";
+            owner_ = EndpointRegistry::NO_ENDPOINT;
         }
 
         // Sharers
-        set<std::string>* getSharers() { return &sharers_; }
-        bool isSharer(std::string name) {   return sharers_.find(name) != sharers_.end(); }
+        SharerSet* getSharers() { return &sharers_; }
+        bool isSharer(EndpointID name) { return sharers_.contains(name); }
         size_t numSharers() { return sharers_.size(); }
         bool hasSharers() { return !sharers_.empty(); }
-        bool hasOtherSharers(std::string shr) { return !(sharers_.empty() || (sharers_.size() == 1 && sharers_.find(shr) != sharers_.end())); }
-        void addSharer(std::string s) {
+        bool hasOtherSharers(EndpointID shr) { return !(sharers_.empty() || (sharers_.size() == 1 && sharers_.contains(shr))); }
+        void addSharer(EndpointID s) {
             sharers_.insert(s);
             info->setShared(true);
         }
-        void removeSharer(std::string s) {
+        void removeSharer(EndpointID s) {
             sharers_.erase(s);
             info->setShared(!sharers_.empty());
         }
 
         // Owner
-        std::string getOwner() { return owner_; }
-        bool hasOwner() { return !owner_.empty(); }
-        void setOwner(std::string owner) {
+        EndpointID getOwner() { return owner_; }
+        bool hasOwner() { return owner_ != EndpointRegistry::NO_ENDPOINT; }
+        void setOwner(EndpointID owner) {
             owner_ = owner;
             info->setOwned(true);
         }
         void removeOwner() {
-            owner_.clear();
+            owner_ = EndpointRegistry::NO_ENDPOINT;
             info->setOwned(false);
         }
 
@@ -373,13 +369,8 @@ class SharedCacheLine : public CacheLine {
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
-            str << "O: " << (owner_.empty() ? "-" : owner_);
-            str << " S: [";
-            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++) {
-                if (it != sharers_.begin()) str << ",";
-                str << *it;
-            }
-            str << "]";
+            str << "O: " << (hasOwner() ? EndpointRegistry::getName(owner_) : "-");
+            str << " S: [" << sharers_.toString() << "]";
             return str.str();
         }
 };
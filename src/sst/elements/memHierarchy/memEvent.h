@@ -23,6 +23,7 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 #include "sst/elements/memHierarchy/memTypes.h"
 
 namespace SST { namespace MemHierarchy {
@@ -84,8 +85,31 @@ public:
         setPayload(data);
     }
 
+    /* Same as above but with an already-interned source; avoids a registry lookup on the simulation path */
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd) : MemEventBase(src, cmd) {
+        initialize();
+        addr_ = addr;
+        baseAddr_ = baseAddr;
+    }
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd, uint32_t size) : MemEventBase(src, cmd) {
+        initialize();
+        addr_ = addr;
+        baseAddr_ = baseAddr;
+        size_ = size;
+    }
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd, std::vector<uint8_t>& data) : MemEventBase(src, cmd) {
+        initialize();
+        addr_ = addr;
+        baseAddr_ = baseAddr;
+        setPayload(data);
+    }
+
 
 
+    /** MemEvents are recycled through a per-thread pool rather than the heap */
+    static void* operator new(size_t size) { return EventPool<MemEvent>::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { EventPool<MemEvent>::release(ptr, size); }
+
     /** Create a new MemEvent instance, pre-configured to act as a NACK response */
     MemEvent* makeNACKResponse(MemEvent* NACKedEvent) {
         MemEvent *me      = new MemEvent(*this);
@@ -216,10 +240,7 @@ public:
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
-        payload_.resize(size);
-        for ( uint32_t i = 0 ; i < size ; i++ ) {
-            payload_[i] = data[i];
-        }
+        payload_.assign(data, data + size);
     }
 
     void setZeroPayload(uint32_t size) {
@@ -228,6 +249,16 @@ public:
         payload_.resize(size, 0);
     }
 
+    /** Sets the payload size and returns the payload to be filled in place.
+     * Avoids building the data in a separate vector and copying it in.
+     * @param[in] size  Payload size; existing contents up to size are kept
+     */
+    uint8_t* allocatePayload(uint32_t size) {
+        setSize(size);
+        payload_.resize(size);
+        return payload_.data();
+    }
+
     size_t getPayloadSize() override {
         return payload_.size();
     }
@@ -316,7 +347,7 @@ private:
     bool            addrGlobal_;        // Whether address is a local or global address
     MemEvent*       NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int             retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec         payload_;           // Data
+    PayloadBuffer   payload_;           // Data
     bool            prefetch_;          // Whether this request came from a prefetcher
     bool            dirty_;             // For a replacement, whether the data is dirty or not
     bool            isEvict_;           // Whether an event is an eviction
@@ -326,20 +357,82 @@ private:
     MemEvent() : MemEventBase() {} // For serialization only
 
 public:
+    /* MemEvents are the bulk of cross-rank traffic so they use the compact wire format in memEventWire.h */
+    enum MemEventWireBits : uint64_t {
+        WIRE_OFFSET     = 1 << 0,   // addr_ != baseAddr_
+        WIRE_LOCAL      = 1 << 1,   // !addrGlobal_
+        WIRE_NACKED     = 1 << 2,
+        WIRE_RETRIES    = 1 << 3,
+        WIRE_PAYLOAD    = 1 << 4,
+        WIRE_PREFETCH   = 1 << 5,
+        WIRE_DIRTY      = 1 << 6,
+        WIRE_EVICT      = 1 << 7,
+        WIRE_INSTPTR    = 1 << 8,
+        WIRE_VADDR      = 1 << 9,
+    };
+
+    void pack(WireWriter &out) const {
+        uint64_t bits = 0;
+        if (addr_ != baseAddr_) bits |= WIRE_OFFSET;
+        if (!addrGlobal_) bits |= WIRE_LOCAL;
+        if (NACKedEvent_) bits |= WIRE_NACKED;
+        if (retries_ != 0) bits |= WIRE_RETRIES;
+        if (!payload_.empty()) bits |= WIRE_PAYLOAD;
+        if (prefetch_) bits |= WIRE_PREFETCH;
+        if (dirty_) bits |= WIRE_DIRTY;
+        if (isEvict_) bits |= WIRE_EVICT;
+        if (instPtr_ != 0) bits |= WIRE_INSTPTR;
+        if (vAddr_ != 0) bits |= WIRE_VADDR;
+
+        packBase(out);
+        out.varint(bits);
+        out.varint(size_);
+        out.varint(baseAddr_);
+        if (bits & WIRE_OFFSET) out.varint(addr_ ^ baseAddr_);
+        if (bits & WIRE_RETRIES) out.svarint(retries_);
+        if (bits & WIRE_PAYLOAD) out.bytes(payload_.data(), payload_.size());
+        if (bits & WIRE_INSTPTR) out.varint(instPtr_);
+        if (bits & WIRE_VADDR) out.varint(vAddr_);
+    }
+
+    /* Returns whether a NACKed event follows */
+    bool unpack(WireReader &in) {
+        unpackBase(in);
+        uint64_t bits = in.varint();
+        size_ = in.varint();
+        baseAddr_ = in.varint();
+        addr_ = (bits & WIRE_OFFSET) ? (in.varint() ^ baseAddr_) : baseAddr_;
+        addrGlobal_ = !(bits & WIRE_LOCAL);
+        NACKedEvent_ = nullptr;
+        retries_ = (bits & WIRE_RETRIES) ? in.svarint() : 0;
+        if (bits & WIRE_PAYLOAD)
+            in.bytes(payload_);
+        else
+            payload_.clear();
+        prefetch_ = bits & WIRE_PREFETCH;
+        dirty_ = bits & WIRE_DIRTY;
+        isEvict_ = bits & WIRE_EVICT;
+        instPtr_ = (bits & WIRE_INSTPTR) ? in.varint() : 0;
+        vAddr_ = (bits & WIRE_VADDR) ? in.varint() : 0;
+        return bits & WIRE_NACKED;
+    }
+
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
-        MemEventBase::serialize_order(ser);
-        ser & size_;
-        ser & addr_;
-        ser & baseAddr_;
-        ser & addrGlobal_;
-        ser & NACKedEvent_;
-        ser & retries_;
-        ser & payload_;
-        ser & prefetch_;
-        ser & dirty_;
-        ser & isEvict_;
-        ser & instPtr_;
-        ser & vAddr_;
+        Event::serialize_order(ser);
+        std::vector<uint8_t> wire;
+        bool nacked = false;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK) {
+            WireWriter out(wire);
+            pack(out);
+            nacked = NACKedEvent_ != nullptr;
+        }
+        ser & wire;
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            WireReader in(wire);
+            nacked = unpack(in);
+        }
+        if (nacked)
+            ser & NACKedEvent_;
     }
 
     ImplementSerializable(SST::MemHierarchy::MemEvent);
@@ -22,6 +22,9 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
+#include "sst/elements/memHierarchy/memEventWire.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -46,6 +49,13 @@ public:
 
     /** Creates a new MemEventBase */
     MemEventBase(std::string src, Command cmd) : SST::Event() {
+        setDefaults();
+        cmd_ = cmd;
+        src_ = EndpointRegistry::intern(src);
+    }
+
+    /** Creates a new MemEventBase using a pre-interned source name */
+    MemEventBase(EndpointID src, Command cmd) : SST::Event() {
         setDefaults();
         cmd_ = cmd;
         src_ = src;
@@ -54,12 +64,13 @@ public:
     virtual void setDefaults() {
         eventID_        = generateUniqueId();  // Defined in SST::Event
         responseToID_   = NO_ID;
-        dst_            = NONE;
-        src_            = NONE;
-        rqstr_          = NONE;
+        dst_            = EndpointRegistry::NONE_ENDPOINT;
+        src_            = EndpointRegistry::NONE_ENDPOINT;
+        rqstr_          = EndpointRegistry::NONE_ENDPOINT;
         cmd_            = Command::NULLCMD;
         flags_          = 0;
         memFlags_       = 0;
+        rqstrSeq_       = 0;
     }
 
     virtual MemEventBase* makeResponse() {
@@ -77,6 +88,7 @@ public:
         tid_ = event->tid_;
         flags_ = event->flags_;
         memFlags_ = event->memFlags_;
+        rqstrSeq_ = event->rqstrSeq_;
     }
 
     virtual void copyMetadata(MemEventBase* ev) {
@@ -84,6 +96,7 @@ public:
         tid_ = ev->tid_;
         flags_ = ev->flags_;
         memFlags_ = ev->memFlags_;
+        rqstrSeq_ = ev->rqstrSeq_;
     }
 
     /** @return  Unique ID of this MemEvent */
@@ -98,19 +111,31 @@ public:
     void setCmd(Command newcmd) { cmd_ = newcmd; }
 
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
+    const std::string& getSrc(void) const { return EndpointRegistry::getName(src_); }
     /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    void setSrc(const std::string& src) { src_ = EndpointRegistry::intern(src); }
+    /** @return the source ID - who sent this MemEvent */
+    EndpointID getSrcID(void) const { return src_; }
+    /** Sets the source ID - who sent this MemEvent */
+    void setSrcID(EndpointID src) { src_ = src; }
 
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
+    const std::string& getDst(void) const { return EndpointRegistry::getName(dst_); }
     /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    void setDst(const std::string& dst) { dst_ = EndpointRegistry::intern(dst); }
+    /** @return the destination ID - who receives this MemEvent */
+    EndpointID getDstID(void) const { return dst_; }
+    /** Sets the destination ID - who receives this MemEvent */
+    void setDstID(EndpointID dst) { dst_ = dst; }
 
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
+    const std::string& getRqstr(void) const { return EndpointRegistry::getName(rqstr_); }
     /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    void setRqstr(const std::string& rqstr) { rqstr_ = EndpointRegistry::intern(rqstr); }
+    /** @return the requestor ID - whose original request caused this MemEvent */
+    EndpointID getRqstrID(void) const { return rqstr_; }
+    /** Sets the requestor ID - whose original request caused this MemEvent */
+    void setRqstrID(EndpointID rqstr) { rqstr_ = rqstr; }
 
     /** @return the thread ID that originated the original request */
     [[deprecated("Use getThreadID() instead (with capital 'D')")]]
@@ -118,6 +143,10 @@ public:
     const uint32_t getThreadID(void) const { return tid_; }
     /** Sets the thread ID that originated the original request */
     void setThreadID(const uint32_t tid) { tid_ = tid; }
+    /** @return the sequence number the requestor's interface gave the original request */
+    uint32_t getRqstrSeq(void) const { return rqstrSeq_; }
+    /** Sets the requestor's sequence number. Copied into responses like the thread ID */
+    void setRqstrSeq(uint32_t seq) { rqstrSeq_ = seq; }
     /** @returns the state of all flags */
     uint32_t getFlags(void) const { return flags_; }
     /** Sets the specified flag.
@@ -182,7 +211,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream str;
         str << " Flags: " << getFlagString();
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Rq: " + rqstr_ + " Tid: " + std::to_string(tid_) + str.str();
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Rq: " + getRqstr() + " Tid: " + std::to_string(tid_) + str.str();
     }
 
     /** Get brief print of the event */
@@ -190,7 +219,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
     
     /** Get brief print of the event */
@@ -198,7 +227,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
 
     virtual bool doDebug(std::set<Addr> &UNUSED(addr)) {
@@ -220,28 +249,94 @@ public:
 protected:
     id_type         eventID_;           // Unique ID for this event
     id_type         responseToID_;      // For responses, holds the ID to which this event matches
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    EndpointID      src_;               // Source ID
+    EndpointID      dst_;               // Destination ID
+    EndpointID      rqstr_;             // Cache that originated this request
     uint32_t        tid_;               // Thread ID that originated this request
     Command         cmd_;               // Command
     uint32_t        flags_;
     uint32_t        memFlags_;
+    uint32_t        rqstrSeq_;          // Requestor's local sequence number for the original request
 
     MemEventBase() {} // For serialization only
 
+    /*
+     * Compact encoding of the fields above (see memEventWire.h), for derived
+     * events that pack themselves into a single buffer.
+     * Endpoints are written by name since IDs are only valid within a rank.
+     */
+    enum WireBits : uint64_t {
+        WIRE_RESPONSE   = 1 << 0,   // responseToID_ is set
+        WIRE_RQSTR_SRC  = 1 << 1,   // rqstr_ == src_
+        WIRE_RQSTR_DST  = 1 << 2,   // rqstr_ == dst_
+        WIRE_TID        = 1 << 3,
+        WIRE_FLAGS      = 1 << 4,
+        WIRE_MEMFLAGS   = 1 << 5,
+        WIRE_RQSTR_SEQ  = 1 << 6,
+    };
+
+    void packBase(WireWriter &out) const {
+        uint64_t bits = 0;
+        if (responseToID_ != NO_ID) bits |= WIRE_RESPONSE;
+        if (rqstr_ == src_) bits |= WIRE_RQSTR_SRC;
+        else if (rqstr_ == dst_) bits |= WIRE_RQSTR_DST;
+        if (tid_ != 0) bits |= WIRE_TID;
+        if (flags_ != 0) bits |= WIRE_FLAGS;
+        if (memFlags_ != 0) bits |= WIRE_MEMFLAGS;
+        if (rqstrSeq_ != 0) bits |= WIRE_RQSTR_SEQ;
+
+        out.varint(bits);
+        out.varint(eventID_.first);
+        out.svarint(eventID_.second);
+        if (bits & WIRE_RESPONSE) {
+            out.varint(responseToID_.first);
+            out.svarint(responseToID_.second);
+        }
+        out.varint((uint64_t)cmd_);
+        out.string(EndpointRegistry::getName(src_));
+        out.string(EndpointRegistry::getName(dst_));
+        if (!(bits & (WIRE_RQSTR_SRC | WIRE_RQSTR_DST)))
+            out.string(EndpointRegistry::getName(rqstr_));
+        if (bits & WIRE_TID) out.varint(tid_);
+        if (bits & WIRE_FLAGS) out.varint(flags_);
+        if (bits & WIRE_MEMFLAGS) out.varint(memFlags_);
+        if (bits & WIRE_RQSTR_SEQ) out.varint(rqstrSeq_);
+    }
+
+    void unpackBase(WireReader &in) {
+        uint64_t bits = in.varint();
+        eventID_.first = in.varint();
+        eventID_.second = in.svarint();
+        responseToID_ = NO_ID;
+        if (bits & WIRE_RESPONSE) {
+            responseToID_.first = in.varint();
+            responseToID_.second = in.svarint();
+        }
+        cmd_ = (Command)in.varint();
+        src_ = EndpointRegistry::intern(in.string());
+        dst_ = EndpointRegistry::intern(in.string());
+        if (bits & WIRE_RQSTR_SRC) rqstr_ = src_;
+        else if (bits & WIRE_RQSTR_DST) rqstr_ = dst_;
+        else rqstr_ = EndpointRegistry::intern(in.string());
+        tid_ = (bits & WIRE_TID) ? in.varint() : 0;
+        flags_ = (bits & WIRE_FLAGS) ? in.varint() : 0;
+        memFlags_ = (bits & WIRE_MEMFLAGS) ? in.varint() : 0;
+        rqstrSeq_ = (bits & WIRE_RQSTR_SEQ) ? in.varint() : 0;
+    }
+
 public:
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         Event::serialize_order(ser);
         ser & eventID_;
         ser & responseToID_;
-        ser & src_;
-        ser & dst_;
-        ser & rqstr_;
+        serializeEndpoint(ser, src_);
+        serializeEndpoint(ser, dst_);
+        serializeEndpoint(ser, rqstr_);
         ser & tid_;
         ser & cmd_;
         ser & flags_;
         ser & memFlags_;
+        ser & rqstrSeq_;
     }
 
     ImplementSerializable(SST::MemHierarchy::MemEventBase);
@@ -269,6 +364,10 @@ public:
     MemEventInit(std::string src, Command cmd, Addr addr, std::vector<uint8_t> &data) :
         MemEventBase(src, cmd), initCmd_(InitCommand::Data), addr_(addr), payload_(data) { }
 
+    /* Recycled through a per-thread pool; derived init events fall back to the heap */
+    static void* operator new(size_t size) { return EventPool<MemEventInit>::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { EventPool<MemEventInit>::release(ptr, size); }
+
     InitCommand getInitCmd() { return initCmd_; }
 
     std::vector<uint8_t>& getPayload() { return payload_; }
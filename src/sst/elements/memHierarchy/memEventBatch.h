@@ -0,0 +1,61 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTBATCH_H
+#define MEMHIERARCHY_MEMEVENTBATCH_H
+
+#include <vector>
+
+#include <sst/core/event.h>
+
+#include "sst/elements/memHierarchy/memEventBase.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Several MemEventBases sent over a MemLink as one link event.
+ * The receiving MemLink delivers the events to its handler one at a time,
+ * in order, so nothing above the link sees the batch.
+ */
+class MemEventBatch : public SST::Event {
+public:
+    MemEventBatch(const std::vector<MemEventBase*>& events) : SST::Event(), events_(events) { }
+
+    std::vector<MemEventBase*>& getEvents() { return events_; }
+
+    virtual Event* clone(void) override {
+        MemEventBatch* batch = new MemEventBatch(*this);
+        for (auto& ev : batch->events_)
+            ev = static_cast<MemEventBase*>(ev->clone());
+        return batch;
+    }
+
+private:
+    std::vector<MemEventBase*> events_;
+
+    MemEventBatch() {} // For serialization only
+
+public:
+    void serialize_order(SST::Core::Serialization::serializer &ser) override {
+        Event::serialize_order(ser);
+        ser & events_;
+    }
+
+    ImplementSerializable(SST::MemHierarchy::MemEventBatch);
+};
+
+}}
+
+#endif /* MEMHIERARCHY_MEMEVENTBATCH_H */
@@ -41,6 +41,7 @@ public:
 
     /** Creates a new CustomMemEvent */
     CustomMemEvent(std::string src, Command cmd, Interfaces::StandardMem::CustomData* data) : MemEventBase(src, cmd), data_(data) {}
+    CustomMemEvent(EndpointID src, Command cmd, Interfaces::StandardMem::CustomData* data) : MemEventBase(src, cmd), data_(data) {}
 
     CustomMemEvent* makeResponse() override {
         CustomMemEvent *me = new CustomMemEvent(*this);
@@ -0,0 +1,180 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTPOOL_H
+#define MEMHIERARCHY_MEMEVENTPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Recycling for the objects that make up steady-state memHierarchy traffic
+ *
+ * Each simulation thread keeps its own free lists so that allocate/release
+ * never take a lock. Memory freed on a different thread than it was allocated on
+ * simply moves to that thread's list. Lists are capped so that a burst of
+ * outstanding events does not pin memory for the rest of the simulation.
+ */
+
+/*
+ * Free list of fixed-size blocks for one event class
+ * Used from class-specific operator new/delete. Requests for any other size
+ * (i.e., a derived class that did not define its own pool) go to the global heap.
+ */
+template<class T>
+class EventPool {
+public:
+    static void* allocate(size_t size) {
+        if (size == sizeof(T)) {
+            FreeList& list = getList();
+            if (!list.blocks.empty()) {
+                void* ptr = list.blocks.back();
+                list.blocks.pop_back();
+                return ptr;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    static void release(void* ptr, size_t size) {
+        if (size == sizeof(T) && !listDestroyed()) {
+            FreeList& list = getList();
+            if (list.blocks.size() < maxCached) {
+                list.blocks.push_back(ptr);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+private:
+    static constexpr size_t maxCached = 16384;
+
+    struct FreeList {
+        std::vector<void*> blocks;
+        ~FreeList() {
+            for (void* ptr : blocks)
+                ::operator delete(ptr);
+            listDestroyed() = true;
+        }
+    };
+
+    static FreeList& getList() {
+        static thread_local FreeList list;
+        return list;
+    }
+
+    /* Events deleted during thread teardown bypass the (already destroyed) list */
+    static bool& listDestroyed() {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+};
+
+/*
+ * Event payload that recycles its storage
+ *
+ * A PayloadBuffer is a std::vector<uint8_t> so existing code can keep taking
+ * payloads by std::vector reference. On destruction, the storage is handed to a
+ * per-thread spare list instead of being freed, and new buffers start from a spare.
+ * Once the list is warm, creating, copying, and destroying line-sized payloads
+ * does not touch the heap.
+ */
+class PayloadBuffer : public std::vector<uint8_t> {
+public:
+    PayloadBuffer() { acquire(); }
+
+    PayloadBuffer(const PayloadBuffer& other) : std::vector<uint8_t>() {
+        acquire();
+        assign(other.begin(), other.end());
+    }
+
+    PayloadBuffer(const std::vector<uint8_t>& other) : std::vector<uint8_t>() {
+        acquire();
+        assign(other.begin(), other.end());
+    }
+
+    PayloadBuffer(PayloadBuffer&& other) noexcept : std::vector<uint8_t>(std::move(other)) { }
+
+    PayloadBuffer& operator=(const PayloadBuffer& other) {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    PayloadBuffer& operator=(const std::vector<uint8_t>& other) {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    PayloadBuffer& operator=(PayloadBuffer&& other) noexcept {
+        std::vector<uint8_t>::operator=(std::move(other));
+        return *this;
+    }
+
+    ~PayloadBuffer() { release(); }
+
+    /* Largest buffer that is recycled; bigger ones (e.g., page-sized) are freed normally */
+    static constexpr size_t maxPooledCapacity = 256;
+
+private:
+    static constexpr size_t maxCached = 16384;
+
+    struct SpareList {
+        std::vector<std::vector<uint8_t>> buffers;
+        ~SpareList() { listDestroyed() = true; }
+    };
+
+    static SpareList& getList() {
+        static thread_local SpareList list;
+        return list;
+    }
+
+    static bool& listDestroyed() {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    void acquire() {
+        if (listDestroyed())
+            return;
+        SpareList& list = getList();
+        if (!list.buffers.empty()) {
+            swap(list.buffers.back());
+            list.buffers.pop_back();
+        }
+    }
+
+    void release() {
+        if (capacity() == 0 || capacity() > maxPooledCapacity || listDestroyed())
+            return;
+        SpareList& list = getList();
+        if (list.buffers.size() < maxCached) {
+            clear();
+            list.buffers.emplace_back();
+            list.buffers.back().swap(*this);
+        }
+    }
+};
+
+}}
+
+#endif /* MEMHIERARCHY_MEMEVENTPOOL_H */
@@ -0,0 +1,119 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTWIRE_H
+#define MEMHIERARCHY_MEMEVENTWIRE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sst/core/output.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Byte-level encoding for events that cross a rank boundary
+ *
+ * Field-by-field serialization writes every integer at full width and puts an 8-byte length
+ * in front of each string and vector. Most of those bytes are zeros: IDs, sizes, and flags
+ * are small, and many fields are usually at their defaults. Events instead pack their fields
+ * into a single byte buffer: a bitmask of which optional fields are present, followed by
+ * those fields as LEB128 varints, with strings and payloads prefixed by varint lengths.
+ * The buffer is then handed to the serializer as one vector.
+ */
+class WireWriter {
+public:
+    WireWriter(std::vector<uint8_t>& buf) : buf_(buf) { }
+
+    void u8(uint8_t val) { buf_.push_back(val); }
+
+    void varint(uint64_t val) {
+        while (val >= 0x80) {
+            buf_.push_back((uint8_t)(val | 0x80));
+            val >>= 7;
+        }
+        buf_.push_back((uint8_t)val);
+    }
+
+    /* Signed values, zigzag encoded so that small negative numbers stay short */
+    void svarint(int64_t val) { varint(((uint64_t)val << 1) ^ (uint64_t)(val >> 63)); }
+
+    void bytes(const uint8_t* data, size_t len) {
+        varint(len);
+        buf_.insert(buf_.end(), data, data + len);
+    }
+
+    void string(const std::string& str) { bytes((const uint8_t*)str.data(), str.size()); }
+
+private:
+    std::vector<uint8_t>& buf_;
+};
+
+class WireReader {
+public:
+    WireReader(const std::vector<uint8_t>& buf) : buf_(buf), pos_(0) { }
+
+    uint8_t u8() {
+        check(1);
+        return buf_[pos_++];
+    }
+
+    uint64_t varint() {
+        uint64_t val = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = u8();
+            val |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return val;
+        }
+        Output::getDefaultObject().fatal(CALL_INFO, -1, "memHierarchy, Error: malformed varint in serialized event\n");
+        return 0;
+    }
+
+    int64_t svarint() {
+        uint64_t val = varint();
+        return (int64_t)(val >> 1) ^ -(int64_t)(val & 1);
+    }
+
+    /* Variable-length bytes into any container with assign() */
+    template<class T>
+    void bytes(T& out) {
+        size_t len = varint();
+        check(len);
+        out.assign(buf_.begin() + pos_, buf_.begin() + pos_ + len);
+        pos_ += len;
+    }
+
+    std::string string() {
+        std::string str;
+        bytes(str);
+        return str;
+    }
+
+private:
+    void check(size_t len) {
+        if (len > buf_.size() - pos_)
+            Output::getDefaultObject().fatal(CALL_INFO, -1, "memHierarchy, Error: serialized event is truncated\n");
+    }
+
+    const std::vector<uint8_t>& buf_;
+    size_t pos_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_MEMEVENTWIRE_H */
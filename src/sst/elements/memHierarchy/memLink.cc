@@ -151,6 +151,13 @@ MemEventInit * MemLink::recvInitData() {
 void MemLink::addRemote(EndpointInfo info) {
     remotes.insert(info);
     remoteNames.insert(info.name);
+    remoteIDs.insert(EndpointRegistry::intern(info.name));
+
+    // Keep the index in the same order as 'remotes' so that lookups match a scan of the set
+    remoteIndex.clear();
+    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++) {
+        remoteIndex.add(it->region, EndpointRegistry::intern(it->name));
+    }
 }
 
 void MemLink::addEndpoint(EndpointInfo info) {
@@ -180,6 +187,16 @@ void MemLink::send(MemEventBase *ev) {
     link->send(ev);
 }
 
+/**
+ * Send a batch as one link event. The receiving MemLink unpacks it.
+ */
+void MemLink::send(const std::vector<MemEventBase*>& evs) {
+    if (evs.size() == 1)
+        link->send(evs.front());
+    else if (!evs.empty())
+        link->send(new MemEventBatch(evs));
+}
+
 /**
  * Polled receive
  */
@@ -209,16 +226,21 @@ std::string MemLink::getTargetDestination(Addr addr) {
 }
 
 std::string MemLink::findTargetDestination(Addr addr) {
-    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++) {
-        if (it->region.contains(addr)) return it->name;
-    }
-    return "";
+    return EndpointRegistry::getName(remoteIndex.findID(addr));
+}
+
+EndpointID MemLink::findTargetDestinationID(Addr addr) {
+    return remoteIndex.findID(addr);
 }
 
 bool MemLink::isReachable(std::string dst) {
    return remoteNames.find(dst) != remoteNames.end();
 }
 
+bool MemLink::isReachable(EndpointID dst) {
+   return remoteIDs.contains(dst);
+}
+
 std::string MemLink::getAvailableDestinationsAsString() {
     std::stringstream str;
     for (std::set<EndpointInfo>::const_iterator it = endpoints.begin(); it != endpoints.end(); it++) {
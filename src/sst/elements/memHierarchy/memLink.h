@@ -103,12 +103,15 @@ public:
     virtual bool isSource(std::string UNUSED(str));
     virtual std::string findTargetDestination(Addr addr);
     virtual std::string getTargetDestination(Addr addr);
+    virtual EndpointID findTargetDestinationID(Addr addr);
     virtual bool isReachable(std::string dst);
+    virtual bool isReachable(EndpointID dst);
 
     /* Send and receive functions for MemLink */
     virtual void sendInitData(MemEventInit * ev, bool broadcast = true);
     virtual MemEventInit* recvInitData();
     virtual void send(MemEventBase * ev);
+    virtual void send(const std::vector<MemEventBase*>& evs);
     virtual MemEventBase * recv();
 
     /* Debug */
@@ -128,6 +131,8 @@ protected:
     std::set<EndpointInfo> remotes;             // Tracks remotes immediately accessible on the other side of our link
     std::set<EndpointInfo> endpoints;           // Tracks endpoints in the system with info on how to get there
     std::set<std::string> remoteNames;          // Tracks remote names for faster lookup than iteratinv via remotes
+    SharerSet remoteIDs;                        // Same as remoteNames, by EndpointID
+    DestinationIndex remoteIndex;               // Address -> remote lookup table built from remotes
     
     // For events that require destination names during init
     std::set<MemEventInit*> initSendQ;
@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
+#include <typeinfo>
 
 #include <sst/core/event.h>
 #include <sst/core/output.h>
@@ -28,6 +29,9 @@
 #include <sst/core/warnmacros.h>
 
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEventBatch.h"
+#include "sst/elements/memHierarchy/latencyTrace.h"
+#include "sst/elements/memHierarchy/destinationIndex.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
 
@@ -163,17 +167,42 @@ public:
     }
     virtual void send(MemEventBase * ev) =0;
 
+    /* Send several events in order. Links that can carry them as one event override this */
+    virtual void send(const std::vector<MemEventBase*>& evs) {
+        for (MemEventBase* ev : evs)
+            send(ev);
+    }
+
     /*
      * Extra functions for MemLink derivatives
      */
     virtual bool clock() { return true; } // No clock
 
     // Link call back for incoming events
-    void recvNotify(SST::Event * ev) { (*recvHandler)(ev); }
+    void recvNotify(SST::Event * ev) {
+        if (typeid(*ev) == typeid(MemEventBatch)) {
+            MemEventBatch* batch = static_cast<MemEventBatch*>(ev);
+            for (MemEventBase* mev : batch->getEvents())
+                recvNotify(mev);
+            delete batch;
+            return;
+        }
+        MEMH_TRACE_MARK(static_cast<MemEventBase*>(ev), Link, getCurrentSimCycle());
+        (*recvHandler)(ev);
+    }
 
     /* Functions for managing communication according to address */
     virtual std::string findTargetDestination(Addr addr) =0;    /* Return destination and return "" if none found */
     virtual std::string getTargetDestination(Addr addr) =0;     /* Return destination and error if none found */
+
+    /* Same as above but return the destination's EndpointID (NO_ENDPOINT if none found). Links should override with a fast lookup */
+    virtual EndpointID findTargetDestinationID(Addr addr) { return EndpointRegistry::intern(findTargetDestination(addr)); }
+    EndpointID getTargetDestinationID(Addr addr) {
+        EndpointID dst = findTargetDestinationID(addr);
+        if (dst == EndpointRegistry::NO_ENDPOINT)
+            getTargetDestination(addr); // Reports the error
+        return dst;
+    }
     
     /* Check if a request address maps to our region */
     virtual bool isRequestAddressValid(Addr addr) { return info.region.contains(addr); }
@@ -188,6 +217,7 @@ public:
     virtual bool isDest(std::string UNUSED(str)) =0;    /* Check whether a component is a destination on this link. May be slow (for init() only) */
     virtual bool isSource(std::string UNUSED(str)) =0;  /* Check whether a component is a soruce on this link. May be slow (for init() only) */
     virtual bool isReachable(std::string dst) =0;       /* Check whether a component is reachable on this link. Should be fast - used during simulation */
+    virtual bool isReachable(EndpointID dst) { return isReachable(EndpointRegistry::getName(dst)); }
 
     MemRegion getRegion() { return info.region; }
     void setRegion(MemRegion region) { info.region = region; }
@@ -90,6 +90,7 @@ bool MemNIC::recvNotify(int) {
                 dbg.debug(_L5_, "E: %-40" PRIu64 "  %-20s NIC:Recv      (%s)\n", 
                     getCurrentSimCycle(), getName().c_str(), ev->getBriefString().c_str());
             }
+            MEMH_TRACE_MARK(ev, Network, getCurrentSimCycle());
             (*recvHandler)(ev);
         }
     }
@@ -102,7 +103,7 @@ void MemNIC::send(MemEventBase *ev) {
     SimpleNetwork::Request *req = new SimpleNetwork::Request();
     MemRtrEvent * mre = new MemRtrEvent(ev);
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev->getDstID());
     req->size_in_bits = getSizeInBits(ev);
     req->vn = 0;
 
@@ -195,10 +195,11 @@ class MemNICBase : public MemLinkBase {
         virtual std::set<EndpointInfo>* getDests() { return &destEndpointInfo; }
         
         virtual std::string findTargetDestination(Addr addr) {
-            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-                if (it->region.contains(addr)) return it->name;
-            }
-            return "";
+            return EndpointRegistry::getName(destIndex.findID(addr));
+        }
+
+        virtual EndpointID findTargetDestinationID(Addr addr) {
+            return destIndex.findID(addr);
         }
 
         virtual std::string getTargetDestination(Addr addr) {
@@ -220,6 +221,10 @@ class MemNICBase : public MemLinkBase {
         virtual bool isReachable(std::string dst) {
             return reachableNames.find(dst) != reachableNames.end();
         }
+
+        virtual bool isReachable(EndpointID dst) {
+            return reachableIDs.contains(dst);
+        }
         
         virtual std::string getAvailableDestinationsAsString() {
             stringstream str;
@@ -234,10 +239,22 @@ class MemNICBase : public MemLinkBase {
         virtual void addSource(EndpointInfo info) { 
             sourceEndpointInfo.insert(info);
             reachableNames.insert(info.name);
+            reachableIDs.insert(EndpointRegistry::intern(info.name));
         }
         virtual void addDest(EndpointInfo info) { 
             destEndpointInfo.insert(info); 
             reachableNames.insert(info.name);
+            reachableIDs.insert(EndpointRegistry::intern(info.name));
+            rebuildDestIndex();
+        }
+
+        // Regenerate the address -> destination table from destEndpointInfo
+        // Entries are added in set order so that lookups match a scan of the set
+        void rebuildDestIndex() {
+            destIndex.clear();
+            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
+                destIndex.add(it->region, EndpointRegistry::intern(it->name), it->addr);
+            }
         }
 
         virtual void addEndpoint(EndpointInfo info) { endpointInfo.insert(info); }
@@ -310,7 +327,7 @@ class MemNICBase : public MemLinkBase {
                 InitMemRtrEvent * imre = dynamic_cast<InitMemRtrEvent*>(payload);
                 if (imre) {
                     // Record name->address map for all other endpoints
-                    networkAddressMap.insert(std::make_pair(imre->info.name, imre->info.addr));
+                    setNetworkAddress(EndpointRegistry::intern(imre->info.name), imre->info.addr);
                     processInitMemRtrEvent(imre);
                     delete imre;
                 } else {
@@ -393,6 +410,7 @@ class MemNICBase : public MemLinkBase {
                 }
             }
             destEndpointInfo = newDests;
+            rebuildDestIndex();
             
             int stopAfter = 20; // This is error checking, if it takes too long, stop
             for (auto et = destEndpointInfo.begin(); et != destEndpointInfo.end(); et++) {
@@ -418,8 +436,9 @@ class MemNICBase : public MemLinkBase {
                 dbg.debug(_L2_, "%s, Notice: Too many regions to complete error check for overlapping destination regions. Checked first 20 pairs.\n",
                         getName().c_str());
 
-            for (auto it = networkAddressMap.begin(); it != networkAddressMap.end(); it++) {
-                dbg.debug(_L10_, "    Address: %s -> %" PRIu64 "\n", it->first.c_str(), it->second);
+            for (EndpointID id = 0; id < networkAddressMap.size(); id++) {
+                if (networkAddressMap[id] != UNKNOWN_NETWORK_ADDRESS)
+                    dbg.debug(_L10_, "    Address: %s -> %" PRIu64 "\n", EndpointRegistry::getName(id).c_str(), networkAddressMap[id]);
             }
             for (auto it = sourceEndpointInfo.begin(); it != sourceEndpointInfo.end(); it++) {
                 dbg.debug(_L10_, "    Source: %s\n", it->toString().c_str()); 
@@ -438,12 +457,22 @@ class MemNICBase : public MemLinkBase {
         }
 
         // Lookup the network address for a given endpoint
-        virtual uint64_t lookupNetworkAddress(const std::string &dst) const {
-            std::unordered_map<std::string,uint64_t>::const_iterator it = networkAddressMap.find(dst);
-            if (it == networkAddressMap.end()) {
-                dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), dst.c_str());
+        virtual uint64_t lookupNetworkAddress(EndpointID dst) const {
+            if (!hasNetworkAddress(dst)) {
+                dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), EndpointRegistry::getName(dst).c_str());
             }
-            return it->second;
+            return networkAddressMap[dst];
+        }
+
+        bool hasNetworkAddress(EndpointID dst) const {
+            return dst < networkAddressMap.size() && networkAddressMap[dst] != UNKNOWN_NETWORK_ADDRESS;
+        }
+
+        void setNetworkAddress(EndpointID dst, uint64_t addr) {
+            if (dst >= networkAddressMap.size())
+                networkAddressMap.resize(dst + 1, UNKNOWN_NETWORK_ADDRESS);
+            if (networkAddressMap[dst] == UNKNOWN_NETWORK_ADDRESS) // Keep the first address seen for a name
+                networkAddressMap[dst] = addr;
         }
 
         /*
@@ -494,7 +523,7 @@ class MemNICBase : public MemLinkBase {
                     return mre;
                 } else {
                     InitMemRtrEvent * imre = static_cast<InitMemRtrEvent*>(mre);
-                    if (networkAddressMap.find(imre->info.name) == networkAddressMap.end()) {
+                    if (!hasNetworkAddress(EndpointRegistry::intern(imre->info.name))) {
                         dbg.fatal(CALL_INFO, -1, "%s received information about previously unknown endpoint. This case is not handled. Endpoint name: %s\n",
                                 getName().c_str(), imre->info.name.c_str());
                     }
@@ -514,11 +543,14 @@ class MemNICBase : public MemLinkBase {
         bool initMsgSent;
 
         // Data structures
-        std::unordered_map<std::string,uint64_t> networkAddressMap; // Map of name -> address for each network endpoint
+        static constexpr uint64_t UNKNOWN_NETWORK_ADDRESS = (uint64_t) - 1;
+        std::vector<uint64_t> networkAddressMap; // Network address for each endpoint, indexed by EndpointID
         std::set<EndpointInfo> sourceEndpointInfo;
         std::set<EndpointInfo> destEndpointInfo;
         std::set<EndpointInfo> endpointInfo;
         std::set<std::string> reachableNames;
+        SharerSet reachableIDs;         // Same as reachableNames, by EndpointID
+        DestinationIndex destIndex;     // Address -> destination lookup table built from destEndpointInfo
 
         // Init queues
         std::queue<MemRtrEvent*> initQueue; // Queue for received init events
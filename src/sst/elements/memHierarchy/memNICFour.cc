@@ -141,7 +141,7 @@ void MemNICFour::send(MemEventBase *ev) {
     SimpleNetwork::Request * req = new SimpleNetwork::Request();
     req->vn = 0;
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev->getDstID());
 
     unsigned int tag = sendTags[req->dest];
     sendTags[req->dest]++;
@@ -248,6 +248,8 @@ void MemNICFour::recvNotify(OrderedMemRtrEvent* mre) {
                 getName().c_str(), me->getSrc().c_str(), CommandString[(int)me->getCmd()]);
     }
 
+    MEMH_TRACE_MARK(me, Network, getCurrentSimCycle());
+
     // Call parent's handler
     (*recvHandler)(me);
 }
@@ -267,7 +269,7 @@ MemNICFour::OrderedMemRtrEvent* MemNICFour::processRecv(SimpleNetwork::Request *
             return smre;
         } else {
             InitMemRtrEvent *imre = static_cast<InitMemRtrEvent*>(mre);
-            if (networkAddressMap.find(imre->info.name) == networkAddressMap.end()) {
+            if (!hasNetworkAddress(EndpointRegistry::intern(imre->info.name))) {
                 dbg.fatal(CALL_INFO, -1, "%s (MemNIC), received information about previously unknown endpoint. This case is not handled. Endpoint name: %s\n",
                         getName().c_str(), imre->info.name.c_str());
             }
@@ -276,6 +278,7 @@ MemNICFour::OrderedMemRtrEvent* MemNICFour::processRecv(SimpleNetwork::Request *
             } 
             if (destIDs.find(imre->info.id) != destIDs.end()) {
                 destEndpointInfo.insert(imre->info);
+                rebuildDestIndex();
             }
             delete imre;
         }
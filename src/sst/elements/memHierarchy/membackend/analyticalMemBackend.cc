@@ -0,0 +1,199 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <sst/core/link.h>
+#include <cmath>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/analyticalMemBackend.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- Analytical Memory ------------------------------- */
+/* AnalyticalMemory sits between SimpleMemory and the cycle-level DRAM models. It has no
+ * clock handler: each request's completion time is computed when it arrives and the
+ * response is scheduled on a self link.
+ *
+ * For a request to a channel, the completion time is
+ *      arrival + bank wait + access latency, then the next free slot on the data bus
+ *
+ *  Access latency depends on the row buffer state
+ *      Open policy, row open: CL (CL_WR for writes)
+ *      Open policy, no row open: RCD + CL
+ *      Open policy, other row open: TRP + RCD + CL
+ *      Closed policy: RCD + CL, and the bank is occupied for a further TRP
+ *   With 'row_hit_rate' set, open-policy latency is the expected value for that hit rate
+ *   instead of being tracked per bank.
+ *
+ *  Bank wait treats a channel's banks as an M/D/c queue whose arrival rate and service
+ *  time are running averages over roughly 'rate_window' requests. Utilization is capped
+ *  below 1 so that bursts do not produce unbounded waits; sustained overload is bounded
+ *  instead by the data bus.
+ *
+ *  The data bus is modeled exactly: each request reserves 'dataCycles' on its channel's bus,
+ *  so channel bandwidth can never exceed one request per 'dataCycles'.
+ *
+ *  Addresses are interleaved across channels and then banks at 'interleave_size':
+ *      |...   Row   | Bank | Channel | Offset |
+ *  so each bank holds 'row_size' bytes of a row in every (channels * banks) interleave units.
+ */
+
+static const double maxUtilization = 0.98;
+
+AnalyticalMemory::AnalyticalMemory(ComponentId_t id, Params &params) : SimpleMemBackend(id, params){
+    int verbose = params.find<int>("verbose", 0);
+    output = new Output("AnalyticalMemory[@p:@l]: ", verbose, 0, Output::STDOUT);
+
+    std::string clock = params.find<std::string>("clock", "1.2GHz");
+    unsigned numChannels = params.find<unsigned>("channels", 1);
+    unsigned ranks = params.find<unsigned>("ranks", 1);
+    unsigned banks = params.find<unsigned>("banks", 8);
+    UnitAlgebra interleave(params.find<std::string>("interleave_size", "64B"));
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "1KiB"));
+    std::string policyStr = params.find<std::string>("row_policy", "open");
+    rowHitRate = params.find<double>("row_hit_rate", -1.0);
+    tCL = params.find<uint64_t>("CL", 11);
+    tCLWR = params.find<uint64_t>("CL_WR", tCL);
+    tRCD = params.find<uint64_t>("RCD", 11);
+    tRP = params.find<uint64_t>("TRP", 11);
+    dataCycles = params.find<uint64_t>("dataCycles", 4);
+    uint64_t window = params.find<uint64_t>("rate_window", 64);
+
+    // Check parameters
+    if (numChannels == 0 || ranks == 0 || banks == 0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): channels, ranks, and banks must all be at least 1. You specified %u, %u, and %u.\n", getName().c_str(), numChannels, ranks, banks);
+    }
+    if (policyStr != "closed" && policyStr != "open") {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_policy - must be 'closed' or 'open'. You specified '%s'.\n", getName().c_str(), policyStr.c_str());
+    }
+    openPolicy = (policyStr == "open");
+    if (rowHitRate > 1.0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_hit_rate - must be at most 1 (or negative to track open rows). You specified %f.\n", getName().c_str(), rowHitRate);
+    }
+    if (!interleave.hasUnits("B") || !isPowerOfTwo(interleave.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): interleave_size - must be a power of two with units of 'B' (bytes). You specified %s.\n", getName().c_str(), interleave.toString().c_str());
+    }
+    if (!rowSize.hasUnits("B") || !isPowerOfTwo(rowSize.getRoundedValue()) || rowSize.getRoundedValue() < interleave.getRoundedValue()) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two with units of 'B' (bytes), and at least interleave_size. You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (window == 0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): rate_window - must be at least 1.\n", getName().c_str());
+    }
+    lineOffset = log2Of(interleave.getRoundedValue());
+    rowOffset = log2Of(rowSize.getRoundedValue());
+    alpha = 1.0 / window;
+
+    banksPerChannel = ranks * banks;
+    channels.resize(numChannels);
+    for (Channel& chan : channels) {
+        chan.busFree = 0;
+        chan.lastArrival = 0;
+        chan.avgService = tRCD + tCL + dataCycles;
+        chan.avgGap = 2.0 * banksPerChannel * chan.avgService; // Idle
+        chan.openRow.assign(banksPerChannel, -1);
+    }
+
+    clockTC = getTimeConverter(clock);
+    self_link = configureSelfLink("Self", clockTC, new Event::Handler<AnalyticalMemory>(this, &AnalyticalMemory::handleSelfEvent));
+
+    statRowHit = registerStatistic<uint64_t>("row_hits");
+    statRowMiss = registerStatistic<uint64_t>("row_misses");
+    statQueueDelay = registerStatistic<uint64_t>("queue_delay");
+    statBusDelay = registerStatistic<uint64_t>("bus_delay");
+}
+
+void AnalyticalMemory::handleSelfEvent(SST::Event *event){
+    MemCtrlEvent *ev = static_cast<MemCtrlEvent*>(event);
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "%s: Transaction done for id %" PRIx64 "\n", getName().c_str(),ev->reqId);
+#endif
+    handleMemResponse(ev->reqId);
+    delete event;
+}
+
+/*
+ * Erlang C gives the probability that an arrival has to wait in an M/M/c queue; the
+ * M/M/c wait is that times service/(c - load). Deterministic service roughly halves it.
+ */
+double AnalyticalMemory::mdcWait(unsigned c, double load, double service) {
+    if (load <= 0.0)
+        return 0.0;
+    if (load > maxUtilization * c)
+        load = maxUtilization * c;
+
+    double erlangB = 1.0;
+    for (unsigned k = 1; k <= c; k++)
+        erlangB = load * erlangB / (k + load * erlangB);
+    double erlangC = c * erlangB / (c - load * (1.0 - erlangB));
+
+    return 0.5 * erlangC * service / (c - load);
+}
+
+bool AnalyticalMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned numBytes ){
+    SimTime_t now = getCurrentSimTime(clockTC);
+
+    Addr unit = addr >> lineOffset;
+    Channel& chan = channels[unit % channels.size()];
+    unit /= channels.size();
+    unsigned bank = unit % banksPerChannel;
+    int64_t row = (addr >> rowOffset) / (channels.size() * banksPerChannel);
+
+    // Access latency & bank occupancy
+    double access = isWrite ? tCLWR : tCL;
+    double occupancy = dataCycles;
+    if (!openPolicy) {
+        access += tRCD;
+        occupancy += tRP;
+    } else if (rowHitRate >= 0.0) {
+        access += (1.0 - rowHitRate) * (tRP + tRCD);
+    } else if (chan.openRow[bank] == row) {
+        statRowHit->addData(1);
+    } else {
+        access += (chan.openRow[bank] == -1) ? tRCD : tRP + tRCD;
+        chan.openRow[bank] = row;
+        statRowMiss->addData(1);
+    }
+    occupancy += access;
+
+    // Update running averages. Gaps are capped at a length that leaves the banks mostly idle,
+    // so that a long quiet period does not hide the load of the burst that follows it.
+    double gap = now - chan.lastArrival;
+    double idleGap = 2.0 * banksPerChannel * chan.avgService;
+    chan.avgGap += alpha * ((gap < idleGap ? gap : idleGap) - chan.avgGap);
+    chan.lastArrival = now;
+    chan.avgService += alpha * (occupancy - chan.avgService);
+
+    // Wait for a bank
+    double load = chan.avgGap > 0.0 ? chan.avgService / chan.avgGap : maxUtilization * banksPerChannel;
+    SimTime_t queueDelay = std::llround(mdcWait(banksPerChannel, load, chan.avgService));
+
+    // Wait for the data bus
+    SimTime_t ready = now + queueDelay + std::llround(access);
+    SimTime_t start = ready > chan.busFree ? ready : chan.busFree;
+    chan.busFree = start + dataCycles;
+
+    statQueueDelay->addData(queueDelay);
+    statBusDelay->addData(start - ready);
+
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "%s: Issued transaction for address %" PRIx64 " id %" PRIx64 ", bank %u row %" PRId64 ", queue %" PRIu64 " access %.1f bus %" PRIu64 "\n",
+            getName().c_str(), (Addr)addr, id, bank, row, queueDelay, access, start - ready);
+#endif
+
+    self_link->send(chan.busFree - now, new MemCtrlEvent(id));
+    return true;
+}
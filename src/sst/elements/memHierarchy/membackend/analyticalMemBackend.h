@@ -0,0 +1,126 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_ANALYTICAL_MEM_BACKEND
+#define _H_SST_MEMH_ANALYTICAL_MEM_BACKEND
+
+#include <vector>
+
+#include "sst/elements/memHierarchy/membackend/memBackend.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+class AnalyticalMemory : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT(AnalyticalMemory, "memHierarchy", "analyticalMem", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Unclocked DRAM model that computes each request's latency on arrival from a queueing approximation of bank and channel contention", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"verbose",         "(uint) Sets the verbosity of the backend output", "0" },
+            {"clock",           "(string) DRAM clock frequency or period; all latencies are in these cycles", "1.2GHz"},
+            {"channels",        "(uint) Number of channels", "1"},
+            {"ranks",           "(uint) Number of ranks per channel", "1"},
+            {"banks",           "(uint) Number of banks per rank", "8"},
+            {"interleave_size", "(string) Granularity of channel and bank interleaving. Must be a power of 2.", "64B"},
+            {"row_size",        "(string) Size of a row in bytes (B). Must be a power of 2.", "1KiB"},
+            {"row_policy",      "(string) Policy for managing the row buffer - open or closed.", "open"},
+            {"row_hit_rate",    "(float) Fixed row buffer hit rate to assume with an open row policy, between 0 and 1. If negative, hits are determined by tracking the open row in each bank.", "-1"},
+            {"CL",              "(uint) Column read latency in cycles", "11"},
+            {"CL_WR",           "(uint) Column write latency in cycles", "CL"},
+            {"RCD",             "(uint) Row activate latency in cycles", "11"},
+            {"TRP",             "(uint) Row precharge latency in cycles", "11"},
+            {"dataCycles",      "(uint) Cycles a request occupies the channel data bus", "4"},
+            {"rate_window",     "(uint) Approximate number of requests over which the arrival rate and service time are averaged", "64"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"row_hits",        "Number of requests that found their row open (only counted when tracking open rows)", "count", 1},
+            {"row_misses",      "Number of requests that had to open their row (only counted when tracking open rows)", "count", 1},
+            {"queue_delay",     "Modeled wait for a bank, in cycles", "cycles", 1},
+            {"bus_delay",       "Wait for the channel data bus, in cycles", "cycles", 1} )
+
+/* Begin class definition */
+    AnalyticalMemory();
+    AnalyticalMemory(ComponentId_t id, Params &params);
+    bool issueRequest( ReqId, Addr, bool, unsigned );
+    bool isClocked() { return false; }
+
+    class MemCtrlEvent : public SST::Event {
+    public:
+        MemCtrlEvent( ReqId id_) : SST::Event(), reqId(id_)
+        { }
+
+        ReqId reqId;
+
+    private:
+        MemCtrlEvent() {} // For Serialization only
+
+    public:
+        void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+            Event::serialize_order(ser);
+            ser & reqId;  // Cannot serialize pointers unless they are a serializable object
+       }
+
+        ImplementSerializable(SST::MemHierarchy::AnalyticalMemory::MemCtrlEvent);
+    };
+
+private:
+    void handleSelfEvent(SST::Event *event);
+
+    /* Expected wait in an M/D/c queue with c servers, offered load 'load' (arrival rate * service time), and service time 'service' */
+    static double mdcWait(unsigned c, double load, double service);
+
+    struct Channel {
+        SimTime_t busFree;          // Cycle at which the data bus is next free
+        SimTime_t lastArrival;
+        double avgGap;              // Average cycles between arrivals
+        double avgService;          // Average bank service time
+        std::vector<int64_t> openRow;   // Per bank, -1 if no row is open
+    };
+
+    Link * self_link;
+    TimeConverter * clockTC;
+
+    std::vector<Channel> channels;
+    unsigned banksPerChannel;
+
+    // Mapping parameters
+    uint64_t lineOffset;
+    uint64_t rowOffset;
+
+    // Timing parameters
+    uint64_t tCL;
+    uint64_t tCLWR;
+    uint64_t tRCD;
+    uint64_t tRP;
+    uint64_t dataCycles;
+
+    bool openPolicy;
+    double rowHitRate;  // < 0: track open rows
+    double alpha;       // Averaging weight, 1/rate_window
+
+    Statistic<uint64_t> * statRowHit;
+    Statistic<uint64_t> * statRowMiss;
+    Statistic<uint64_t> * statQueueDelay;
+    Statistic<uint64_t> * statBusDelay;
+};
+
+}
+}
+
+#endif
@@ -19,6 +19,11 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <sst/core/output.h>
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST {
@@ -31,10 +36,100 @@ public:
     virtual ~Backing() { }
 
     virtual void set( Addr addr, uint8_t value ) = 0;
-    virtual void set( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
-
     virtual uint8_t get( Addr addr) = 0;
-    virtual void get( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
+
+    /* Copy 'size' bytes between the backing store and a caller's buffer, e.g., an event payload */
+    virtual void set( Addr addr, size_t size, const uint8_t* data ) = 0;
+    virtual void get( Addr addr, size_t size, uint8_t* data ) = 0;
+
+    void set( Addr addr, size_t size, const std::vector<uint8_t>& data ) { set(addr, size, data.data()); }
+    void get( Addr addr, size_t size, std::vector<uint8_t>& data ) { get(addr, size, data.data()); }
+
+    /* Whether [addr, addr+size) lies within the range this backing can hold */
+    virtual bool contains( Addr addr, size_t size ) = 0;
+
+    /*
+     * Snapshot the contents of the backing store to a file, or load a snapshot back in.
+     * The file is a header followed by (address, length, bytes) records in host byte order.
+     * Snapshots are therefore only portable between hosts of the same endianness; restoring
+     * one written on a host of the other endianness fails the version check.
+     * All-zero regions are skipped, so the file size tracks the memory actually touched.
+     * A snapshot can be restored into any backing type as long as the addresses fit.
+     */
+    void dump( const std::string& file ) {
+        FILE* fp = fopen(file.c_str(), "wb");
+        if (!fp) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "Backing: Error - unable to open '%s' to write a memory snapshot.\n", file.c_str());
+        }
+        uint64_t version = snapshotVersion;
+        fwrite(snapshotMagic, 1, sizeof(snapshotMagic), fp);
+        fwrite(&version, sizeof(version), 1, fp);
+        dumpRegions(fp);
+        if (fclose(fp) != 0) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "Backing: Error - failed writing memory snapshot '%s'.\n", file.c_str());
+        }
+    }
+
+    void restore( const std::string& file ) {
+        Output out("", 1, 0, Output::STDOUT);
+        FILE* fp = fopen(file.c_str(), "rb");
+        if (!fp)
+            out.fatal(CALL_INFO, -1, "Backing: Error - unable to open memory snapshot '%s'.\n", file.c_str());
+
+        char magic[sizeof(snapshotMagic)];
+        uint64_t version;
+        if (fread(magic, 1, sizeof(magic), fp) != sizeof(magic) || memcmp(magic, snapshotMagic, sizeof(magic)) != 0 ||
+                fread(&version, sizeof(version), 1, fp) != 1 || version != snapshotVersion)
+            out.fatal(CALL_INFO, -1, "Backing: Error - '%s' is not a memory snapshot or was written by an incompatible version.\n", file.c_str());
+
+        /* Records are checked before anything is allocated or written so a stale or foreign snapshot cannot
+         * write outside the backing or make us allocate more than the file holds */
+        long start = ftell(fp);
+        fseek(fp, 0, SEEK_END);
+        uint64_t remaining = ftell(fp) - start;
+        fseek(fp, start, SEEK_SET);
+
+        std::vector<uint8_t> data;
+        uint64_t record[2]; // Address, length
+        while (fread(record, sizeof(uint64_t), 2, fp) == 2) {
+            remaining -= sizeof(record);
+            if (record[1] > remaining)
+                out.fatal(CALL_INFO, -1, "Backing: Error - memory snapshot '%s' is truncated.\n", file.c_str());
+            if (!contains(record[0], record[1]))
+                out.fatal(CALL_INFO, -1, "Backing: Error - memory snapshot '%s' has a record at 0x%" PRIx64 " of %" PRIu64 " bytes that is outside this memory.\n",
+                        file.c_str(), record[0], record[1]);
+            data.resize(record[1]);
+            if (fread(data.data(), 1, record[1], fp) != record[1])
+                out.fatal(CALL_INFO, -1, "Backing: Error - memory snapshot '%s' is truncated.\n", file.c_str());
+            remaining -= record[1];
+            set(record[0], record[1], data);
+        }
+        fclose(fp);
+    }
+
+protected:
+    /* Write every non-zero region with writeRegion() */
+    virtual void dumpRegions( FILE* fp ) = 0;
+
+    /* Write [data, data+size) at addr, splitting into chunks and dropping the all-zero ones */
+    static void writeRegion( FILE* fp, Addr addr, const uint8_t* data, size_t size ) {
+        const size_t chunk = 4096;
+        for (size_t offset = 0; offset < size; offset += chunk) {
+            size_t len = std::min(chunk, size - offset);
+            const uint8_t* ptr = data + offset;
+            if (std::all_of(ptr, ptr + len, [](uint8_t b) { return b == 0; }))
+                continue;
+            uint64_t record[2] = { addr + offset, len };
+            fwrite(record, sizeof(uint64_t), 2, fp);
+            fwrite(ptr, 1, len, fp);
+        }
+    }
+
+private:
+    static constexpr char snapshotMagic[8] = { 'S', 'S', 'T', 'M', 'E', 'M', 'H', 'B' };
+    static constexpr uint64_t snapshotVersion = 1;
 };
 
 class BackingMMAP : public Backing {
@@ -63,116 +158,200 @@ public:
         }
     }
 
+    using Backing::set;
+    using Backing::get;
+
     void set( Addr addr, uint8_t value ) {
         m_buffer[addr - m_offset ] = value;
     }
 
-    void set (Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            m_buffer[addr + i] = data[i];
+    void set( Addr addr, size_t size, const uint8_t* data ) {
+        memcpy(m_buffer + (addr - m_offset), data, size);
     }
 
     uint8_t get( Addr addr ) {
         return m_buffer[addr - m_offset];
     }
 
-    void get( Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            data[i] = m_buffer[addr + i];
+    bool contains( Addr addr, size_t size ) {
+        return addr >= m_offset && size <= m_size && addr - m_offset <= m_size - size;
+    }
+
+    void get( Addr addr, size_t size, uint8_t* data ) {
+        memcpy(data, m_buffer + (addr - m_offset), size);
+    }
+
+protected:
+    void dumpRegions( FILE* fp ) {
+        writeRegion(fp, m_offset, m_buffer, m_size);
     }
 
 private:
     uint8_t* m_buffer;
     int m_fd;
-    int m_size;
+    size_t m_size;
     size_t m_offset;
 };
 
+/*
+ * Sparse backing store
+ * Memory is allocated in units of 'size' bytes (a power of two) on first write.
+ * Units are found through a radix tree indexed by addr / size whose height grows
+ * to cover the highest unit touched, so lookups take a few array indexes
+ * regardless of how large or sparse the address space is.
+ * Units that have never been written read as zero without being allocated.
+ */
 class BackingMalloc : public Backing {
 public:
-    BackingMalloc(size_t size, bool init = false ) : m_init(init) {
+    /* Units are zero-filled when allocated so unwritten memory always reads as zero */
+    BackingMalloc(size_t size) : m_root(nullptr), m_height(0), m_lastIndex(0), m_lastUnit(nullptr) {
         m_allocUnit = size;
         /* Alloc unit needs to be pwr-2 */
-        if (!isPowerOfTwo(m_allocUnit)) {
+        if (m_allocUnit == 0 || (m_allocUnit & (m_allocUnit - 1)) != 0) {
             Output out("", 1, 0, Output::STDOUT);
             out.fatal(CALL_INFO, -1, "BackingMalloc: Error - size must be a power of two. Got: %zu\n", size);
         }
-        m_shift = log2Of(m_allocUnit);
+        m_shift = __builtin_ctzll(m_allocUnit);
     }
 
+    ~BackingMalloc() {
+        freeTree(m_root, m_height);
+    }
+
+    using Backing::set;
+    using Backing::get;
+
     void set( Addr addr, uint8_t value ) {
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
-        allocIfNeeded(bAddr);
-        m_buffer[bAddr][offset] = value;
+        findUnit(addr >> m_shift, true)[addr & (m_allocUnit - 1)] = value;
     }
 
-    void set( Addr addr, size_t size, std::vector<uint8_t> &data ) {
+    void set( Addr addr, size_t size, const uint8_t* data ) {
         /* Account for size exceeding alloc unit size */
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
         size_t dataOffset = 0;
-
-        allocIfNeeded(bAddr);
-
         while (dataOffset != size) {
-            m_buffer[bAddr][offset] = data[dataOffset];
-            offset++;
-            dataOffset++;
-
-            if (offset == m_allocUnit) {
-                offset = 0;
-                bAddr++;
-                allocIfNeeded(bAddr);
-            }
+            Addr offset = addr & (m_allocUnit - 1);
+            size_t len = std::min(size - dataOffset, (size_t)(m_allocUnit - offset));
+            memcpy(findUnit(addr >> m_shift, true) + offset, data + dataOffset, len);
+            addr += len;
+            dataOffset += len;
         }
     }
 
-    void get (Addr addr, size_t size, std::vector<uint8_t> &data) {
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
+    void get( Addr addr, size_t size, uint8_t* data ) {
         size_t dataOffset = 0;
-
-        allocIfNeeded(bAddr);
-
         while (dataOffset != size) {
-            data[dataOffset] = m_buffer[bAddr][offset];
-            offset++;
-            dataOffset++;
-            if (offset == m_allocUnit) {
-                bAddr++;
-                offset = 0;
-                allocIfNeeded(bAddr);
-            }
+            Addr offset = addr & (m_allocUnit - 1);
+            size_t len = std::min(size - dataOffset, (size_t)(m_allocUnit - offset));
+            uint8_t* unit = findUnit(addr >> m_shift, false);
+            if (unit)
+                memcpy(data + dataOffset, unit + offset, len);
+            else
+                memset(data + dataOffset, 0, len);
+            addr += len;
+            dataOffset += len;
         }
     }
 
     uint8_t get( Addr addr ) {
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
-        allocIfNeeded(bAddr);
-        return m_buffer[bAddr][offset];
+        uint8_t* unit = findUnit(addr >> m_shift, false);
+        return unit ? unit[addr & (m_allocUnit - 1)] : 0;
+    }
+
+    /* Any address can be held; only a range that wraps past the top of the address space is rejected */
+    bool contains( Addr addr, size_t size ) {
+        return size == 0 || addr + (size - 1) >= addr;
+    }
+
+protected:
+    void dumpRegions( FILE* fp ) {
+        dumpTree(fp, m_root, m_height, 0);
     }
 
 private:
-    void allocIfNeeded(Addr bAddr) {
-        if (m_buffer.find(bAddr) == m_buffer.end()) {
-            uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*m_allocUnit);
-            if ( m_init ) {
-                bzero( data, m_allocUnit );
+    static constexpr unsigned int radixBits = 6;
+    static constexpr size_t radixFanout = 1 << radixBits;
+
+    struct Node {
+        Node() { std::fill(child, child + radixFanout, nullptr); }
+        void* child[radixFanout]; // Node* above the bottom level, unit data at the bottom
+    };
+
+    /* Whether a tree of the given height can hold unit 'index' */
+    static bool covers(unsigned int height, Addr index) {
+        return height * radixBits >= 64 || (index >> (height * radixBits)) == 0;
+    }
+
+    uint8_t* findUnit(Addr index, bool alloc) {
+        if (m_lastUnit && index == m_lastIndex)
+            return m_lastUnit;
+
+        if (!covers(m_height, index)) {
+            if (!alloc)
+                return nullptr;
+            while (!covers(m_height, index)) { // Grow the tree upward; the old root becomes child 0
+                if (m_root) {
+                    Node* node = new Node();
+                    node->child[0] = m_root;
+                    m_root = node;
+                }
+                m_height++;
             }
-            if (!data) {
+        }
+
+        void** slot = &m_root;
+        for (unsigned int level = m_height; level > 0; level--) {
+            if (!*slot) {
+                if (!alloc)
+                    return nullptr;
+                *slot = new Node();
+            }
+            slot = &(static_cast<Node*>(*slot)->child[(index >> ((level - 1) * radixBits)) & (radixFanout - 1)]);
+        }
+        if (!*slot) {
+            if (!alloc)
+                return nullptr;
+            *slot = calloc(m_allocUnit, 1);
+            if (!*slot) {
                 Output out("", 1, 0, Output::STDOUT);
                 out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
             }
-            m_buffer[bAddr] = data;
         }
+        m_lastIndex = index;
+        m_lastUnit = static_cast<uint8_t*>(*slot);
+        return m_lastUnit;
+    }
+
+    void freeTree(void* ptr, unsigned int height) {
+        if (!ptr)
+            return;
+        if (height == 0) {
+            free(ptr);
+            return;
+        }
+        Node* node = static_cast<Node*>(ptr);
+        for (size_t i = 0; i < radixFanout; i++)
+            freeTree(node->child[i], height - 1);
+        delete node;
+    }
+
+    void dumpTree(FILE* fp, void* ptr, unsigned int height, Addr index) {
+        if (!ptr)
+            return;
+        if (height == 0) {
+            writeRegion(fp, index << m_shift, static_cast<uint8_t*>(ptr), m_allocUnit);
+            return;
+        }
+        Node* node = static_cast<Node*>(ptr);
+        for (size_t i = 0; i < radixFanout; i++)
+            dumpTree(fp, node->child[i], height - 1, (index << radixBits) | i);
     }
 
-    std::unordered_map<Addr,uint8_t*> m_buffer;
-    unsigned int m_allocUnit;
+    void* m_root;
+    unsigned int m_height;      // Levels of Nodes above the units
+    Addr m_lastIndex;           // Most recently used unit, to skip the walk for streaming accesses
+    uint8_t* m_lastUnit;
+    Addr m_allocUnit;
     unsigned int m_shift;
-    bool m_init;
 };
 
 }
@@ -121,6 +121,8 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
             m_requestQueue.pop_front();
+            if (req->isMemEv())
+                unlinkQueuedLine(static_cast<MemReq*>(req));
         }
     }
 
@@ -197,23 +199,15 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             doResponseStat( event->getCmd(), latency );
 
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
             sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
 
             // TODO clock responses
-            // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), flush->getFlags());
-                        m_waitingFlushes.erase(flush);
-                    }
+            // Complete any flushes that were only waiting on this event
+            for (WaitingFlush* flush : static_cast<MemReq*>(req)->m_flushes) {
+                if (--flush->pending == 0) {
+                    sendResponse(flush->flush->getID(), flush->flush->getFlags());
+                    delete flush;
                 }
-                m_dependentRequests.erase(evID);
             }
         }
         delete req;
@@ -17,6 +17,10 @@
 #ifndef __SST_MEMH_MEMBACKENDCONVERTOR__
 #define __SST_MEMH_MEMBACKENDCONVERTOR__
 
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
 #include <sst/core/subcomponent.h>
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
@@ -111,10 +115,17 @@ class MemBackendConvertor : public SubComponent {
 
     };
 
+    /* A FlushLine/FlushLineInv waiting for the requests to its line that were queued ahead of it */
+    struct WaitingFlush {
+        MemEvent* flush;
+        uint32_t pending;   // Requests not yet complete
+    };
+
     class MemReq : public BaseReq {
+        friend class MemBackendConvertor;
       public:
         MemReq( MemEvent* event, uint32_t reqId ) : BaseReq(reqId, BaseReq::ReqType::MEM),
-            m_event(event), m_offset(0), m_numReq(0) { }
+            m_event(event), m_offset(0), m_numReq(0), m_prevOnLine(nullptr), m_nextOnLine(nullptr) { }
         ~MemReq() { }
 
         static uint32_t getBaseId( ReqId id) { return id >> 32; }
@@ -151,6 +162,11 @@ class MemBackendConvertor : public SubComponent {
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+
+        // Links in the list of queued requests to the same line (see m_queuedLines)
+        MemReq*     m_prevOnLine;
+        MemReq*     m_nextOnLine;
+        std::vector<WaitingFlush*> m_flushes; // Flushes waiting on this request, in event ID order
     };
 
   public:
@@ -182,6 +198,16 @@ class MemBackendConvertor : public SubComponent {
     // such that all the requests are consolidated in one place
   protected:
     virtual ~MemBackendConvertor() {
+        std::set<WaitingFlush*> flushes;
+        for (auto& pending : m_pendingRequests) {
+            if (pending.second->isMemEv()) {
+                MemReq* mr = static_cast<MemReq*>(pending.second);
+                flushes.insert(mr->m_flushes.begin(), mr->m_flushes.end());
+            }
+        }
+        for (WaitingFlush* flush : flushes)
+            delete flush;
+
         while ( m_requestQueue.size()) {
             delete m_requestQueue.front();
             m_requestQueue.pop_front();
@@ -204,27 +230,18 @@ class MemBackendConvertor : public SubComponent {
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
-                }
+            // A flush completes once every request to its line that is still queued has completed
+            auto line = m_queuedLines.find(ev->getBaseAddr());
+            if (line == m_queuedLines.end()) return false;
+
+            WaitingFlush* flush = new WaitingFlush{ev, 0};
+            memEventCmp cmp;
+            for (MemReq* mr = line->second.head; mr != nullptr; mr = mr->m_nextOnLine) {
+                auto pos = std::upper_bound(mr->m_flushes.begin(), mr->m_flushes.end(), flush,
+                        [&cmp](const WaitingFlush* a, const WaitingFlush* b) { return cmp(a->flush, b->flush); });
+                mr->m_flushes.insert(pos, flush);
+                flush->pending++;
             }
-
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
             return true;
         }
 
@@ -232,9 +249,31 @@ class MemBackendConvertor : public SubComponent {
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
         m_pendingRequests[id] = req;
+        linkQueuedLine(req);
         return true;
     }
 
+    /* Add/remove a request from the per-line list of queued requests */
+    void linkQueuedLine( MemReq* req ) {
+        QueuedLine& line = m_queuedLines[req->baseAddr()];
+        req->m_prevOnLine = line.tail;
+        req->m_nextOnLine = nullptr;
+        if (line.tail) line.tail->m_nextOnLine = req;
+        else           line.head = req;
+        line.tail = req;
+    }
+
+    void unlinkQueuedLine( MemReq* req ) {
+        auto line = m_queuedLines.find(req->baseAddr());
+        if (req->m_prevOnLine) req->m_prevOnLine->m_nextOnLine = req->m_nextOnLine;
+        else                   line->second.head = req->m_nextOnLine;
+        if (req->m_nextOnLine) req->m_nextOnLine->m_prevOnLine = req->m_prevOnLine;
+        else                   line->second.tail = req->m_prevOnLine;
+        req->m_prevOnLine = req->m_nextOnLine = nullptr;
+        if (line->second.head == nullptr)
+            m_queuedLines.erase(line);
+    }
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);
     }
@@ -303,8 +342,12 @@ class MemBackendConvertor : public SubComponent {
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    struct QueuedLine {
+        MemReq* head;
+        MemReq* tail;
+        QueuedLine() : head(nullptr), tail(nullptr) { }
+    };
+    std::unordered_map<Addr, QueuedLine> m_queuedLines; // Requests in m_requestQueue, listed by line, for flush dependences
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
@@ -22,7 +22,7 @@ bool TimingDRAM::Channel::m_printConfig = true;
 bool TimingDRAM::Rank::m_printConfig = true;
 bool TimingDRAM::Bank::m_printConfig = true;
 
-TimingDRAM::TimingDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id, params), m_cycle(0) { 
+TimingDRAM::TimingDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id, params), m_cycle(0), m_started(false), m_firstCycle(0) { 
 
     int dram_id = params.find<int>("id", -1);
     assert( dram_id != -1 );
@@ -45,12 +45,14 @@ TimingDRAM::TimingDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id,
     }
 
     int numChannels = params.find<int>("channels", 1);
+    m_eventDriven = params.find<bool>("event_driven", false);
 
     if (m_printConfig)
         m_printConfig = params.find<bool>("printconfig", true);
     if ( m_printConfig ) {
         output->verbose(CALL_INFO, 1, DBG_MASK, "number of channels: %d\n",numChannels);
         output->verbose(CALL_INFO, 1, DBG_MASK, "address mapper:     %s\n",addrMapper.c_str());
+        output->verbose(CALL_INFO, 1, DBG_MASK, "event driven:       %s\n",m_eventDriven ? "yes" : "no");
         m_printConfig = false;
     }
 
@@ -67,7 +69,12 @@ bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBy
 {
     unsigned chan = m_mapper->getChannel(addr);
 
-    bool ret = m_channels[chan]->issue(m_cycle, id, addr, isWrite, numBytes );
+    Transaction* trans = m_channels[chan]->issue(m_cycle, id, addr, isWrite, numBytes );
+    bool ret = (trans != nullptr);
+
+    // While the clock is off m_cycle is stale, so the create time is filled in by the next clock()
+    if ( ret && m_eventDriven )
+        m_unstamped.push_back(trans);
 
     if ( ret ) {
         output->verbose(CALL_INFO, 2, DBG_MASK, "chan=%d reqId=%" PRIu64 " addr=%#" PRIx64 "\n",chan,id,addr);
@@ -77,14 +84,38 @@ bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBy
     return ret;
 }
 
+/*
+ * Channels with nothing to retire, respond to, or issue are skipped. That is exact: clocking
+ * such a channel changes no state.
+ *
+ * In event-driven mode, the clock may also be turned off once every channel is idle. The
+ * local cycle is then derived from the controller's cycle rather than counted, so that it
+ * advances across the off period exactly as it would have if the clock had kept running.
+ */
 bool TimingDRAM::clock(Cycle_t cycle)
 {
+    if ( m_eventDriven ) {
+        if ( ! m_started ) {
+            m_firstCycle = cycle;
+            m_started = true;
+        }
+        m_cycle = cycle - m_firstCycle;
+        for ( Transaction* trans : m_unstamped ) {
+            trans->createTime = m_cycle;
+        }
+        m_unstamped.clear();
+    }
+
     output->verbose(CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",m_cycle);
+    bool idle = true;
     for ( unsigned i = 0; i < m_channels.size(); i++ ) {
-        m_channels[i]->clock(m_cycle);
+        if ( m_channels[i]->needsClock(m_cycle) ) {
+            m_channels[i]->clock(m_cycle);
+        }
+        idle = idle && m_channels[i]->isIdle();
     }
     ++m_cycle;
-    return false;
+    return m_eventDriven && idle;
 }
 
 //==================================================================================
@@ -92,7 +123,8 @@ bool TimingDRAM::clock(Cycle_t cycle)
 //==================================================================================
 
 TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handler, Params& params, unsigned mc, unsigned myNum, Output* output, AddrMapper* mapper ) :
-    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0)
+    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0),
+    m_issueSeq(0), m_activeRanks(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Channel:@p():@l:mc=" << mc << ":chan=" << myNum << ": ";
@@ -124,26 +156,20 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     if (is_debug)
         m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",cycle);
 
-    std::list<Cmd*>::iterator iter = m_issuedCmds.begin();
+    /* Retire finished commands, in issue order */
+    while ( ! m_issuedCmds.empty() && m_issuedCmds.top().retire <= cycle ) {
+        Cmd* cmd = m_issuedCmds.top().cmd;
+        m_issuedCmds.pop();
 
-    /* Check all outstanding commands to see if anything is finished */
-    while ( iter != m_issuedCmds.end() ) {
-        if ( (*iter)->isDone(cycle) ) {
-            Cmd* cmd = (*iter);
-
-            if (is_debug)
-                m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
-                        cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
-
-            if (cmd->getTrans() != nullptr) {
-                m_retiredTrans.push(cmd->getTrans());
-            }
+        if (is_debug)
+            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
+                    cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
 
-            delete (*iter);
-            iter = m_issuedCmds.erase(iter);
-        } else {
-            ++iter;
+        if (cmd->getTrans() != nullptr) {
+            m_retiredTrans.push(cmd->getTrans());
         }
+
+        delete cmd;
     }
 
     /* Return a response if possible */
@@ -168,7 +194,13 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
 
         m_dataBusAvailCycle = cmd->issue();
 
-        m_issuedCmds.push_back(cmd);
+        m_issuedCmds.push( IssuedCmd{ cmd->getRetireCycle(), m_issueSeq++, cmd } );
+    }
+
+    m_activeRanks = 0;
+    for ( Rank* rank : m_ranks ) {
+        if ( rank->hasActiveBanks() )
+            m_activeRanks++;
     }
 }
 
@@ -233,27 +265,30 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     if (is_debug)
         m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "\n" );
 
-    unsigned current = m_nextBankUp;
-    for ( unsigned i = 0; i < m_banks.size(); i++ ) {
-        if (m_banksActive.find(current) != m_banksActive.end()) {
-            Cmd* cmd = m_banks[current]->popCmd( cycle, dataBusAvailCycle );
+    /* Visit active banks in round-robin order starting from m_nextBankUp; idle banks are not touched */
+    std::set<unsigned>::iterator iter = m_banksActive.lower_bound( m_nextBankUp );
+    size_t numActive = m_banksActive.size();
+    for ( size_t i = 0; i < numActive; i++ ) {
+        if ( iter == m_banksActive.end() )
+            iter = m_banksActive.begin();
+        unsigned current = *iter;
 
-            if (m_banks[current]->isIdle())
-                m_banksActive.erase(current);
+        Cmd* cmd = m_banks[current]->popCmd( cycle, dataBusAvailCycle );
 
-            if ( cmd ) {
-                if ( current == m_nextBankUp ) {
-                    ++m_nextBankUp;
-                    m_nextBankUp %= m_banks.size();
-                    if (is_debug)
-                        m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK, "rank %d next up\n",m_nextBankUp);
-                }
-                return cmd;
+        if (m_banks[current]->isIdle())
+            iter = m_banksActive.erase(iter);
+        else
+            ++iter;
+
+        if ( cmd ) {
+            if ( current == m_nextBankUp ) {
+                ++m_nextBankUp;
+                m_nextBankUp %= m_banks.size();
+                if (is_debug)
+                    m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK, "rank %d next up\n",m_nextBankUp);
             }
+            return cmd;
         }
-
-        ++current;
-        current %= m_banks.size();
     }
     return nullptr;
 }
@@ -42,6 +42,7 @@ public:
             {"printconfig", "Print configuration at start", "true"},
             {"addrMapper", "Address map subcomponent", "memHierarchy.simpleAddrMapper"},
             {"channels", "Number of channels", "1"},
+            {"event_driven", "Let the memory controller turn its clock off while the DRAM is idle. Timing is the same as with polling every cycle.", "false"},
             {"channel.numRanks", "Number of ranks per channel", "1"},
             {"channel.transaction_Q_size", "Size of transaction queue", "32"},
             {"channel.rank.numBanks", "Number of banks per rank", "8"},
@@ -209,6 +210,11 @@ private:
             return ( now >= m_finiTime );
         }
 
+        /* First cycle on which the channel will find this command done (it is not checked on its issue cycle) */
+        SimTime_t getRetireCycle() {
+            return m_finiTime > m_issueTime ? m_finiTime : m_issueTime + 1;
+        }
+
         // these are used for debugging
         std::string& getName()  { return m_name; }
         unsigned getRank()      { return m_bank->getRank(); }
@@ -277,10 +283,10 @@ private:
 
         Channel( ComponentId_t, std::function<void(ReqId)>, Params&, unsigned mc, unsigned chan, Output*, AddrMapper* );
 
-        bool issue( SimTime_t createTime, ReqId id, Addr addr, bool isWrite, unsigned numBytes ) {
+        Transaction* issue( SimTime_t createTime, ReqId id, Addr addr, bool isWrite, unsigned numBytes ) {
 
             if ( m_maxPendingTrans == m_pendingCount ) {
-                return false;
+                return nullptr;
             }
 
             unsigned rank = m_mapper->getRank( addr);
@@ -292,11 +298,23 @@ private:
                                                 m_mapper->getRow(addr) );
             m_pendingCount++;
             m_ranks[ rank ]->pushTrans( trans );
-            return true;
+            m_activeRanks++;
+            return trans;
         }
 
         void clock(SimTime_t );
 
+        /* Whether clock() would do anything this cycle. If not, the cycle can be skipped. */
+        bool needsClock( SimTime_t cycle ) {
+            return m_activeRanks != 0 || !m_retiredTrans.empty() ||
+                (!m_issuedCmds.empty() && m_issuedCmds.top().retire <= cycle);
+        }
+
+        /* Whether the channel has any work at all, issued or not */
+        bool isIdle() {
+            return m_pendingCount == 0 && m_issuedCmds.empty() && !needsClock(0);
+        }
+
       private:
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
         const char* prefix() { return m_pre.c_str(); }
@@ -311,7 +329,18 @@ private:
         unsigned            m_maxPendingTrans;
         unsigned            m_pendingCount;
 
-        std::list<Cmd*>     m_issuedCmds;
+        /* Issued commands ordered by the cycle they retire on, then by issue order */
+        struct IssuedCmd {
+            SimTime_t retire;
+            uint64_t seq;
+            Cmd* cmd;
+            bool operator>( const IssuedCmd& other ) const {
+                return retire != other.retire ? retire > other.retire : seq > other.seq;
+            }
+        };
+        std::priority_queue<IssuedCmd, std::vector<IssuedCmd>, std::greater<IssuedCmd> > m_issuedCmds;
+        uint64_t            m_issueSeq;
+        unsigned            m_activeRanks;  // Upper bound on ranks with active banks, recomputed each clock()
         std::queue<Transaction*> m_retiredTrans;
 
         std::function<void(ReqId)> m_responseHandler;
@@ -335,6 +364,11 @@ private:
     AddrMapper* m_mapper;
     SimTime_t   m_cycle;
 
+    bool        m_eventDriven;
+    bool        m_started;
+    Cycle_t     m_firstCycle;
+    std::vector<Transaction*> m_unstamped;  // Accepted since the last clock(), see issueRequest()
+
 };
 
 }
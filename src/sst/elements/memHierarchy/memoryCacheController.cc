@@ -58,6 +58,7 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
     dlevel = params.find<int>("debug_level", 0);
 
     lineSize_ = params.find<uint64_t>("cache_line_size", 64);
+    nameID_ = EndpointRegistry::intern(getName());
 
     // Output for debug
     dbg.init("", dlevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
@@ -438,17 +439,17 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
     switch (it->second.status) {
         case AccessStatus::MISS_WB:
             /* Write back data to memory */
-            remoteWr = new MemEvent(getName(), blockAddr, blockAddr, Command::PutM, lineSize_);
+            remoteWr = new MemEvent(nameID_, blockAddr, blockAddr, Command::PutM, lineSize_);
             readData(remoteWr);
             remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
-            remoteWr->setDst(link_->getTargetDestination(remoteWr->getBaseAddr()));
+            remoteWr->setDstID(link_->getTargetDestinationID(remoteWr->getBaseAddr()));
             link_->send(remoteWr);
         case AccessStatus::MISS:
             /* Read new data from memory */
             remoteRd = new MemEvent(*ev);
             remoteRd->setCmd(Command::GetS);
-            remoteRd->setSrc(getName());
-            remoteRd->setDst(link_->getTargetDestination(remoteRd->getBaseAddr()));
+            remoteRd->setSrcID(nameID_);
+            remoteRd->setDstID(link_->getTargetDestinationID(remoteRd->getBaseAddr()));
             if (remoteRd->queryFlag(MemEvent::F_NORESPONSE))
                 remoteRd->clearFlag(MemEvent::F_NORESPONSE);
             it->second.reqev = remoteRd;
@@ -617,13 +618,13 @@ void MemCacheController::readData(MemEvent* event) {
 
     localAddr = toLocalAddr(localAddr);
 
-    vector<uint8_t> payload;
-    payload.resize(event->getSize(), 0);
+    /* Fill the response payload straight from the backing store */
+    uint8_t* payload = event->allocatePayload(event->getSize());
 
     if (backing_)
         backing_->get(localAddr, event->getSize(), payload);
-
-    event->setPayload(payload);
+    else
+        memset(payload, 0, event->getSize());
 }
 
 
@@ -631,8 +632,7 @@ void MemCacheController::readData(MemEvent* event) {
 void MemCacheController::writeData(Addr addr, std::vector<uint8_t> * data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++)
-        backing_->set(addr + i, data->at(i));
+    backing_->set(addr, data->size(), *data);
 }
 
 
@@ -641,8 +641,7 @@ void MemCacheController::readData(Addr addr, size_t bytes, std::vector<uint8_t>
 
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
+    backing_->get(addr, bytes, data);
 }
 
 
@@ -668,8 +667,8 @@ void MemCacheController::processInitEvent( MemEventInit* me ) {
     } else {
         if (is_debug_event(me)) { Debug(_L9_,"Memory init %s - Received Write for %" PRIx64 " size %zu\n", getName().c_str(), me->getAddr(),me->getPayload().size()); }
         MemEventInit * mEv = me->clone();
-        mEv->setSrc(getName());
-        mEv->setDst(link_->getTargetDestination(mEv->getRoutingAddress()));
+        mEv->setSrcID(nameID_);
+        mEv->setDstID(link_->getTargetDestinationID(mEv->getRoutingAddress()));
         link_->sendUntimedData(mEv);
     }
     delete me;
@@ -121,6 +121,7 @@ protected:
     std::vector<CacheState> cache_;
     Addr lineSize_;
     Addr lineOffset_;
+    EndpointID nameID_;     // Interned getName()
 
     void notifyListeners( MemEvent* ev ) {
         if (  ! listeners_.empty()) {
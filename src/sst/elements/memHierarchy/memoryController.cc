@@ -67,8 +67,6 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     // Output for debug
     dbg.init("", dlevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
 
-    bool initBacking = params.find<bool>("initBacking", false);
-
     // Debug address
     std::vector<Addr> addrArr;
     params.find_array<Addr>("debug_addr", addrArr);
@@ -107,6 +105,14 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     clockTimeBase_ = registerClock(clockfreq, clockHandler_);
     clockOn_ = true;
 
+    UnitAlgebra warmupTime(params.find<std::string>("warmup_time", "0ns"));
+    if (!warmupTime.hasUnits("s")) {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: warmup_time. Must have units of s (SI prefixes ok). You specified '%s'\n", getName().c_str(), warmupTime.toString().c_str());
+    }
+    bool warmupSignalFound;
+    Addr warmupSignal = params.find<Addr>("warmup_signal_addr", 0, warmupSignalFound);
+    warmup_.configure(warmupTime.isValueZero() ? 0 : getTimeConverter(warmupTime)->getFactor(), warmupSignalFound, warmupSignal);
+
 
     string link_lat         = params.find<std::string>("direct_link_latency", "10 ns");
 
@@ -149,6 +155,7 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     using std::placeholders::_2;
     memBackendConvertor_->setCallbackHandlers(std::bind(&MemController::handleMemResponse, this, _1, _2), std::bind(&MemController::turnClockOn, this));
     memSize_ = memBackendConvertor_->getMemSize();
+    nameID_ = EndpointRegistry::intern(getName());
     if (memSize_ == 0)
         out.fatal(CALL_INFO, -1, "%s, Error - tried to get memory size from backend but size is 0B. Either backend is missing 'mem_size' parameter or value is invalid.\n", getName().c_str());
 
@@ -302,7 +309,7 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
             else if (e == 2) {
                 if (memoryFile == "") {
                     out.verbose(CALL_INFO, 1, 0, "%s, Could not MMAP backing store (likely, simulated memory exceeds real memory). Creating malloc based store instead.\n", getName().c_str());
-                    backing_ = new Backend::BackingMalloc(sizeBytes,initBacking);
+                    backing_ = new Backend::BackingMalloc(sizeBytes);
                 } else {
                     out.fatal(CALL_INFO, -1, "%s, Error - Could not MMAP backing store from file %s\n", getName().c_str(), memoryFile.c_str());
                 }
@@ -310,7 +317,14 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
                 out.fatal(CALL_INFO, -1, "%s, Error - unable to create backing store. Exception thrown is %d.\n", getName().c_str(), e);
         }
     } else if (backingType == "malloc") {
-        backing_ = new Backend::BackingMalloc(sizeBytes,initBacking);
+        backing_ = new Backend::BackingMalloc(sizeBytes);
+    }
+
+    backingRestoreFile_ = params.find<std::string>("backing_restore_file", "");
+    backingDumpFile_ = params.find<std::string>("backing_dump_file", "");
+    if (!backing_ && (!backingRestoreFile_.empty() || !backingDumpFile_.empty())) {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: backing_restore_file and backing_dump_file require a backing store but 'backing' is 'none'.\n",
+                getName().c_str());
     }
 
     /* Custom command handler */
@@ -329,13 +343,19 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
 }
 
 void MemController::handleEvent(SST::Event* event) {
-    if (!clockOn_) {
+    MemEventBase *meb = static_cast<MemEventBase*>(event);
+
+    if (warmup_.active() && warmup_.endsWith(meb, getCurrentSimCycle())) {
+        warmup_.end();
+        out.verbose(CALL_INFO, 2, 0, "%s, Ending functional warm-up at %" PRIu64 "ns\n", getName().c_str(), getCurrentSimTimeNano());
+    }
+
+    // Custom commands always go through the backend
+    if (!clockOn_ && (!warmup_.active() || meb->getCmd() == Command::CustomReq)) {
         Cycle_t cycle = turnClockOn();
         memBackendConvertor_->turnClockOn(cycle);
     }
 
-    MemEventBase *meb = static_cast<MemEventBase*>(event);
-
     if (is_debug_event(meb)) {
         Debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:New     (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), meb->getVerboseString(dlevel).c_str());
@@ -404,7 +424,7 @@ void MemController::handleEvent(SST::Event* event) {
                         getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                         ev->getVerboseString().c_str());
             }
-            memBackendConvertor_->handleMemEvent( ev );
+            issueToBackend( ev );
             break;
 
         case Command::FlushLine:
@@ -412,7 +432,7 @@ void MemController::handleEvent(SST::Event* event) {
             {
                 MemEvent* put = NULL;
                 if ( ev->getPayloadSize() != 0 ) {
-                    put = new MemEvent(getName(), ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
+                    put = new MemEvent(nameID_, ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
                     put->setFlag(MemEvent::F_NORESPONSE);
                     outstandingEvents_.insert(std::make_pair(put->getID(), put));
                     if (is_debug_event(put)) {
@@ -420,7 +440,7 @@ void MemController::handleEvent(SST::Event* event) {
                                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                                 put->getVerboseString().c_str());
                     }
-                    memBackendConvertor_->handleMemEvent( put );
+                    issueToBackend( put );
                 }
 
                 outstandingEvents_.insert(std::make_pair(ev->getID(), ev));
@@ -430,7 +450,7 @@ void MemController::handleEvent(SST::Event* event) {
                             getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                             ev->getVerboseString().c_str());
                 }
-                memBackendConvertor_->handleMemEvent( ev );
+                issueToBackend( ev );
 
             }
             break;
@@ -444,6 +464,13 @@ void MemController::handleEvent(SST::Event* event) {
     }
 }
 
+void MemController::issueToBackend(MemEvent* ev) {
+    if (warmup_.active())
+        handleMemResponse(ev->getID(), ev->getFlags());
+    else
+        memBackendConvertor_->handleMemEvent(ev);
+}
+
 bool MemController::clock(Cycle_t cycle) {
     bool unclockLink = true;
     if (clockLink_) {
@@ -546,6 +573,7 @@ void MemController::handleMemResponse( Event::id_type id, uint32_t flags ) {
                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), resp->getVerboseString(dlevel).c_str());
     }
 
+    MEMH_TRACE_MARK(resp, Memory, getCurrentSimCycle());
     link_->send( resp );
     delete ev;
 }
@@ -571,6 +599,9 @@ void MemController::init(unsigned int phase) {
 void MemController::setup(void) {
     memBackendConvertor_->setup();
     link_->setup();
+
+    if (!backingRestoreFile_.empty())
+        backing_->restore(backingRestoreFile_);
 }
 
 
@@ -579,6 +610,9 @@ void MemController::finish(void) {
     cycle--;
     memBackendConvertor_->finish(cycle);
     link_->finish();
+
+    if (!backingDumpFile_.empty())
+        backing_->dump(backingDumpFile_);
 }
 
 void MemController::writeData(MemEvent* event) {
@@ -586,7 +620,7 @@ void MemController::writeData(MemEvent* event) {
         Addr addr = event->queryFlag(MemEvent::F_NONCACHEABLE) ? event->getAddr() : event->getBaseAddr();
         if (is_debug_event(event)) { 
             Debug(_L8_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); 
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, event->getPayload().data(), event->getSize(), true);
         }
 
         backing_->set(addr, event->getSize(), event->getPayload());
@@ -598,7 +632,7 @@ void MemController::writeData(MemEvent* event) {
         Addr addr = event->getAddr();
         if (is_debug_event(event)) { 
             Debug(_L8_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); 
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, event->getPayload().data(), event->getSize(), true);
         }
         
         backing_->set(addr, event->getSize(), event->getPayload());
@@ -613,42 +647,48 @@ void MemController::readData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr localAddr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    vector<uint8_t> payload;
-    payload.resize(event->getSize(), 0);
+    /* Fill the response payload straight from the backing store */
+    uint8_t* payload = event->allocatePayload(event->getSize());
 
     if (backing_) {
         backing_->get(localAddr, event->getSize(), payload);
         if (is_debug_addr(localAddr))
-            printDataValue(localAddr, &(payload), false);
+            printDataValue(localAddr, payload, event->getSize(), false);
+    } else {
+        memset(payload, 0, event->getSize());
     }
-
-    event->setPayload(payload);
 }
 
 
 /* Backing store interactions for custom command subcomponents */
 void MemController::writeData(Addr addr, std::vector<uint8_t> * data) {
+    writeData(addr, data->size(), data->data());
+}
+
+
+void MemController::readData(Addr addr, size_t bytes, std::vector<uint8_t> &data) {
+    data.resize(bytes, 0);
+    readData(addr, bytes, data.data());
+}
+
+
+void MemController::writeData(Addr addr, size_t bytes, const uint8_t* data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++) {
-        backing_->set(addr + i, data->at(i));
-    }
+    backing_->set(addr, bytes, data);
 
     if (is_debug_addr(addr))
-        printDataValue(addr, data, true);
+        printDataValue(addr, data, bytes, true);
 }
 
 
-void MemController::readData(Addr addr, size_t bytes, std::vector<uint8_t> &data) {
-    data.resize(bytes, 0);
-
+void MemController::readData(Addr addr, size_t bytes, uint8_t* data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
-    
+    backing_->get(addr, bytes, data);
+
     if (is_debug_addr(addr))
-        printDataValue(addr, &data, false);
+        printDataValue(addr, data, bytes, false);
 }
 
 
@@ -774,17 +814,17 @@ void MemController::emergencyShutdown() {
     }
 }
 
-void MemController::printDataValue(Addr addr, std::vector<uint8_t>* data, bool set) {
+void MemController::printDataValue(Addr addr, const uint8_t* data, size_t size, bool set) {
     if (dlevel < 11) return;
 
     std::string action = set ? "WRITE" : "READ";
     std::stringstream value;
     value << std::hex << std::setfill('0');
-    for (unsigned int i = 0; i < data->size(); i++) {
-        value << std::hex << std::setw(2) << (int)data->at(i);
+    for (size_t i = 0; i < size; i++) {
+        value << std::hex << std::setw(2) << (int)data[i];
     }
     
     dbg.debug(_L11_, "V: %-20" PRIu64 " %-20" PRIu64 " %-20s %-13s 0x%-16" PRIx64 " B: %-3zu %s\n",
             getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), action.c_str(), 
-            addr, data->size(), value.str().c_str());
+            addr, size, value.str().c_str());
 }
@@ -26,6 +26,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/warmup.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -53,11 +54,15 @@ public:
             {"backing",             "(string) Type of backing store to use. Options: 'none' - no backing store (only use if simulation does not require correct memory values), 'malloc', or 'mmap'", "mmap"},\
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_file",         "(string) Optional backing-store file to pre-load memory, or store resulting state", "N/A"},\
+            {"backing_restore_file","(string) Optional memory snapshot (see backing_dump_file) to load into the backing store at the start of simulation, after init-phase writes. Use to warm-start long simulations.", ""},\
+            {"backing_dump_file",   "(string) Optional file to write a snapshot of the backing store to at the end of simulation. Only non-zero data is written.", ""},\
             {"addr_range_start",    "(uint) Lowest address handled by this memory.", "0"},\
             {"addr_range_end",      "(uint) Highest address handled by this memory.", "uint64_t-1"},\
             {"interleave_size",     "(string) Size of interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
             {"interleave_step",     "(string) Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
-            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""}
+            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""},\
+            {"warmup_time",         "(string) Answer requests functionally from the backing store, bypassing the backend, until this simulated time. Specify in s (SI prefixes ok). '0ns' for no time limit. Statistics include warm-up traffic unless enabled with a 'startat' time.", "0ns"},\
+            {"warmup_signal_addr",  "(uint) If set, answer requests functionally until a request to this address arrives.", ""}
 
     SST_ELI_DOCUMENT_PARAMS( MEMCONTROLLER_ELI_PARAMS )
 
@@ -94,6 +99,10 @@ public:
     void writeData(Addr addr, std::vector<uint8_t>* data);
     void readData(Addr addr, size_t size, std::vector<uint8_t>& data);
 
+    /* Same, copying directly to/from the caller's buffer. readData leaves 'data' unchanged if there is no backing store. */
+    void writeData(Addr addr, size_t size, const uint8_t* data);
+    void readData(Addr addr, size_t size, uint8_t* data);
+
 protected:
     MemController();  // for serialization only
     virtual ~MemController() {
@@ -127,6 +136,8 @@ protected:
 
     MemBackendConvertor*    memBackendConvertor_;
     Backend::Backing*       backing_;
+    std::string             backingRestoreFile_;    // Snapshot to load in setup()
+    std::string             backingDumpFile_;       // Snapshot to write in finish()
 
     MemLinkBase* link_;         // Link to the rest of memHierarchy
     bool clockLink_;            // Flag - should we call clock() on this link or not
@@ -141,9 +152,15 @@ protected:
     void readData( MemEvent* );
 
     size_t memSize_;
+    EndpointID nameID_;     // Interned getName()
 
     bool clockOn_;
 
+    Warmup warmup_;     // Functional warm-up: respond without the backend
+
+    /* Send a request to the backend or, during warm-up, respond to it right away */
+    void issueToBackend(MemEvent* ev);
+
     MemRegion region_; // Which address region we are, for translating to local addresses
     Addr privateMemOffset_; // If we reserve any memory locations for ourselves/directories/etc. and they are NOT part of the physical address space, shift regular addresses by this much
     Addr translateToLocal(Addr addr);
@@ -158,7 +175,7 @@ protected:
     virtual void printStatus(Output &out);
     virtual void emergencyShutdown();
     
-    void printDataValue(Addr addr, std::vector<uint8_t>* data, bool set);
+    void printDataValue(Addr addr, const uint8_t* data, size_t size, bool set);
 
 private:
 
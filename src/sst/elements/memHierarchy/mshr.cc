@@ -34,6 +34,9 @@ MSHR::MSHR(ComponentId_t cid, Output* debug, int maxSize, string cacheName, std:
     d2_->init("", 10, 0, (Output::output_location_t)1);
 
     DEBUG_ADDR = debugAddr;
+
+    // Unlimited MSHRs start small and grow on demand
+    mshr_.init(maxSize > 0 ? maxSize : 64);
 }
 
 int MSHR::getMaxSize() {
@@ -45,58 +48,59 @@ int MSHR::getSize() {
 }
 
 unsigned int MSHR::getSize(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
-        return 0;
-    else
-        return mshr_.find(addr)->second.entries.size();
+    MSHRRegister * reg = mshr_.find(addr);
+    return reg ? reg->entries.size() : 0;
 }
 
 bool MSHR::exists(Addr addr) {
-    return mshr_.find(addr) != mshr_.end();
+    return mshr_.find(addr) != nullptr;
 }
 
 MSHREntry MSHR::getEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries.size() <= index) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", ownerName_.c_str(), addr, index, mshr_.find(addr)->second.entries.size());
+    if (reg->entries.size() <= index) {
+        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", ownerName_.c_str(), addr, index, reg->entries.size());
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-    std::advance(it, index);
-    return *it;
+    return reg->entries[index];
 }
 
-MSHREntry MSHR::getFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
+/* Front entry for addr; fatal if there is none. 'caller' names the public accessor in the error */
+MSHREntry* MSHR::getFrontEntry(Addr addr, const char* caller) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
+        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::%s(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), caller, addr);
     }
-
-    if (mshr_.find(addr)->second.entries.empty()) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
+    if (reg->entries.empty()) {
+        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::%s(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), caller, addr);
     }
-    return mshr_.find(addr)->second.entries.front();
+    return &(reg->entries.front());
+}
+
+MSHREntry MSHR::getFront(Addr addr) {
+    return *getFrontEntry(addr, "getFront");
 }
 
 void MSHR::removeEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Entry list is shorter than requested index.\n", ownerName_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries.begin();
-    std::advance(entry, index);
+    MSHREntry * entry = &(reg->entries[index]);
 
     if (entry->getType() == MSHREntryType::Event)
         size_--;
 
     if (is_debug_addr(addr))
-        printDebug(10, "Remove", addr, (*entry).getString().c_str());
+        printDebug(10, "Remove", addr, entry->getString().c_str());
 
-    reg->entries.erase(entry);
+    reg->entries.erase(index);
     if (reg->entries.empty()) {
         if (is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
@@ -108,10 +112,10 @@ void MSHR::removeEntry(Addr addr, size_t index) {
 }
 
 void MSHR::removeFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
@@ -119,7 +123,7 @@ void MSHR::removeFront(Addr addr) {
    // if (is_debug_addr(addr))
    //     d_->debug(_L10_, "    MSHR::removeFront(0x%" PRIx64 ", %s)\n", addr, reg->entries.front().getString().c_str());
 
-    if (getFrontType(addr) == MSHREntryType::Event)
+    if (reg->entries.front().getType() == MSHREntryType::Event)
         size_--;
 
     if (is_debug_addr(addr))
@@ -137,72 +141,69 @@ void MSHR::removeFront(Addr addr) {
 MSHREntryType MSHR::getEntryType(Addr addr, size_t index) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getEntryType(0x%" PRIx64 ", %zu)\n", addr, index);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries.size() <= index) {
+    if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Entry list is shoerter than index.\n", ownerName_.c_str(), addr, index);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-    std::advance(it, index);
-    return it->getType();
+    return reg->entries[index].getType();
 }
 
 MSHREntryType MSHR::getFrontType(Addr addr) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getFrontType(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
-    }
-    if (mshr_.find(addr)->second.entries.empty()) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
-    }
-    return mshr_.find(addr)->second.entries.front().getType();
+    return getFrontEntry(addr, "getFrontType")->getType();
 }
 
 MemEventBase* MSHR::getEntryEvent(Addr addr, size_t index) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getEntryEvent(0x%" PRIx64 ", %zu)\n", addr, index);
 
-    if (mshr_.find(addr) == mshr_.end() || mshr_.find(addr)->second.entries.size() <= index)
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg || reg->entries.size() <= index)
         return nullptr;
 
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-    std::advance(it, index);
-    if (it->getType() != MSHREntryType::Event)
+    MSHREntry * entry = &(reg->entries[index]);
+    if (entry->getType() != MSHREntryType::Event)
         return nullptr;
-    return it->getEvent();
+    return entry->getEvent();
 }
 
 
 MemEventBase* MSHR::getFrontEvent(Addr addr) {
     //if (is_debug_addr(addr))
     //    d_->debug(_L20_, "    MSHR::getFrontEvent(0x%" PRIx64 ")\n", addr);
-    if (getFrontType(addr) != MSHREntryType::Event) {
+    MSHREntry * entry = getFrontEntry(addr, "getFrontEvent");
+    if (entry->getType() != MSHREntryType::Event) {
         return nullptr;
     }
-    return mshr_.find(addr)->second.entries.front().getEvent();
+    return entry->getEvent();
 }
 
 MemEventBase* MSHR::getFirstEventEntry(Addr addr, Command cmd) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getFirstEventEntry(0x%" PRIx64 ", %s)\n", addr, CommandString[(int)cmd]);
 
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg)
         return nullptr;
 
-    for (std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin(); it != mshr_.find(addr)->second.entries.end(); it++) {
-        if (it->getType() == MSHREntryType::Event && it->getEvent()->getCmd() == cmd)
-            return it->getEvent();
+    for (size_t i = 0; i < reg->entries.size(); i++) {
+        MSHREntry * entry = &(reg->entries[i]);
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getCmd() == cmd)
+            return entry->getEvent();
     }
     return nullptr;
 }
 
-std::list<Addr>* MSHR::getEvictPointers(Addr addr) {
-    if (getFrontType(addr) != MSHREntryType::Evict)
+MSHREvictPointers* MSHR::getEvictPointers(Addr addr) {
+    MSHREntry * entry = getFrontEntry(addr, "getEvictPointers");
+    if (entry->getType() != MSHREntryType::Evict)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEvictPointers(0x%" PRIx64 "). Entry type is not Evict.\n", ownerName_.c_str(), addr);
 
-    return mshr_.find(addr)->second.entries.front().getPointers();
+    return entry->getPointers();
 }
 
 // Return whether we should retry a new event or not
@@ -218,15 +219,14 @@ bool MSHR::removeEvictPointer(Addr addr, Addr addrPtr) {
 
     // Sometimes we insert a WB before the Evict & then remove the Evict pointer, othertimes the Evict is front
     if (getFrontType(addr) == MSHREntryType::Evict) {
-        MSHREntry * entry = &(mshr_.find(addr)->second.entries.front());
+        MSHREntry * entry = &(mshr_.find(addr)->entries.front());
         entry->getPointers()->remove(addrPtr);
         if (entry->getPointers()->empty()) {
             removeFront(addr);
             return true;
         }
     } else {
-        std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-        it++;
+        MSHREntry * it = &(mshr_.find(addr)->entries[1]);
         if (it->getType() != MSHREntryType::Evict)
             d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEvictPointer(0x%" PRIx64 ", 0x%" PRIx64 "). Entry type is not Evict.\n", ownerName_.c_str(), addr, addrPtr);
         it->getPointers()->remove(addrPtr);
@@ -243,7 +243,7 @@ bool MSHR::pendingWriteback(Addr addr) {
 
 bool MSHR::pendingWritebackIsDowngrade(Addr addr) {
     if (pendingWriteback(addr))
-        return mshr_.find(addr)->second.entries.front().getDowngrade();
+        return mshr_.find(addr)->entries.front().getDowngrade();
     return false;
 }
 
@@ -260,11 +260,11 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
     // Success
     size_++;
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
+        reg = mshr_.findOrInsert(addr);
+        reg->entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
 
-        mshr_.insert(std::make_pair(addr, reg));
         if (is_debug_addr(addr)) {
             stringstream reason;
             reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=0";
@@ -274,18 +274,16 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
 
         return 0;
     } else {
-        if (pos == -1 || pos > mshr_.find(addr)->second.entries.size()) {
-            mshr_.find(addr)->second.entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+        if (pos == -1 || pos > reg->entries.size()) {
+            reg->entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (is_debug_addr(addr)) {
                 stringstream reason;
-                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries.size() - 1);
+                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->entries.size() - 1);
                 printDebug(10, "InsEv", addr, reason.str());
             }
-            return (mshr_.find(addr)->second.entries.size() - 1);
+            return (reg->entries.size() - 1);
         } else {
-            std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
-            std::advance(it, pos);
-            mshr_.find(addr)->second.entries.insert(it, MSHREntry(event, stallEvict, getCurrentSimCycle()));
+            reg->entries.insert(pos, MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (is_debug_addr(addr)) {
                 stringstream reason;
                 reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << pos;
@@ -304,9 +302,10 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
  *      -1 = conflict, not inserted
  */
 int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg)
         return 0;
-    
+
     if (size_ == maxSize_-1) { /* Assuming fwdEvent == false */
         if (is_debug_addr(addr)) {
             stringstream reason;
@@ -316,42 +315,40 @@ int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
         return -1;
     }
     size_++;
-    mshr_.find(addr)->second.entries.push_back(MSHREntry(event, false, getCurrentSimCycle()));
+    reg->entries.push_back(MSHREntry(event, false, getCurrentSimCycle()));
     if (is_debug_addr(addr)) {
         stringstream reason;
-        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries.size() - 1);
+        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->entries.size() - 1);
         printDebug(10, "InsEv", addr, reason.str());
     }
-    return (mshr_.find(addr)->second.entries.size() - 1);
+    return (reg->entries.size() - 1);
 }
 
 MemEventBase* MSHR::swapFrontEvent(Addr addr, MemEventBase* event) {
     if (is_debug_addr(addr))
         printDebug(10, "SwpEv", addr, "");
 
-    if (mshr_.find(addr)->second.entries.empty())
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg || reg->entries.empty())
         return nullptr;
 
-    return  mshr_.find(addr)->second.entries.front().swapEvent(event, getCurrentSimCycle());
+    return reg->entries.front().swapEvent(event, getCurrentSimCycle());
 }
 
 void MSHR::moveEntryToFront(Addr addr, unsigned int index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Entry list is shorter than requested index.\n", ownerName_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries.begin();
-    std::advance(entry, index);
-
-    MSHREntry tmpEntry = *entry;
+    MSHREntry tmpEntry = reg->entries[index];
 
     if (is_debug_addr(addr))
-        printDebug(10, "MvEnt", addr, entry->getString());
-    reg->entries.erase(entry);
+        printDebug(10, "MvEnt", addr, tmpEntry.getString());
+    reg->entries.erase(index);
     reg->entries.push_front(tmpEntry);
 }
 
@@ -365,13 +362,7 @@ bool MSHR::insertWriteback(Addr addr, bool downgrade) {
         printDebug(10, "InsWB", addr, reason.str());
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(downgrade, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(addr, reg));
-    } else {
-        mshr_.find(addr)->second.entries.push_front(MSHREntry(downgrade, getCurrentSimCycle()));
-    }
+    mshr_.findOrInsert(addr)->entries.push_front(MSHREntry(downgrade, getCurrentSimCycle()));
 
     return true;
 }
@@ -387,17 +378,11 @@ bool MSHR::insertEviction(Addr oldAddr, Addr newAddr) {
         printDebug(10, "InsPtr", oldAddr, reason.str());
     }
 
-    if (mshr_.find(oldAddr) == mshr_.end()) {  // No MSHR entry for oldAddr
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(newAddr, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(oldAddr, reg));
-    } else {
-        list<MSHREntry>* entries = &(mshr_.find(oldAddr)->second.entries);
-        if (!entries->empty() && entries->back().getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
-            entries->back().getPointers()->push_back(newAddr);
-        } else { // MSHR entry for oldAddr is not an Evict (or no entry exists)
-            entries->push_back(MSHREntry(newAddr, getCurrentSimCycle()));
-        }
+    MSHREntryQueue* entries = &(mshr_.findOrInsert(oldAddr)->entries);
+    if (!entries->empty() && entries->back().getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
+        entries->back().getPointers()->push_back(newAddr);
+    } else { // MSHR entry for oldAddr is not an Evict (or no entry exists)
+        entries->push_back(MSHREntry(newAddr, getCurrentSimCycle()));
     }
     return true;
 }
@@ -406,27 +391,30 @@ void MSHR::addPendingRetry(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "IncRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::addPendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.addPendingRetry();
+    reg->addPendingRetry();
 }
 
 void MSHR::removePendingRetry(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "DecRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removePendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.removePendingRetry();
+    reg->removePendingRetry();
 }
 
 uint32_t MSHR::getPendingRetries(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg)
         return 0;
 
-    return mshr_.find(addr)->second.getPendingRetries();
+    return reg->getPendingRetries();
 }
 
 
@@ -436,23 +424,25 @@ void MSHR::setInProgress(Addr addr, bool value) {
     if (is_debug_addr(addr))
         printDebug(20, "InProg", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setInProgress(value);
+    reg->entries.front().setInProgress(value);
 }
 
 bool MSHR::getInProgress(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         return false;
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         return false;
     }
-    return mshr_.find(addr)->second.entries.front().getInProgress();
+    return reg->entries.front().getInProgress();
 }
 
 void MSHR::setStalledForEvict(Addr addr, bool set) {
@@ -463,56 +453,62 @@ void MSHR::setStalledForEvict(Addr addr, bool set) {
             printDebug(20, "Unstall", addr, "");
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setStalledForEvict(set);
+    reg->entries.front().setStalledForEvict(set);
 }
 
 bool MSHR::getStalledForEvict(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         return false;
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         return false;
     }
-    return mshr_.find(addr)->second.entries.front().getStalledForEvict();
+    return reg->entries.front().getStalledForEvict();
 }
 
 void MSHR::setProfiled(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setProfiled();
+    reg->entries.front().setProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getProfiled(0x%" PRIx64 "\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front().getProfiled();
+    return reg->entries.front().getProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr, SST::Event::id_type id) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", ownerName_.c_str(), addr, id.first, id.second);
-    if (mshr_.find(addr)->second.entries.empty())
+    if (reg->entries.empty())
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", ownerName_.c_str(), addr, id.first, id.second);
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries.begin(); jt != mshr_.find(addr)->second.entries.end(); jt++) {
+    for (size_t i = 0; i < reg->entries.size(); i++) {
+        MSHREntry * jt = &(reg->entries[i]);
         if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
             return jt->getProfiled();
         }
@@ -524,13 +520,15 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
     if (is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", ownerName_.c_str(), addr, id.first, id.second);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", ownerName_.c_str(), addr, id.first, id.second);
     }
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries.begin(); jt != mshr_.find(addr)->second.entries.end(); jt++) {
+    for (size_t i = 0; i < reg->entries.size(); i++) {
+        MSHREntry * jt = &(reg->entries[i]);
         if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
             jt->setProfiled();
             return;
@@ -538,39 +536,34 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
     }
 }
 
+/* Event that has been waiting longest. Ties go to the lowest address, then to queue order */
 MSHREntry* MSHR::getOldestEntry() {
-    bool first = false;
     MSHREntry* entry = nullptr;
-    uint64_t time;
-
-    for (MSHRBlock::iterator it = mshr_.begin(); it != mshr_.end(); it++) {
-        for (list<MSHREntry>::iterator jt = it->second.entries.begin(); jt != it->second.entries.end(); jt++) {
-            if (jt->getType() == MSHREntryType::Event) {
-                if (!first) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                } else if (jt->getStartTime() < time) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                }
+    Addr entryAddr = 0;
+
+    mshr_.forEach([&](Addr addr, MSHRRegister& reg) {
+        for (size_t i = 0; i < reg.entries.size(); i++) {
+            MSHREntry * jt = &(reg.entries[i]);
+            if (jt->getType() != MSHREntryType::Event)
+                continue;
+            if (!entry || jt->getStartTime() < entry->getStartTime() || (jt->getStartTime() == entry->getStartTime() && addr < entryAddr)) {
+                entry = jt;
+                entryAddr = addr;
             }
         }
-    }
+    });
     return entry;
 }
 
 void MSHR::incrementAcksNeeded(Addr addr) {
    // if (is_debug_addr(addr))
    //     d_->debug(_L10_, "    MSHR::incrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        mshr_.insert(std::make_pair(addr, reg));
-    }
-    mshr_.find(addr)->second.acksNeeded++;
+    MSHRRegister * reg = mshr_.findOrInsert(addr);
+    reg->acksNeeded++;
 
     if (is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acksNeeded << " acks";
+        reason << reg->acksNeeded << " acks";
         printDebug(10, "IncAck", addr, reason.str());
     }
 }
@@ -579,44 +572,47 @@ void MSHR::incrementAcksNeeded(Addr addr) {
 bool MSHR::decrementAcksNeeded(Addr addr) {
    // if (is_debug_addr(addr))
    //     d_->debug(_L10_, "    MSHR::decrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.acksNeeded == 0) {
+    if (reg->acksNeeded == 0) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). AcksNeeded is already 0.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.acksNeeded--;
+    reg->acksNeeded--;
 
     if (is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acksNeeded << " acks";
+        reason << reg->acksNeeded << " acks";
         printDebug(10, "DecAck", addr, reason.str());
     }
 
-    return (mshr_.find(addr)->second.acksNeeded == 0);
+    return (reg->acksNeeded == 0);
 }
 
 uint32_t MSHR::getAcksNeeded(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         return 0;
     }
-    return (mshr_.find(addr)->second.acksNeeded);
+    return (reg->acksNeeded);
 }
 
 void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
 
     if (is_debug_addr(addr))
         printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
 
-    mshr_.find(addr)->second.dataBuffer = data;
-    mshr_.find(addr)->second.dataDirty = dirty;
+    reg->dataBuffer = data;
+    reg->dataDirty = dirty;
 }
 
 void MSHR::clearData(Addr addr) {
@@ -625,32 +621,36 @@ void MSHR::clearData(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(10, "ClrData", addr, "");
 
-    mshr_.find(addr)->second.dataBuffer.clear();
-    mshr_.find(addr)->second.dataDirty = false;
+    MSHRRegister * reg = mshr_.find(addr);
+    reg->dataBuffer.clear();
+    reg->dataDirty = false;
 }
 
 vector<uint8_t>& MSHR::getData(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.dataBuffer;
+    return reg->dataBuffer;
 }
 
 bool MSHR::hasData(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg)
         return false;
-    return !(mshr_.find(addr)->second.dataBuffer.empty());
+    return !(reg->dataBuffer.empty());
 }
 
 bool MSHR::getDataDirty(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getDataDirty(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.dataDirty;
+    return reg->dataDirty;
 }
 
 void MSHR::setDataDirty(Addr addr, bool dirty) {
@@ -660,10 +660,11 @@ void MSHR::setDataDirty(Addr addr, bool dirty) {
     if (is_debug_addr(addr))
         printDebug(20, "SetDirt", addr, (dirty ? "Dirty" : "Clean"));
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = mshr_.find(addr);
+    if (!reg) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.dataDirty = dirty;
+    reg->dataDirty = dirty;
 
 }
 
@@ -689,10 +690,14 @@ void MSHR::printDebug(uint32_t lev, std::string action, Addr addr, std::string r
 // Print status. Called by cache controller on EmergencyShutdown and printStatus()
 void MSHR::printStatus(Output &out) {
     out.output("    MSHR Status for %s. Size: %u. Prefetches: %u\b", ownerName_.c_str(), size_, prefetchCount_);
-    for (std::map<Addr,MSHRRegister>::iterator it = mshr_.begin(); it != mshr_.end(); it++) {   // Iterate over addresses
-        out.output("      Entry: Addr = 0x%" PRIx64 "\n", (it->first));
-        for (std::list<MSHREntry>::iterator it2 = it->second.entries.begin(); it2 != it->second.entries.end(); it2++) { // Iterate over entries for each address
-            out.output("        %s\n", it2->getString().c_str());
+    std::vector<Addr> addrs;
+    mshr_.forEach([&](Addr addr, MSHRRegister&) { addrs.push_back(addr); });
+    std::sort(addrs.begin(), addrs.end());
+    for (std::vector<Addr>::iterator it = addrs.begin(); it != addrs.end(); it++) {   // Iterate over addresses
+        out.output("      Entry: Addr = 0x%" PRIx64 "\n", *it);
+        MSHREntryQueue* entries = &(mshr_.find(*it)->entries);
+        for (size_t i = 0; i < entries->size(); i++) { // Iterate over entries for each address
+            out.output("        %s\n", (*entries)[i].getString().c_str());
         }
     }
     out.output("    End MSHR Status for %s\n", ownerName_.c_str());
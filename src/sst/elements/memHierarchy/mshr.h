@@ -16,9 +16,12 @@
 #ifndef _MSHR_H_
 #define _MSHR_H_
 
-#include <map>
+#include <deque>
+#include <set>
+#include <vector>
 #include <string>
 #include <sstream>
+#include <algorithm>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -43,12 +46,73 @@ using namespace std;
 
 enum class MSHREntryType { Event, Evict, Writeback };
 
+/*
+ * Addresses waiting on an eviction
+ * Almost always one or two, so they are stored in the entry itself and only
+ * spill to the heap when a line has a long list of waiters.
+ */
+class MSHREvictPointers {
+    public:
+        typedef const Addr* iterator;
+
+        MSHREvictPointers() : count_(0) { }
+
+        iterator begin() const { return data(); }
+        iterator end() const { return data() + count_; }
+        size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        void push_back(Addr addr) {
+            if (count_ < inlineCapacity) {
+                inline_[count_] = addr;
+            } else {
+                if (count_ == inlineCapacity)
+                    spill_.assign(inline_, inline_ + inlineCapacity);
+                spill_.push_back(addr);
+            }
+            count_++;
+        }
+
+        /* Remove all occurrences of addr, preserving the order of the rest */
+        void remove(Addr addr) {
+            if (count_ > inlineCapacity) {
+                spill_.erase(std::remove(spill_.begin(), spill_.end(), addr), spill_.end());
+                count_ = spill_.size();
+                if (count_ <= inlineCapacity) {
+                    std::copy(spill_.begin(), spill_.end(), inline_);
+                    spill_.clear();
+                }
+            } else {
+                count_ = std::remove(inline_, inline_ + count_, addr) - inline_;
+            }
+        }
+
+    private:
+        static constexpr size_t inlineCapacity = 4;
+
+        const Addr* data() const { return count_ > inlineCapacity ? spill_.data() : inline_; }
+
+        Addr inline_[inlineCapacity];
+        std::vector<Addr> spill_;
+        size_t count_;
+};
+
 class MSHREntry {
     public:
+        // Empty entry, used for unoccupied queue slots
+    MSHREntry() {
+            type = MSHREntryType::Event;
+            event = nullptr;
+            time = 0;
+            inProgress = false;
+            needEvict = false;
+            profiled = false;
+            downgrade = false;
+        }
+
         // Event entry
     MSHREntry(MemEventBase* ev, bool stallEvict, SimTime_t curr_time) {
             type = MSHREntryType::Event;
-            evictPtrs = nullptr;
             event = ev;
             time = curr_time;
             inProgress = false;
@@ -60,13 +124,11 @@ class MSHREntry {
         // Writeback entry
     MSHREntry(bool downgr, SimTime_t curr_time) {
             type = MSHREntryType::Writeback;
-            evictPtrs = nullptr;
             event = nullptr;
             time = curr_time;
             inProgress = false;
             needEvict = false;
             profiled = false;
-            event = nullptr;
             downgrade = downgr;
         }
 
@@ -74,27 +136,14 @@ class MSHREntry {
     MSHREntry(Addr addr, SimTime_t curr_time) {
             type = MSHREntryType::Evict;
             event = nullptr;
-            evictPtrs = new std::list<Addr>;
-            evictPtrs->push_back(addr);
+            evictPtrs.push_back(addr);
             time = curr_time;
             inProgress = false;
             needEvict = false;
             profiled = false;
-            event = nullptr;
             downgrade = false;
         }
 
-        MSHREntry(const MSHREntry& entry) {
-            type = entry.type;
-            evictPtrs = entry.evictPtrs;
-            event = entry.event;
-            time = entry.time;
-            inProgress = entry.inProgress;
-            needEvict = entry.needEvict;
-            profiled = entry.profiled;
-            downgrade = entry.downgrade;
-        }
-
         MSHREntryType getType() { return type; }
 
         bool getInProgress() { return inProgress; }
@@ -108,8 +157,8 @@ class MSHREntry {
 
         SimTime_t getStartTime() { return time; }
 
-        std::list<Addr>* getPointers() {
-            return evictPtrs;
+        MSHREvictPointers* getPointers() {
+            return &evictPtrs;
         }
 
         MemEventBase * getEvent() {
@@ -142,7 +191,7 @@ class MSHREntry {
                 str << " Type: Event" << " (" << event->getBriefString() << ")";
             } else if (type == MSHREntryType::Evict) {
                 str << " Type: Evict (";
-                for (std::list<Addr>::iterator it = evictPtrs->begin(); it != evictPtrs->end(); it++) {
+                for (MSHREvictPointers::iterator it = evictPtrs.begin(); it != evictPtrs.end(); it++) {
                     str << " 0x" << std::hex << *it;
                 }
                 str << ")";
@@ -154,7 +203,7 @@ class MSHREntry {
 
     private:
         MSHREntryType type;
-        std::list<Addr> *evictPtrs; // Specific to Evict type
+        MSHREvictPointers evictPtrs; // Specific to Evict type
         MemEventBase* event;        // Specific to Event type
         SimTime_t time;
         bool needEvict;
@@ -163,9 +212,87 @@ class MSHREntry {
         bool downgrade;             // Specific to Writeback type
 };
 
+/*
+ * Queue of entries for one address, stored in a power-of-2 ring
+ * The ring only grows; when a register is recycled its ring is reused so
+ * steady-state inserts and removes do not allocate.
+ */
+class MSHREntryQueue {
+    public:
+        MSHREntryQueue() : head_(0), count_(0) { }
+
+        size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        MSHREntry& operator[](size_t index) { return slots_[(head_ + index) & (slots_.size() - 1)]; }
+        MSHREntry& front() { return (*this)[0]; }
+        MSHREntry& back() { return (*this)[count_ - 1]; }
+
+        void push_back(const MSHREntry& entry) {
+            if (count_ == slots_.size())
+                grow();
+            count_++;
+            back() = entry;
+        }
+
+        void push_front(const MSHREntry& entry) {
+            if (count_ == slots_.size())
+                grow();
+            head_ = (head_ - 1) & (slots_.size() - 1);
+            count_++;
+            front() = entry;
+        }
+
+        void pop_front() {
+            front() = MSHREntry();
+            head_ = (head_ + 1) & (slots_.size() - 1);
+            count_--;
+        }
+
+        /* Insert before index (or at the back if index >= size) */
+        void insert(size_t index, const MSHREntry& entry) {
+            if (index >= count_) {
+                push_back(entry);
+                return;
+            }
+            if (count_ == slots_.size())
+                grow();
+            count_++;
+            for (size_t i = count_ - 1; i > index; i--)
+                (*this)[i] = std::move((*this)[i - 1]);
+            (*this)[index] = entry;
+        }
+
+        void erase(size_t index) {
+            for (size_t i = index; i + 1 < count_; i++)
+                (*this)[i] = std::move((*this)[i + 1]);
+            back() = MSHREntry();
+            count_--;
+        }
+
+        void clear() {
+            while (count_ != 0)
+                pop_front();
+            head_ = 0;
+        }
+
+    private:
+        void grow() {
+            std::vector<MSHREntry> slots(slots_.empty() ? 4 : slots_.size() * 2);
+            for (size_t i = 0; i < count_; i++)
+                slots[i] = std::move((*this)[i]);
+            slots_.swap(slots);
+            head_ = 0;
+        }
+
+        std::vector<MSHREntry> slots_;
+        size_t head_;
+        size_t count_;
+};
+
 struct MSHRRegister {
     MSHRRegister() : acksNeeded(0), dataDirty(false), pendingRetries(0) { }
-    list<MSHREntry> entries;
+    MSHREntryQueue entries;
     uint32_t acksNeeded;
     vector<uint8_t> dataBuffer;
     bool dataDirty;
@@ -174,9 +301,135 @@ struct MSHRRegister {
     uint32_t getPendingRetries() { return pendingRetries; }
     void addPendingRetry() { pendingRetries++; }
     void removePendingRetry() { pendingRetries--; }
+
+    /* Return to the empty state but keep allocated storage for reuse */
+    void reset() {
+        entries.clear();
+        acksNeeded = 0;
+        dataBuffer.clear();
+        dataDirty = false;
+        pendingRetries = 0;
+    }
 };
 
-typedef map<Addr, MSHRRegister> MSHRBlock;
+/*
+ * Address -> register map
+ * Open addressing with linear probing and backward-shift deletion so there are
+ * no tombstones. Registers live in a separate pool (stable addresses) and are
+ * recycled through a free list.
+ */
+class MSHRBlock {
+    public:
+        MSHRBlock() : count_(0), shift_(64) { }
+
+        void init(size_t expected) {
+            size_t capacity = 16;
+            while (capacity < expected * 2)
+                capacity <<= 1;
+            resize(capacity);
+        }
+
+        size_t size() const { return count_; }
+
+        MSHRRegister* find(Addr addr) {
+            for (size_t i = hash(addr); ; i = (i + 1) & (table_.size() - 1)) {
+                if (table_[i].reg == EMPTY)
+                    return nullptr;
+                if (table_[i].addr == addr)
+                    return &pool_[table_[i].reg];
+            }
+        }
+
+        /* Return the register for addr, creating an empty one if needed */
+        MSHRRegister* findOrInsert(Addr addr) {
+            if ((count_ + 1) * 2 > table_.size())
+                resize(table_.size() * 2);
+            size_t i = hash(addr);
+            for (; table_[i].reg != EMPTY; i = (i + 1) & (table_.size() - 1)) {
+                if (table_[i].addr == addr)
+                    return &pool_[table_[i].reg];
+            }
+            uint32_t reg;
+            if (free_.empty()) {
+                reg = pool_.size();
+                pool_.emplace_back();
+            } else {
+                reg = free_.back();
+                free_.pop_back();
+            }
+            table_[i].addr = addr;
+            table_[i].reg = reg;
+            count_++;
+            return &pool_[reg];
+        }
+
+        void erase(Addr addr) {
+            size_t mask = table_.size() - 1;
+            size_t i = hash(addr);
+            for (; table_[i].reg != EMPTY; i = (i + 1) & mask) {
+                if (table_[i].addr == addr)
+                    break;
+            }
+            if (table_[i].reg == EMPTY)
+                return;
+
+            pool_[table_[i].reg].reset();
+            free_.push_back(table_[i].reg);
+            count_--;
+
+            // Shift later members of the probe run back so lookups never stop early
+            size_t hole = i;
+            for (size_t j = (i + 1) & mask; table_[j].reg != EMPTY; j = (j + 1) & mask) {
+                size_t home = hash(table_[j].addr);
+                if (((j - home) & mask) >= ((j - hole) & mask)) {
+                    table_[hole] = table_[j];
+                    hole = j;
+                }
+            }
+            table_[hole].reg = EMPTY;
+        }
+
+        /* Call f(addr, register) for each address in the map (unordered) */
+        template<typename F>
+        void forEach(F f) {
+            for (Slot& slot : table_) {
+                if (slot.reg != EMPTY)
+                    f(slot.addr, pool_[slot.reg]);
+            }
+        }
+
+    private:
+        static constexpr uint32_t EMPTY = UINT32_MAX;
+
+        struct Slot {
+            Slot() : addr(0), reg(EMPTY) { }
+            Addr addr;
+            uint32_t reg;
+        };
+
+        size_t hash(Addr addr) const { return (addr * 0x9E3779B97F4A7C15ULL) >> shift_; }
+
+        void resize(size_t capacity) {
+            std::vector<Slot> old;
+            old.swap(table_);
+            table_.resize(capacity);
+            shift_ = 64 - __builtin_ctzll(capacity);
+            for (Slot& slot : old) {
+                if (slot.reg == EMPTY)
+                    continue;
+                size_t i = hash(slot.addr);
+                while (table_[i].reg != EMPTY)
+                    i = (i + 1) & (capacity - 1);
+                table_[i] = slot;
+            }
+        }
+
+        std::vector<Slot> table_;
+        std::deque<MSHRRegister> pool_;
+        std::vector<uint32_t> free_;
+        size_t count_;
+        uint32_t shift_;
+};
 
 /**
  *  Implements an MSHR with entries of type mshrEntry
@@ -199,7 +452,7 @@ public:
     MSHREntryType getFrontType(Addr addr);
 
     MemEventBase* getFrontEvent(Addr addr);
-    std::list<Addr>* getEvictPointers(Addr addr);
+    MSHREvictPointers* getEvictPointers(Addr addr);
     bool removeEvictPointer(Addr addr, Addr ptrAddr);
 
     // Special move accessor
@@ -257,6 +510,7 @@ public:
 private:
 
     void printDebug(uint32_t level, std::string action, Addr addr, std::string reason);
+    MSHREntry* getFrontEntry(Addr addr, const char* caller);
 
     MSHRBlock mshr_;
     Output* d_;
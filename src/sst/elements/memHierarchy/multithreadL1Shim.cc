@@ -16,6 +16,8 @@
 #include <sst_config.h>
 #include "multithreadL1Shim.h"
 
+#include <algorithm>
+
 #include <sst/core/params.h>
 #include <sst/core/interfaces/stringEvent.h>
 
@@ -68,12 +70,30 @@ MultiThreadL1::MultiThreadL1(ComponentId_t id, Params &params) : Component(id) {
     /* Setup throughput limiting */
     requestsPerCycle = params.find<uint64_t>("requests_per_cycle", 0);
     responsesPerCycle = params.find<uint64_t>("responses_per_cycle", 0);
+    threadRequestsPerCycle = params.find<uint64_t>("thread_requests_per_cycle", 0);
+
+    std::string arb = params.find<std::string>("arbitration", "age");
+    if (arb == "age") {
+        arbitration = Arbitration::Age;
+    } else if (arb == "roundrobin") {
+        arbitration = Arbitration::RoundRobin;
+    } else {
+        output.fatal(CALL_INFO, -1, "%s, Error: invalid parameter 'arbitration'. Options are 'age' and 'roundrobin'. You specified '%s'\n", getName().c_str(), arb.c_str());
+    }
+
+    requestQueues.resize(threadLinks.size());
+    threadSendCount.resize(threadLinks.size(), 0);
+    requestCount = 0;
+    requestSeq = 0;
+    nextThread = 0;
 }
 
 MultiThreadL1::~MultiThreadL1() {
-    while (requestQueue.size()) {
-        delete requestQueue.front();
-        requestQueue.pop();
+    for (RequestRing& ring : requestQueues) {
+        while (!ring.empty()) {
+            delete ring.front();
+            ring.pop();
+        }
     }
     while (responseQueue.size()) {
         delete responseQueue.front();
@@ -84,8 +104,9 @@ MultiThreadL1::~MultiThreadL1() {
 void MultiThreadL1::handleRequest(SST::Event * ev, unsigned int threadid) {
     MemEventBase *event = static_cast<MemEventBase*>(ev);
     if (!clockOn) enableClock();
-    threadRequestMap.insert(std::make_pair(event->getID(), threadid));
-    requestQueue.push(event);
+    threadRequestMap.insert(event->getID(), threadid);
+    requestQueues[threadid].push(event, requestSeq++);
+    requestCount++;
 }
 
 void MultiThreadL1::handleResponse(SST::Event * ev) {
@@ -97,12 +118,19 @@ void MultiThreadL1::handleResponse(SST::Event * ev) {
 bool MultiThreadL1::tick(SST::Cycle_t cycle) {
     timestamp++;
 
-    uint64_t sendcount = (requestsPerCycle == 0) ? requestQueue.size() : requestsPerCycle;
-
-    /* Drain request queue */
-    while (!requestQueue.empty() && sendcount > 0) {
-        cacheLink->send(requestQueue.front());
-        requestQueue.pop();
+    uint64_t sendcount = (requestsPerCycle == 0) ? requestCount : requestsPerCycle;
+    if (threadRequestsPerCycle != 0)
+        std::fill(threadSendCount.begin(), threadSendCount.end(), 0);
+
+    /* Drain request queues */
+    while (requestCount != 0 && sendcount > 0) {
+        unsigned int thread = arbitrate();
+        if (thread == threadLinks.size())
+            break;
+        cacheLink->send(requestQueues[thread].front());
+        requestQueues[thread].pop();
+        requestCount--;
+        threadSendCount[thread]++;
         sendcount--;
     }
 
@@ -113,7 +141,7 @@ bool MultiThreadL1::tick(SST::Cycle_t cycle) {
         MemEventBase * event = responseQueue.front();
         responseQueue.pop();
 
-        unsigned int linkid = threadRequestMap.find(event->getResponseToID())->second;
+        unsigned int linkid = *threadRequestMap.find(event->getResponseToID());
         threadRequestMap.erase(event->getResponseToID());
         threadLinks[linkid]->send(event);
 
@@ -121,13 +149,43 @@ bool MultiThreadL1::tick(SST::Cycle_t cycle) {
     }
 
     /* Turn off clock if queues are empty */
-    if (requestQueue.empty() && responseQueue.empty()) {
+    if (requestCount == 0 && responseQueue.empty()) {
         clockOn = false;
         return true;
     }
     return false;
 }
 
+/*
+ * Age: the thread whose head request arrived first. Since each thread's queue is in arrival
+ * order, this forwards requests in the same order as a single shared queue.
+ * RoundRobin: the next thread after the last one granted that has a waiting request.
+ * Threads that have reached 'thread_requests_per_cycle' this cycle are skipped.
+ */
+unsigned int MultiThreadL1::arbitrate() {
+    unsigned int threads = threadLinks.size();
+    unsigned int choice = threads;
+
+    if (arbitration == Arbitration::Age) {
+        for (unsigned int i = 0; i < threads; i++) {
+            if (requestQueues[i].empty() || (threadRequestsPerCycle != 0 && threadSendCount[i] == threadRequestsPerCycle))
+                continue;
+            if (choice == threads || requestQueues[i].frontSeq() < requestQueues[choice].frontSeq())
+                choice = i;
+        }
+    } else {
+        for (unsigned int i = 0; i < threads; i++) {
+            unsigned int thread = (nextThread + i) % threads;
+            if (requestQueues[thread].empty() || (threadRequestsPerCycle != 0 && threadSendCount[thread] == threadRequestsPerCycle))
+                continue;
+            choice = thread;
+            nextThread = (thread + 1) % threads;
+            break;
+        }
+    }
+    return choice;
+}
+
 inline void MultiThreadL1::enableClock() {
     clockOn = true;
     timestamp = reregisterClock(clock, clockHandler);
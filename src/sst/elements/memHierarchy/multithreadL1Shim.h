@@ -16,8 +16,8 @@
 #ifndef _MEMHIERARCHY_MULTITHREADL1_H_
 #define _MEMHIERARCHY_MULTITHREADL1_H_
 
-#include <map>
 #include <queue>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -28,6 +28,7 @@
 
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/slotTable.h"
 
 using namespace std;
 
@@ -43,6 +44,8 @@ public:
             {"clock",               "(string) Clock frequency or period with units (Hz or s; SI units OK).", NULL},
             {"requests_per_cycle",  "(uint) Number of requests to forward to L1 each cycle (for all threads combined). 0 indicates unlimited", "0"},
             {"responses_per_cycle", "(uint) Number of responses to forward to threads each cycle (for all threads combined). 0 indicates unlimited", "0"},
+            {"thread_requests_per_cycle", "(uint) Number of requests to forward to L1 each cycle from any one thread. 0 indicates unlimited", "0"},
+            {"arbitration",         "(string) How to choose among threads when more requests are waiting than can be forwarded. Options: age[oldest request first], roundrobin[rotate among threads with waiting requests]", "age"},
             {"debug",               "(uint) Where to print debug output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",         "(uint) Debug verbosity level. Between 0 and 10", "0"},
             {"debug_addr",          "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""} )
@@ -87,14 +90,68 @@ private:
     TimeConverter* clock;
 
     /** Track outstanding requests for routing responses correctly */
-    std::map<Event::id_type, unsigned int> threadRequestMap;
+    SlotTable<Event::id_type, unsigned int> threadRequestMap;
+
+    /** Per-thread queue of waiting requests. Requests are stamped with an arrival sequence number for age arbitration. */
+    class RequestRing {
+    public:
+        RequestRing() : head_(0), count_(0) { buffer_.resize(8); }
+
+        bool empty() const { return count_ == 0; }
+        size_t size() const { return count_; }
+
+        void push(MemEventBase* event, uint64_t seq) {
+            if (count_ == buffer_.size())
+                grow();
+            Entry& entry = buffer_[(head_ + count_) & (buffer_.size() - 1)];
+            entry.event = event;
+            entry.seq = seq;
+            count_++;
+        }
+
+        MemEventBase* front() const { return buffer_[head_].event; }
+        uint64_t frontSeq() const { return buffer_[head_].seq; }
+
+        void pop() {
+            head_ = (head_ + 1) & (buffer_.size() - 1);
+            count_--;
+        }
+
+    private:
+        struct Entry {
+            MemEventBase* event;
+            uint64_t seq;
+        };
+
+        void grow() {
+            std::vector<Entry> larger(buffer_.size() * 2);
+            for (size_t i = 0; i < count_; i++)
+                larger[i] = buffer_[(head_ + i) & (buffer_.size() - 1)];
+            buffer_.swap(larger);
+            head_ = 0;
+        }
+
+        std::vector<Entry> buffer_;
+        size_t head_;
+        size_t count_;
+    };
 
     /** Throughput control */
+    enum class Arbitration { Age, RoundRobin };
+    Arbitration arbitration;
     uint64_t requestsPerCycle;
     uint64_t responsesPerCycle;
-    std::queue<MemEventBase*> requestQueue;
+    uint64_t threadRequestsPerCycle;
+    std::vector<RequestRing> requestQueues;
+    std::vector<uint64_t> threadSendCount;  // Requests forwarded from each thread this cycle
+    uint64_t requestCount;                  // Waiting requests across all threads
+    uint64_t requestSeq;                    // Arrival stamp for the next request
+    unsigned int nextThread;                // Round-robin pointer
     std::queue<MemEventBase*> responseQueue;
 
+    /** Pick the thread whose request to forward next, or threadLinks.size() if none is eligible */
+    unsigned int arbitrate();
+
     inline void enableClock();
 };
 
@@ -0,0 +1,126 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+
+#include "regionProfiler.h"
+#include "util.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+BinnedRegionProfiler::BinnedRegionProfiler(ComponentId_t id, Params& params) : RegionProfiler(id, params) {
+    out_.init("", 1, 0, Output::STDOUT);
+
+    UnitAlgebra regionSize(params.find<std::string>("region_size", "4KiB"));
+    maxRegions_ = params.find<size_t>("max_regions", 4096);
+    samplePeriod_ = params.find<uint64_t>("sample_period", 1);
+    std::string format = params.find<std::string>("format", "csv");
+    filename_ = params.find<std::string>("output", "");
+
+    if (!regionSize.hasUnits("B") || !isPowerOfTwo(regionSize.getRoundedValue())) {
+        out_.fatal(CALL_INFO, -1, "%s, Invalid param: region_size - must be a power of two with units of 'B' (bytes). You specified %s.\n",
+                getName().c_str(), regionSize.toString().c_str());
+    }
+    if (maxRegions_ == 0) {
+        out_.fatal(CALL_INFO, -1, "%s, Invalid param: max_regions - must be at least 1.\n", getName().c_str());
+    }
+    if (samplePeriod_ == 0) {
+        out_.fatal(CALL_INFO, -1, "%s, Invalid param: sample_period - must be at least 1.\n", getName().c_str());
+    }
+    if (format != "csv" && format != "binary") {
+        out_.fatal(CALL_INFO, -1, "%s, Invalid param: format - must be 'csv' or 'binary'. You specified '%s'.\n",
+                getName().c_str(), format.c_str());
+    }
+
+    regionSize_ = regionSize.getRoundedValue();
+    regionShift_ = log2Of(regionSize_);
+    binary_ = (format == "binary");
+    if (filename_.empty())
+        filename_ = getParentComponentName() + (binary_ ? ".regions.bin" : ".regions.csv");
+
+    // Keep the table at most half full
+    size_t capacity = 16;
+    while (capacity < maxRegions_ * 2)
+        capacity <<= 1;
+    table_.resize(capacity);
+    hashShift_ = 64 - log2Of(capacity);
+    used_ = 0;
+    for (int i = 0; i < (int)RegionEvent::NumEvents; i++)
+        countdown_[i] = samplePeriod_;
+    written_ = false;
+}
+
+void BinnedRegionProfiler::finish() {
+    if (written_)
+        return;
+    written_ = true;
+
+    std::vector<const Region*> rows;
+    rows.reserve(used_ + 1);
+    for (const Region& region : table_) {
+        if (region.key != EMPTY)
+            rows.push_back(&region);
+    }
+    std::sort(rows.begin(), rows.end(), [](const Region* a, const Region* b) { return a->key < b->key; });
+
+    bool haveOther = false;
+    for (int i = 0; i < (int)RegionEvent::NumEvents; i++)
+        haveOther |= (other_.counts[i] != 0);
+    if (haveOther)
+        rows.push_back(&other_);
+
+    FILE* fp = fopen(filename_.c_str(), binary_ ? "wb" : "w");
+    if (!fp) {
+        out_.fatal(CALL_INFO, -1, "%s, Error: unable to open region profile '%s' for writing.\n", getName().c_str(), filename_.c_str());
+    }
+
+    if (binary_) {
+        uint32_t version = 1;
+        uint64_t rowCount = rows.size();
+        fwrite("MHRP", 1, 4, fp);
+        fwrite(&version, sizeof(version), 1, fp);
+        fwrite(&regionSize_, sizeof(regionSize_), 1, fp);
+        fwrite(&samplePeriod_, sizeof(samplePeriod_), 1, fp);
+        fwrite(&rowCount, sizeof(rowCount), 1, fp);
+        for (const Region* region : rows) {
+            uint64_t row[2 + (int)RegionEvent::NumEvents];
+            row[0] = (region == &other_) ? UINT64_MAX : region->key << regionShift_;
+            for (int i = 0; i < (int)RegionEvent::NumEvents; i++)
+                row[1 + i] = region->counts[i] * samplePeriod_;
+            row[1 + (int)RegionEvent::NumEvents] = region->sharers;
+            fwrite(row, sizeof(row), 1, fp);
+        }
+    } else {
+        fprintf(fp, "region_start,accesses,misses,evictions,invalidations,sharers\n");
+        for (const Region* region : rows) {
+            if (region == &other_)
+                fprintf(fp, "other");
+            else
+                fprintf(fp, "0x%" PRIx64, region->key << regionShift_);
+            for (int i = 0; i < (int)RegionEvent::NumEvents; i++)
+                fprintf(fp, ",%" PRIu64, region->counts[i] * samplePeriod_);
+            fprintf(fp, ",%d\n", __builtin_popcountll(region->sharers));
+        }
+    }
+    fclose(fp);
+}
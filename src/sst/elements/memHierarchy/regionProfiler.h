@@ -0,0 +1,140 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_REGIONPROFILER_H
+#define MEMHIERARCHY_REGIONPROFILER_H
+
+#include <string>
+#include <vector>
+
+#include <sst/core/subcomponent.h>
+#include <sst/core/output.h>
+#include <sst/core/warnmacros.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/* What a profiler is told about. Directories report memory fetches as misses and directory entry evictions as evictions. */
+enum class RegionEvent { Access, Miss, Evict, Inv, NumEvents };
+
+/*
+ * Optional observer that records where in the address space a cache or directory sees
+ * traffic. Owners load it from their 'profiler' slot and call record() on the events above.
+ */
+class RegionProfiler : public SubComponent {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::RegionProfiler)
+
+    RegionProfiler(ComponentId_t id, Params& UNUSED(params)) : SubComponent(id) { }
+    virtual ~RegionProfiler() { }
+
+    /* 'source' identifies the requestor for accesses (e.g., the event's source endpoint) and is 0 otherwise */
+    virtual void record(RegionEvent type, Addr addr, uint64_t source) = 0;
+};
+
+/*
+ * Bins events into fixed-size address regions and writes a heatmap at the end of simulation
+ *
+ * The table of regions has a fixed capacity. Once it is full, events to regions not
+ * already in it are counted in a single overflow row. With a sample period N, one event
+ * of each type in every N is recorded and the output counts are scaled by N. Types are
+ * counted down separately, so which misses are sampled does not depend on how they
+ * interleave with accesses.
+ *
+ * Each region also keeps a 64-bit mask of the requestors that accessed it (source mod 64).
+ * A region with many sharers and many invalidations is a candidate for false sharing.
+ *
+ * CSV output has one row per region, sorted by address:
+ *      region_start,accesses,misses,evictions,invalidations,sharers
+ * The overflow row has region_start 'other'.
+ * Binary output is a header { char magic[4] = "MHRP"; uint32 version = 1; uint64 region_size;
+ * uint64 sample_period; uint64 row_count; } followed by row_count rows of
+ * { uint64 region_start; uint64 counts[4]; uint64 sharer_mask; }, in host byte order,
+ * with the overflow row last and region_start = UINT64_MAX.
+ */
+class BinnedRegionProfiler : public RegionProfiler {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(BinnedRegionProfiler, "memHierarchy", "regionProfiler", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Counts accesses, misses, evictions, and invalidations per address region and writes a CSV or binary heatmap at finish", SST::MemHierarchy::RegionProfiler)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"region_size",     "(string) Size of each address region, with units. Must be a power of 2.", "4KiB"},
+            {"max_regions",     "(uint) Number of regions tracked individually. Further regions are counted together.", "4096"},
+            {"sample_period",   "(uint) Record one event of each type in every sample_period. Counts in the output are scaled back up.", "1"},
+            {"format",          "(string) Output format: 'csv' or 'binary'", "csv"},
+            {"output",          "(string) Output file name. Defaults to the owner's name with '.regions.csv' or '.regions.bin' appended.", ""} )
+
+    BinnedRegionProfiler(ComponentId_t id, Params& params);
+    virtual ~BinnedRegionProfiler() { }
+
+    virtual void record(RegionEvent type, Addr addr, uint64_t source) override {
+        if (--countdown_[(int)type] != 0)
+            return;
+        countdown_[(int)type] = samplePeriod_;
+        Region* region = findRegion(addr >> regionShift_);
+        region->counts[(int)type]++;
+        if (type == RegionEvent::Access)
+            region->sharers |= (uint64_t)1 << (source & 63);
+    }
+
+    /* Write the heatmap. Safe to call more than once; only the first call writes. */
+    virtual void finish() override;
+
+private:
+    static constexpr uint64_t EMPTY = UINT64_MAX;
+
+    struct Region {
+        Region() : key(EMPTY), sharers(0) { for (int i = 0; i < (int)RegionEvent::NumEvents; i++) counts[i] = 0; }
+        uint64_t key;   // Region number (address >> regionShift_)
+        uint64_t counts[(int)RegionEvent::NumEvents];
+        uint64_t sharers;
+    };
+
+    /* Open addressing without deletion; the table never holds more than maxRegions_ entries */
+    Region* findRegion(uint64_t key) {
+        size_t mask = table_.size() - 1;
+        for (size_t i = (key * 0x9E3779B97F4A7C15ULL) >> hashShift_; ; i = (i + 1) & mask) {
+            if (table_[i].key == key)
+                return &table_[i];
+            if (table_[i].key == EMPTY) {
+                if (used_ == maxRegions_)
+                    return &other_;
+                used_++;
+                table_[i].key = key;
+                return &table_[i];
+            }
+        }
+    }
+
+    Output out_;
+    std::vector<Region> table_;
+    Region other_;
+    size_t used_;
+    size_t maxRegions_;
+    uint32_t hashShift_;
+    uint32_t regionShift_;
+    uint64_t regionSize_;
+    uint64_t samplePeriod_;
+    uint64_t countdown_[(int)RegionEvent::NumEvents];  // Per type, so that sampling of one type does not alias another
+    bool binary_;
+    bool written_;
+    std::string filename_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_REGIONPROFILER_H */
@@ -16,6 +16,8 @@
 #ifndef MEMHIERARCHY_REPLACEMENT_POLICY_H
 #define	MEMHIERARCHY_REPLACEMENT_POLICY_H
 
+#include <algorithm>
+
 #include "sst/core/subcomponent.h"
 #include "sst/core/rng/marsaglia.h"
 
@@ -33,18 +35,33 @@ namespace MemHierarchy {
  */
 class ReplacementInfo {
     public:
-        ReplacementInfo(unsigned int i, State s) : index(i), state(s) { }
+        ReplacementInfo(unsigned int i, State s) : index(i), state(s), validWord(nullptr), validBit(0) { }
         virtual ~ReplacementInfo() { }
 
         unsigned int getIndex() { return index; }
         void setIndex(unsigned int i) { index = i; }
 
         State getState() { return state; }
-        void setState(State s) { state = s; }
+        void setState(State s) {
+            state = s;
+            if (validWord) {
+                if (s == I) *validWord &= ~validBit;
+                else        *validWord |= validBit;
+            }
+        }
+
+        /* Keep bit 'bit' of '*word' equal to (state != I) from now on. Used by policies that track invalid ways in packed masks */
+        void trackValid(uint64_t* word, uint64_t bit) {
+            validWord = word;
+            validBit = bit;
+            setState(state);
+        }
 
     protected:
         unsigned int index;
         State state;
+        uint64_t* validWord;
+        uint64_t validBit;
 };
 
 class CoherenceReplacementInfo : public ReplacementInfo {
@@ -705,6 +722,354 @@ public:
 };
 
 
+/* ------------------------------------------------------------------------------------------
+ *  Packed-metadata policies
+ *  - Per-set state lives in packed 64-bit words instead of one timestamp per line, and
+ *    victim selection is a handful of word operations rather than a scan of the set
+ *  - Invalid ways are tracked in a per-set valid mask that the lines' ReplacementInfo keep
+ *    up to date (see ReplacementInfo::trackValid), so "replace an invalid line first" is a
+ *    find-first-zero instead of a scan of line states
+ *  - Like NMRU, these assume that a set's line indices are contiguous
+ * ------------------------------------------------------------------------------------------*/
+class PackedReplacementPolicy : public ReplacementPolicy {
+public:
+    PackedReplacementPolicy(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity),
+            ways(associativity), bestCandidate(0) {
+        sets = lines / associativity;
+        maskWords = (ways + 63) / 64;
+        valid.resize(sets * maskWords, 0);
+        tracked.resize(sets, false);
+    }
+
+    virtual ~PackedReplacementPolicy() { }
+
+    bool checkCompatibility(ReplacementInfo * rInfo) { return true; } // No cast
+
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
+        uint64_t setBegin = rInfo[0]->getIndex();
+        uint64_t set = setBegin / ways;
+        if (!tracked[set]) {
+            for (uint64_t i = 0; i < ways; i++)
+                rInfo[i]->trackValid(&valid[set * maskWords + i / 64], 1ULL << (i % 64));
+            tracked[set] = true;
+        }
+
+        uint64_t way = findInvalid(set);
+        if (way == ways)
+            way = findVictim(set);
+        bestCandidate = setBegin + way;
+        return bestCandidate;
+    }
+
+    uint64_t getBestCandidate() { return bestCandidate; }
+
+protected:
+    /* Policy-specific choice among the (all valid) ways of 'set' */
+    virtual uint64_t findVictim(uint64_t set) = 0;
+
+    /* Mask with the low 'n' bits set, n in [0,64] */
+    static uint64_t lowBits(uint64_t n) { return n >= 64 ? ~0ULL : (1ULL << n) - 1; }
+
+    /* Lowest way that is not valid, or 'ways' if all are */
+    uint64_t findInvalid(uint64_t set) {
+        const uint64_t* word = &valid[set * maskWords];
+        for (uint64_t w = 0; w < maskWords; w++) {
+            uint64_t free = ~word[w] & lowBits(ways - w * 64);
+            if (free)
+                return w * 64 + __builtin_ctzll(free);
+        }
+        return ways;
+    }
+
+    uint64_t ways;
+    uint64_t sets;
+    uint64_t maskWords;             // Words per set in a one-bit-per-way mask
+    uint64_t bestCandidate;
+    std::vector<uint64_t> valid;    // Per-set valid masks, kept current by the lines' ReplacementInfo
+    std::vector<bool> tracked;      // Whether a set's lines have been hooked up to 'valid' yet
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Tree pseudo-LRU
+ *  - One bit per internal node of a binary tree over the ways; each bit points toward the
+ *    less recently used half. Update and victim selection walk one root-to-leaf path.
+ *  - Associativity does not need to be a power of 2; subtrees with no ways are skipped
+ * ------------------------------------------------------------------------------------------*/
+class TreePLRU : public PackedReplacementPolicy {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(TreePLRU, "memHierarchy", "replacement.tree-plru", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "tree pseudo-LRU replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    TreePLRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : PackedReplacementPolicy(id, params, lines, associativity) {
+        leaves = 1;
+        while (leaves < ways)
+            leaves <<= 1;
+        treeWords = (leaves - 1 + 63) / 64;
+        if (treeWords == 0) treeWords = 1;
+        tree.resize(sets * treeWords, 0);
+    }
+
+    virtual ~TreePLRU() { }
+
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        uint64_t* bits = &tree[(id / ways) * treeWords];
+        uint64_t way = id % ways;
+        uint64_t node = 1;
+        for (uint64_t half = leaves >> 1; half != 0; half >>= 1) {
+            uint64_t right = (way & half) ? 1 : 0;
+            uint64_t bit = 1ULL << ((node - 1) % 64);
+            if (right) bits[(node - 1) / 64] &= ~bit; // Point away from the way just used
+            else       bits[(node - 1) / 64] |= bit;
+            node = 2 * node + right;
+        }
+    }
+
+    void replaced(uint64_t id) { }
+
+protected:
+    uint64_t findVictim(uint64_t set) {
+        const uint64_t* bits = &tree[set * treeWords];
+        uint64_t way = 0;
+        uint64_t node = 1;
+        for (uint64_t half = leaves >> 1; half != 0; half >>= 1) {
+            uint64_t right = (bits[(node - 1) / 64] >> ((node - 1) % 64)) & 1;
+            if (right && (way | half) >= ways)
+                right = 0;
+            if (right)
+                way |= half;
+            node = 2 * node + right;
+        }
+        return way;
+    }
+
+private:
+    uint64_t leaves;        // Associativity rounded up to a power of 2
+    uint64_t treeWords;     // Words per set
+    std::vector<uint64_t> tree;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Bit pseudo-LRU (a.k.a. MRU-bit)
+ *  - One bit per way, set on use. When every bit in a set is set, all but the most recent
+ *    are cleared. The victim is the lowest way with a clear bit.
+ * ------------------------------------------------------------------------------------------*/
+class BitPLRU : public PackedReplacementPolicy {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(BitPLRU, "memHierarchy", "replacement.bit-plru", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "bit pseudo-LRU (MRU-bit) replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    BitPLRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : PackedReplacementPolicy(id, params, lines, associativity) {
+        used.resize(sets * maskWords, 0);
+    }
+
+    virtual ~BitPLRU() { }
+
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        uint64_t* bits = &used[(id / ways) * maskWords];
+        uint64_t way = id % ways;
+        bits[way / 64] |= 1ULL << (way % 64);
+
+        for (uint64_t w = 0; w < maskWords; w++) {
+            if (bits[w] != lowBits(ways - w * 64))
+                return;
+        }
+        for (uint64_t w = 0; w < maskWords; w++)
+            bits[w] = 0;
+        bits[way / 64] = 1ULL << (way % 64);
+    }
+
+    void replaced(uint64_t id) {
+        uint64_t way = id % ways;
+        used[(id / ways) * maskWords + way / 64] &= ~(1ULL << (way % 64));
+    }
+
+protected:
+    uint64_t findVictim(uint64_t set) {
+        const uint64_t* bits = &used[set * maskWords];
+        for (uint64_t w = 0; w < maskWords; w++) {
+            uint64_t clear = ~bits[w] & lowBits(ways - w * 64);
+            if (clear)
+                return w * 64 + __builtin_ctzll(clear);
+        }
+        return 0; // Not reached, a full set is reset on update
+    }
+
+private:
+    std::vector<uint64_t> used;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Re-reference interval prediction (RRIP)
+ *  - Each way has a 2-bit re-reference prediction value (RRPV), packed 32 to a word
+ *  - Hits set the RRPV to 0. The victim is the lowest way with RRPV 3; if there is none, all
+ *    RRPVs in the set are aged until one reaches 3. Matching lanes are found with a few
+ *    bitwise operations per word.
+ *  - SRRIP inserts new lines at RRPV 2. BRRIP inserts at 3 and only occasionally at 2,
+ *    which keeps a streaming access pattern from flushing the set.
+ * ------------------------------------------------------------------------------------------*/
+class RRIP : public PackedReplacementPolicy {
+public:
+    RRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : PackedReplacementPolicy(id, params, lines, associativity) {
+        rrpvWords = (ways + 31) / 32;
+        rrpv.resize(sets * rrpvWords, 0);
+        inserted.resize(sets * maskWords, 0);
+    }
+
+    virtual ~RRIP() { }
+
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        uint64_t set = id / ways;
+        uint64_t way = id % ways;
+        uint64_t* ins = &inserted[set * maskWords + way / 64];
+        uint64_t insBit = 1ULL << (way % 64);
+
+        uint64_t value = 0;
+        if (*ins & insBit) { // First use since the line was (re)filled
+            *ins &= ~insBit;
+            value = insertionValue();
+        }
+        uint64_t& word = rrpv[set * rrpvWords + way / 32];
+        uint64_t shift = (way % 32) * 2;
+        word = (word & ~(3ULL << shift)) | (value << shift);
+    }
+
+    void replaced(uint64_t id) {
+        uint64_t way = id % ways;
+        inserted[(id / ways) * maskWords + way / 64] |= 1ULL << (way % 64);
+    }
+
+protected:
+    virtual uint64_t insertionValue() = 0;
+
+    uint64_t findVictim(uint64_t set) {
+        uint64_t* words = &rrpv[set * rrpvWords];
+        for (int age = 0; age < 4; age++) {
+            for (uint64_t w = 0; w < rrpvWords; w++) {
+                uint64_t distant = words[w] & (words[w] >> 1) & laneMask(w); // Low bit of each lane that holds 3
+                if (distant)
+                    return w * 32 + __builtin_ctzll(distant) / 2;
+            }
+            for (uint64_t w = 0; w < rrpvWords; w++) // No lane is 3 so adding 1 to each cannot carry
+                words[w] += laneMask(w);
+        }
+        return 0; // Not reached
+    }
+
+private:
+    /* 0b01 in each lane of word 'w' that holds a way */
+    uint64_t laneMask(uint64_t w) const {
+        return 0x5555555555555555ULL & lowBits(2 * (ways - w * 32));
+    }
+
+    uint64_t rrpvWords;             // Words per set
+    std::vector<uint64_t> rrpv;
+    std::vector<uint64_t> inserted; // Per-set mask of ways refilled but not yet used
+};
+
+class SRRIP : public RRIP {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(SRRIP, "memHierarchy", "replacement.srrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "static re-reference interval prediction (SRRIP) replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    SRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : RRIP(id, params, lines, associativity) { }
+    virtual ~SRRIP() { }
+
+protected:
+    uint64_t insertionValue() { return 2; }
+};
+
+class BRRIP : public RRIP {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(BRRIP, "memHierarchy", "replacement.brrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "bimodal re-reference interval prediction (BRRIP) replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"throttle",    "One in this many new lines is inserted with a long (rather than distant) re-reference prediction", "32"},
+            {"seed_a",      "Seed for random number generator", "1"},
+            {"seed_b",      "Seed for random number generator", "1"} )
+
+    BRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : RRIP(id, params, lines, associativity) {
+        throttle = params.find<uint64_t>("throttle", 32);
+        if (throttle == 0) throttle = 1;
+        uint64_t seeda = params.find<uint64_t>("seed_a", 1);
+        uint64_t seedb = params.find<uint64_t>("seed_b", 1);
+        gen = new SST::RNG::MarsagliaRNG(seeda, seedb);
+    }
+
+    virtual ~BRRIP() {
+        delete gen;
+    }
+
+protected:
+    uint64_t insertionValue() { return (gen->generateNextUInt64() % throttle == 0) ? 2 : 3; }
+
+private:
+    uint64_t throttle;
+    SST::RNG::MarsagliaRNG* gen;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  True LRU with a recency stack
+ *  - Each set keeps its ways ordered from most to least recently used, so the victim is
+ *    simply the last entry
+ *  - Up to 16 ways, the stack is packed into one word as 4-bit way numbers and an update
+ *    is a SWAR nibble match plus a shift. Larger sets use an array of way numbers.
+ * ------------------------------------------------------------------------------------------*/
+class LRUStack : public PackedReplacementPolicy {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(LRUStack, "memHierarchy", "replacement.lru-stack", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "least-recently-used replacement policy using a per-set recency stack", SST::MemHierarchy::ReplacementPolicy);
+
+    LRUStack(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : PackedReplacementPolicy(id, params, lines, associativity) {
+        packed = ways <= 16;
+        if (packed) {
+            // Way i starts at position i
+            uint64_t init = 0;
+            for (uint64_t i = 0; i < ways; i++)
+                init |= i << (4 * i);
+            nibbles.resize(sets, init);
+        } else {
+            stack.resize(sets * ways);
+            for (uint64_t i = 0; i < stack.size(); i++)
+                stack[i] = i % ways;
+        }
+    }
+
+    virtual ~LRUStack() { }
+
+    void update(uint64_t id, ReplacementInfo * rInfo) {
+        uint64_t set = id / ways;
+        uint64_t way = id % ways;
+        if (packed) {
+            uint64_t& word = nibbles[set];
+            uint64_t diff = word ^ (way * 0x1111111111111111ULL);
+            uint64_t zero = (diff - 0x1111111111111111ULL) & ~diff & 0x8888888888888888ULL; // Lowest flag marks the first nibble equal to 'way'
+            uint64_t pos = __builtin_ctzll(zero) / 4;
+            uint64_t newer = word & lowBits(4 * pos);
+            word = (word & ~lowBits(4 * pos + 4)) | (newer << 4) | way;
+        } else {
+            uint16_t* entries = &stack[set * ways];
+            uint16_t* pos = std::find(entries, entries + ways, (uint16_t)way);
+            std::copy_backward(entries, pos, pos + 1);
+            entries[0] = way;
+        }
+    }
+
+    void replaced(uint64_t id) { }
+
+protected:
+    uint64_t findVictim(uint64_t set) {
+        if (packed)
+            return (nibbles[set] >> (4 * (ways - 1))) & 0xF;
+        return stack[set * ways + ways - 1];
+    }
+
+private:
+    bool packed;
+    std::vector<uint64_t> nibbles;  // Packed stacks, position 0 (most recent) in the low nibble
+    std::vector<uint16_t> stack;    // Unpacked stacks, 'ways' entries per set
+};
+
 }}
 
 
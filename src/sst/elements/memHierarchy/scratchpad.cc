@@ -91,6 +91,7 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
 
     // Line size
     scratchLineSize_ = params.find<uint64_t>("scratch_line_size", 64);
+    nameID_ = EndpointRegistry::intern(getName());
     remoteLineSize_ = params.find<uint64_t>("memory_line_size", 64);
 
     if (scratchSize_ % scratchLineSize_ != 0) {
@@ -319,7 +320,7 @@ void Scratchpad::init(unsigned int phase) {
             }
         } else { // Not a NULLCMD
             MemEventInit * memRequest = new MemEventInit(getName(), initEv->getCmd(), initEv->getAddr() - remoteAddrOffset_, initEv->getPayload());
-            memRequest->setDst(linkDown_->getTargetDestination(memRequest->getAddr()));
+            memRequest->setDstID(linkDown_->getTargetDestinationID(memRequest->getAddr()));
             linkDown_->sendUntimedData(memRequest);
         }
         delete initEv;
@@ -416,17 +417,17 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    ForwardedRequest * fwd = forwarded_.find(ev->getResponseToID());
 
-    if (it == responseIDMap_.end()) {
-        dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
+    if (fwd == nullptr) {
+        dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching forwarded request, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
                 getName().c_str(), ev->getResponseToID().first, ev->getResponseToID().second, timestamp_);
     }
 
-    SST::Event::id_type requestID = it->second;
-    responseIDMap_.erase(it);
+    SST::Event::id_type requestID = fwd->requestID;
+    forwarded_.erase(ev->getResponseToID());
 
-    MemEventBase * requestBase = outstandingEventList_.find(requestID)->second.request;
+    MemEventBase * requestBase = outstanding_.find(requestID)->request;
 
     if (requestBase->getCmd() == Command::Get) handleRemoteGetResponse(ev, requestID);
     else handleRemoteReadResponse(ev, requestID);
@@ -444,8 +445,8 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
     // issue ready events
     uint32_t responseThisCycle = (responsesPerCycle_ == 0) ? 1 : 0;
-    while (!procMsgQueue_.empty() && procMsgQueue_.begin()->first < timestamp_) {
-        MemEventBase * sendEv = procMsgQueue_.begin()->second;
+    while (procMsgQueue_.ready(timestamp_)) {
+        MemEventBase * sendEv = procMsgQueue_.front();
 
         if (is_debug_event(sendEv)) {
             debug = true;
@@ -454,14 +455,14 @@ bool Scratchpad::clock(Cycle_t cycle) {
         }
 
         linkUp_->send(sendEv);
-        procMsgQueue_.erase(procMsgQueue_.begin());
+        procMsgQueue_.pop();
         responseThisCycle++;
         if (responseThisCycle == responsesPerCycle_) break;
     }
 
-    while (!memMsgQueue_.empty() && memMsgQueue_.begin()->first < timestamp_) {
-        MemEvent * sendEv = memMsgQueue_.begin()->second;
-        sendEv->setDst(linkDown_->getTargetDestination(sendEv->getBaseAddr()));
+    while (memMsgQueue_.ready(timestamp_)) {
+        MemEvent * sendEv = memMsgQueue_.front();
+        sendEv->setDstID(linkDown_->getTargetDestinationID(sendEv->getBaseAddr()));
 
         if (is_debug_event(sendEv)) {
             debug = true;
@@ -471,7 +472,7 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
         linkDown_->send(sendEv);
 
-        memMsgQueue_.erase(memMsgQueue_.begin());
+        memMsgQueue_.pop();
     }
 
     linkDown_->clock();
@@ -534,24 +535,22 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
     if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) // Send data in exclusive state to let caches decide what to do with it
         response->setCmd(Command::GetXResp);
 
-    MemEvent * read = new MemEvent(getName(), ev->getAddr(), ev->getBaseAddr(), Command::GetS, ev->getSize());
+    MemEvent * read = new MemEvent(nameID_, ev->getAddr(), ev->getBaseAddr(), Command::GetS, ev->getSize());
     read->copyMetadata(ev);
 
-    responseIDMap_.insert(std::make_pair(read->getID(),ev->getID()));
-    responseIDAddrMap_.insert(std::make_pair(read->getID(),ev->getBaseAddr()));
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    forwarded_.insert(read->getID(), ForwardedRequest(ev->getID(), ev->getBaseAddr()));
+    outstanding_.insert(ev->getID(), OutstandingEvent(ev,response));
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
-        std::vector<uint8_t> data = doScratchRead(read);
-        response->setPayload(data);
-        mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false))));
+    if (mshr_.find(ev->getBaseAddr()) == nullptr) {
+        doScratchRead(read, response->allocatePayload(read->getSize()));
+        mshr_.insert(ev->getBaseAddr(), std::list<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false)));
         if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = true;
         }
         if (is_debug_addr(addr))
             eventDI.action = "ScrRead";
     } else {
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetS, read));
+        mshr_.find(ev->getBaseAddr())->push_back(MSHREntry(ev->getID(), Command::GetS, read));
         if (is_debug_addr(addr)) {
             eventDI.action = "stall";
             eventDI.reason = "MSHR conflict";
@@ -560,7 +559,7 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
 
     if (is_debug_event(ev)) {
         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->second.back().getString().c_str());
+                getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->back().getString().c_str());
     }
 }
 
@@ -587,13 +586,13 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     bool doWrite = false; // Decide whether to handle this write immediately EVEN if a conflict
     bool inserted = false;
     /* Check for writeback/invalidation races */
-    if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
-        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+    if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != nullptr) {
+        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->front());
+        if (outstanding_.find(entry->id)->request->getCmd() == Command::Get) {
             handleAckInv(ev);
             return;
             // TODO handle corner cases where Get only writes partial line
-        } else if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Put) {
+        } else if (outstanding_.find(entry->id)->request->getCmd() == Command::Put) {
             if (ev->getPayload().empty()) {
                 handleAckInv(ev);
             } else {
@@ -601,10 +600,10 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
             }
             return;
         }
-    } else if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
+    } else if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != nullptr) {
         /* Drop writeback if we're stalled waiting for a ForceInv response */
-        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->front());
+        if (outstanding_.find(entry->id)->request->getCmd() == Command::Get) {
             MemEvent * response = ev->makeResponse();
             sendResponse(response);
             delete ev;
@@ -628,15 +627,15 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     MemEvent * response = nullptr;
     response = ev->makeResponse();
 
-    MemEvent * write = new MemEvent(getName(), ev->getAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
+    MemEvent * write = new MemEvent(nameID_, ev->getAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
     write->copyMetadata(ev);
     write->setFlag(MemEvent::F_NORESPONSE);
 
-    if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
+    if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != nullptr) {
         /* For directory - jump write ahead of a Put so we have correct data but otherwise
          * do not resolve race by treating writeback as ackinv since it may not actually signal that
          * the block is not present in caches */
-        std::list<MSHREntry>* entry = &(mshr_.find(ev->getBaseAddr())->second);
+        std::list<MSHREntry>* entry = mshr_.find(ev->getBaseAddr());
         for (std::list<MSHREntry>::iterator it = entry->begin(); it != entry->end(); it++) {
             if (it->cmd == Command::Put) {
                 if (it == entry->begin()) {
@@ -644,7 +643,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
                     sendResponse(response); /* Send response when request is sent to scratch, since scratch doesn't respond */
                     delete ev;
                 } else {
-                    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+                    outstanding_.insert(ev->getID(), OutstandingEvent(ev,response));
                     it = entry->insert(it, MSHREntry(ev->getID(), Command::GetX, write));
 
                     if (is_debug_event(ev))
@@ -656,7 +655,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
         }
     }
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
+    if (mshr_.find(ev->getBaseAddr()) == nullptr) {
         doScratchWrite(write);
         sendResponse(response); /* Send response when request is sent to scratch since scratch doesn't respond */
         delete ev;
@@ -665,12 +664,12 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = directory_;
         }
     } else {
-        outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetX, write));
+        outstanding_.insert(ev->getID(), OutstandingEvent(ev,response));
+        mshr_.find(ev->getBaseAddr())->push_back(MSHREntry(ev->getID(), Command::GetX, write));
 
         if (is_debug_event(ev))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                        getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->second.back().getString().c_str());
+                        getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->back().getString().c_str());
     }
 }
 
@@ -697,23 +696,23 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     stat_ScratchGetReceived->addData(1);
 
     MoveEvent * response = ev->makeResponse();
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    outstanding_.insert(ev->getID(), OutstandingEvent(ev,response));
 
     // Issue remote read
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
-    MemEvent * remoteRead = new MemEvent(getName(), ev->getSrcAddr() - remoteAddrOffset_, ev->getSrcBaseAddr(), Command::GetS, ev->getSize());
+    MemEvent * remoteRead = new MemEvent(nameID_, ev->getSrcAddr() - remoteAddrOffset_, ev->getSrcBaseAddr(), Command::GetS, ev->getSize());
     remoteRead->MemEventBase::copyMetadata(ev);
     remoteRead->setFlag(MemEvent::F_NONCACHEABLE);
     remoteRead->setVirtualAddress(ev->getSrcVirtualAddress());
     remoteRead->setInstructionPointer(ev->getInstructionPointer());
-    responseIDMap_.insert(std::make_pair(remoteRead->getID(), ev->getID()));
+    forwarded_.insert(remoteRead->getID(), ForwardedRequest(ev->getID(), 0));
 
     if (is_debug_event(remoteRead)) {
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get           0x%-16" PRIx64 " 0x%-16" PRIx64 " Remote Read (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), saddr, daddr, remoteRead->getID().first, remoteRead->getID().second, remoteRead->getBaseAddr());
     }
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, remoteRead));
+    memMsgQueue_.insert(timestamp_, remoteRead);
 
     // Insert into mshr and send inv if needed
     // start base addr -> end base addr
@@ -721,18 +720,18 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     uint32_t lineCount = 1 + (ev->getDstAddr() + ev->getSize() - ev->getDstBaseAddr() - 1)/ scratchLineSize_;
     for (uint32_t i = 0; i < lineCount; i++) {
         Addr baseAddr = ev->getDstBaseAddr() + i*scratchLineSize_;
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        if (mshr_.find(baseAddr) == nullptr) {
             bool needAck = startGet(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck))));
+            mshr_.insert(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck)));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
+            mshr_.find(baseAddr)->push_back(MSHREntry(ev->getID(), Command::Get, true));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->back().getString().c_str());
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstanding_.find(ev->getID())->incrementCount();
     }
 }
 
@@ -758,12 +757,12 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
     MoveEvent * response = ev->makeResponse();
     ev->setDstBaseAddr((ev->getDstBaseAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
 
-    MemEvent * remoteWrite = new MemEvent(getName(), ev->getDstAddr() - remoteAddrOffset_, ev->getDstBaseAddr(), Command::GetX, ev->getSize());
+    MemEvent * remoteWrite = new MemEvent(nameID_, ev->getDstAddr() - remoteAddrOffset_, ev->getDstBaseAddr(), Command::GetX, ev->getSize());
     remoteWrite->setZeroPayload(ev->getSize());
     remoteWrite->setFlag(MemEvent::F_NONCACHEABLE);
     remoteWrite->setFlag(MemEvent::F_NORESPONSE);
 
-    outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
+    outstanding_.insert(ev->getID(), OutstandingEvent(ev, response, remoteWrite));
 
     Addr addr = ev->getSrcAddr();
     Addr baseAddr = ev->getSrcBaseAddr();
@@ -772,23 +771,23 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
 
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        if (mshr_.find(baseAddr) == nullptr) {
             bool needAck = startPut(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
+            mshr_.insert(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck)));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
+            mshr_.find(baseAddr)->push_back(MSHREntry(ev->getID(), Command::Put));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(),
-                    baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    baseAddr, mshr_.find(baseAddr)->back().getString().c_str());
 
         bytesLeft -= size;
         baseAddr += scratchLineSize_;
         addr = baseAddr;
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstanding_.find(ev->getID())->incrementCount();
     }
 }
 
@@ -801,17 +800,16 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
  *  All others (regular read responses): call finishRequest()
  */
 void Scratchpad::handleScratchResponse(SST::Event::id_type responseID) {
-    SST::Event::id_type requestID = responseIDMap_.find(responseID)->second;
-    responseIDMap_.erase(responseID);
-
-    Addr baseAddr = responseIDAddrMap_.find(responseID)->second;
-    responseIDAddrMap_.erase(responseID);
+    ForwardedRequest * fwd = forwarded_.find(responseID);
+    SST::Event::id_type requestID = fwd->requestID;
+    Addr baseAddr = fwd->baseAddr;
+    forwarded_.erase(responseID);
 
     if (is_debug_addr(baseAddr))
         dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Recv  0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, responseID.first, responseID.second);
 
-    if (outstandingEventList_.find(requestID)->second.request->getCmd() == Command::Put) {
+    if (outstanding_.find(requestID)->request->getCmd() == Command::Put) {
         updatePut(requestID);
     } else { // Anything else - GetS, GetX, etc.
         finishRequest(requestID);
@@ -834,9 +832,9 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
     Addr baseAddr = response->getBaseAddr();
 
     /* Look up request in mshr */
-    MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    MSHREntry * entry = &(mshr_.find(baseAddr)->front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(outstanding_.find(requestID)->request);
 
     /* Update cache status */
     if (is_debug_addr(baseAddr))
@@ -873,20 +871,15 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
 
         uint32_t size = deriveSize(addr, baseAddr, request->getSrcAddr(), request->getSize());
 
-        MemEvent * read = new MemEvent(getName(), addr, baseAddr, Command::GetS, size);
+        MemEvent * read = new MemEvent(nameID_, addr, baseAddr, Command::GetS, size);
         read->MemEventBase::copyMetadata(request);
         read->setVirtualAddress(request->getSrcVirtualAddress());
         read->setInstructionPointer(request->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(),requestID));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
+        forwarded_.insert(read->getID(), ForwardedRequest(requestID, baseAddr));
 
-        std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+        // Read straight into the remote write's payload
         uint32_t offset = addr - request->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        doScratchRead(read, outstanding_.find(requestID)->remoteWrite->getPayload().data() + offset);
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString(dlevel).c_str());
@@ -909,16 +902,16 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     Addr baseAddr = response->getBaseAddr();
 
     /* Look up request in mshr */
-    MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    MSHREntry * entry = &(mshr_.find(baseAddr)->front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * put = static_cast<MoveEvent*>(outstanding_.find(requestID)->request);
 
     /* Update cache status */
     cacheStatus_.at(baseAddr/scratchLineSize_) = false;
 
     // Send a write to scratch if the line was dirty since we forcefully invalidated
     if (response->getDirty()) {
-        MemEvent * write = new MemEvent(getName(), response->getAddr(), baseAddr, Command::PutM, response->getPayload());
+        MemEvent * write = new MemEvent(nameID_, response->getAddr(), baseAddr, Command::PutM, response->getPayload());
         write->MemEventBase::copyMetadata(put);
         write->setVirtualAddress(put->getSrcVirtualAddress());
         write->setInstructionPointer(put->getInstructionPointer());
@@ -933,12 +926,8 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
     uint32_t offset = addr - put->getSrcAddr();
-    for (uint32_t i = 0; i < size; i++) {
-        payload[i+offset] = response->getPayload()[i];
-    }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    memcpy(outstanding_.find(requestID)->remoteWrite->getPayload().data() + offset, response->getPayload().data(), size);
 
     // Clear this mshr entry
     updatePut(requestID);
@@ -961,13 +950,13 @@ void Scratchpad::handleNack(MemEventBase * event) {
      * been resolved.
      */
     MemEvent * nackedEvent = nack->getNACKedEvent();
-    if (mshr_.find(nackedEvent->getBaseAddr()) == mshr_.end()) {
+    if (mshr_.find(nackedEvent->getBaseAddr()) == nullptr) {
         delete nackedEvent;
         delete nack;
         return;
     }
 
-    MSHREntry * entry = &(mshr_.find(nackedEvent->getBaseAddr())->second.front());
+    MSHREntry * entry = &(mshr_.find(nackedEvent->getBaseAddr())->front());
     if (entry->needAck) {
         // Determine whether nackedEvent actually matches request -> if not, don't resend
         // resend inv
@@ -978,7 +967,7 @@ void Scratchpad::handleNack(MemEventBase * event) {
         uint64_t backoff = (0x1 << retries);
         nackedEvent->incrementRetries();
 
-        procMsgQueue_.insert(std::make_pair(timestamp_ + backoff, nackedEvent));
+        procMsgQueue_.insert(timestamp_ + backoff, nackedEvent);
 
     } else {
         delete nackedEvent;
@@ -996,15 +985,15 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     stat_RemoteReadReceived->addData(1);
 
     event->setBaseAddr((event->getAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
-    MemEvent * request = new MemEvent(getName(), event->getAddr() - remoteAddrOffset_, event->getBaseAddr(), Command::GetS, event->getSize());
+    MemEvent * request = new MemEvent(nameID_, event->getAddr() - remoteAddrOffset_, event->getBaseAddr(), Command::GetS, event->getSize());
     request->copyMetadata(event);
     request->setFlag(MemEvent::F_NONCACHEABLE); // Use byte not line address
 
     MemEvent * response = event->makeResponse();
-    outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
-    responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
+    outstanding_.insert(event->getID(), OutstandingEvent(event, response));
+    forwarded_.insert(request->getID(), ForwardedRequest(event->getID(), 0));
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.insert(timestamp_, request);
 }
 
 
@@ -1018,16 +1007,16 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
     stat_RemoteWriteReceived->addData(1);
 
     event->setBaseAddr((event->getAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
-    MemEvent * request = new MemEvent(getName(), event->getAddr() - remoteAddrOffset_, event->getBaseAddr(), Command::Write, event->getPayload());
+    MemEvent * request = new MemEvent(nameID_, event->getAddr() - remoteAddrOffset_, event->getBaseAddr(), Command::Write, event->getPayload());
     request->copyMetadata(event);
     request->setFlag(MemEvent::F_NORESPONSE);
     request->setFlag(MemEvent::F_NONCACHEABLE);
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.insert(timestamp_, request);
 
     MemEvent * response = event->makeResponse();
 
-    procMsgQueue_.insert(std::make_pair(timestamp_, response));
+    procMsgQueue_.insert(timestamp_, response);
 
     delete event;
 }
@@ -1040,7 +1029,7 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
  */
 void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_type requestID) {
 
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(outstanding_.find(requestID)->request);
 
     uint32_t bytesLeft = request->getSize();
     Addr addr = request->getDstAddr();
@@ -1051,38 +1040,38 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
         // Create write
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
-        std::vector<uint8_t> data((response->getPayload()).begin() + payloadOffset, (response->getPayload()).begin() + payloadOffset + size);
-        MemEvent * write = new MemEvent(getName(), addr, baseAddr, Command::PutM, data);
+        MemEvent * write = new MemEvent(nameID_, addr, baseAddr, Command::PutM, size);
+        memcpy(write->allocatePayload(size), response->getPayload().data() + payloadOffset, size);
         write->MemEventBase::copyMetadata(request);
         write->setVirtualAddress(request->getDstVirtualAddress());
         write->setInstructionPointer(request->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
 
-        if (mshr_.find(baseAddr)->second.front().id == requestID) {
+        if (mshr_.find(baseAddr)->front().id == requestID) {
             doScratchWrite(write);
-            mshr_.find(baseAddr)->second.front().needData = false;
+            mshr_.find(baseAddr)->front().needData = false;
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->front().getString().c_str());
 
-            if (!mshr_.find(baseAddr)->second.front().needAck) {
+            if (!mshr_.find(baseAddr)->front().needAck) {
                 updateGet(requestID);
                 updateMSHR(baseAddr);
             }
         } else {
             // Find it
-            if (mshr_.find(baseAddr) == mshr_.end()) {
+            if (mshr_.find(baseAddr) == nullptr) {
                 dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
             }
-            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->second.begin(); it != mshr_.find(baseAddr)->second.end(); it++) {
+            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->begin(); it != mshr_.find(baseAddr)->end(); it++) {
                 if (it->id == requestID) {
                     it->scratch = write;
                     it->needData = false;
 
                     if (is_debug_addr(baseAddr))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->front().getString().c_str());
                 }
             }
         }
@@ -1096,7 +1085,7 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
 
 void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_type requestID) {
     // Update response with payload and finish request
-    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->second.response);
+    MemEvent * fwdResponse = static_cast<MemEvent*>(outstanding_.find(requestID)->response);
     fwdResponse->setPayload(response->getPayload());
 
     finishRequest(requestID);
@@ -1107,42 +1096,42 @@ void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_ty
 // Update MSHR
 void Scratchpad::updateMSHR(Addr baseAddr) {
     // Remove top event
-    mshr_.find(baseAddr)->second.pop_front();
+    mshr_.find(baseAddr)->pop_front();
 
     // Start next event
-    while (!mshr_.find(baseAddr)->second.empty()) {
-        MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    while (!mshr_.find(baseAddr)->empty()) {
+        MSHREntry * entry = &(mshr_.find(baseAddr)->front());
 
         if (entry->cmd == Command::GetS) {
-            std::vector<uint8_t> readData = doScratchRead(entry->scratch);
-            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->second.response)->setPayload(readData);
+            MemEvent * response = static_cast<MemEvent*>(outstanding_.find(entry->id)->response);
+            doScratchRead(entry->scratch, response->allocatePayload(entry->scratch->getSize()));
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
 
-            if (caching_ && (outstandingEventList_.find(entry->id)->second.request->queryFlag(MemEvent::F_NONCACHEABLE))) {
+            if (caching_ && (outstanding_.find(entry->id)->request->queryFlag(MemEvent::F_NONCACHEABLE))) {
                 cacheStatus_.at(baseAddr/scratchLineSize_) = true;
             }
             break;
         } else if (entry->cmd == Command::GetX || entry->cmd == Command::Write) {
             doScratchWrite(entry->scratch);
             finishRequest(entry->id);
-            mshr_.find(baseAddr)->second.pop_front();
+            mshr_.find(baseAddr)->pop_front();
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
 
         } else if (entry->cmd == Command::Get) {
-            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstanding_.find(entry->id)->request));
             if (!entry->needData) {
                 doScratchWrite(entry->scratch);
                 entry->scratch = nullptr;
             }
             if (!entry->needAck && !entry->needData) {
                 updateGet(entry->id);
-                mshr_.find(baseAddr)->second.pop_front();
+                mshr_.find(baseAddr)->pop_front();
 
                 if (is_debug_addr(baseAddr))
                     dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1155,7 +1144,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstanding_.find(entry->id)->request));
             entry->needData = !entry->needAck;
 
             if (is_debug_addr(baseAddr))
@@ -1169,7 +1158,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
     }
 
     // Clear mshr entry if list is empty
-    if (mshr_.find(baseAddr)->second.empty()) {
+    if (mshr_.find(baseAddr)->empty()) {
         mshr_.erase(baseAddr);
 
         if (is_debug_addr(baseAddr))
@@ -1178,18 +1167,17 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
 }
 
 // Helper methods
-std::vector<uint8_t> Scratchpad::doScratchRead(MemEvent * event) {
+void Scratchpad::doScratchRead(MemEvent * event, uint8_t * data) {
     stat_ScratchReadIssued->addData(1);
 
-    std::vector<uint8_t> data;
-    data.resize(event->getSize(), 0);
     if (backing_) {
         backing_->get(event->getAddr(), event->getSize(), data);
+    } else {
+        memset(data, 0, event->getSize());
     }
     dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Send  0x%-16" PRIx64 " (%s)\n",
             getCurrentSimCycle(), timestamp_, getName().c_str(), event->getAddr(), event->getBriefString().c_str());
     scratch_->handleMemEvent(event);
-    return data;
 }
 
 void Scratchpad::doScratchWrite(MemEvent * event) {
@@ -1205,7 +1193,7 @@ void Scratchpad::doScratchWrite(MemEvent * event) {
 }
 
 void Scratchpad::sendResponse(MemEventBase * event) {
-    procMsgQueue_.insert(std::make_pair(timestamp_, event));
+    procMsgQueue_.insert(timestamp_, event);
 }
 
 
@@ -1215,14 +1203,14 @@ void Scratchpad::sendResponse(MemEventBase * event) {
  */
 bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
     if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
-        MemEvent * inv = new MemEvent(getName(), baseAddr, baseAddr, Command::ForceInv, scratchLineSize_);
+        MemEvent * inv = new MemEvent(nameID_, baseAddr, baseAddr, Command::ForceInv, scratchLineSize_);
         inv->MemEventBase::copyMetadata(get);
         inv->setDst(linkUp_->getSources()->begin()->name);
         inv->setVirtualAddress(get->getDstVirtualAddress());
         inv->setInstructionPointer(get->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), get->getSrcBaseAddr(), get->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.insert(timestamp_, inv);
         return true;
     }
     return false;
@@ -1235,14 +1223,14 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
  */
 bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
     if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
-        MemEvent * inv = new MemEvent(getName(), baseAddr, baseAddr, Command::FetchInv, scratchLineSize_);
+        MemEvent * inv = new MemEvent(nameID_, baseAddr, baseAddr, Command::FetchInv, scratchLineSize_);
         inv->MemEventBase::copyMetadata(put);
         inv->setDst(put->getSrc());
         inv->setVirtualAddress(put->getSrcVirtualAddress());
         inv->setInstructionPointer(put->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), put->getSrcBaseAddr(), put->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.insert(timestamp_, inv);
         return true;
     } else {
         // Derive addr and size from baseAddr and the put request
@@ -1251,60 +1239,54 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
             addr = put->getSrcAddr();
         uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
-        MemEvent * read = new MemEvent(getName(), addr, baseAddr, Command::GetS, size);
+        MemEvent * read = new MemEvent(nameID_, addr, baseAddr, Command::GetS, size);
         read->MemEventBase::copyMetadata(put);
         read->setVirtualAddress(put->getSrcVirtualAddress());
         read->setInstructionPointer(put->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
-
-        std::vector<uint8_t> data = doScratchRead(read);
+        forwarded_.insert(read->getID(), ForwardedRequest(put->getID(), baseAddr));
 
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
+        // Read straight into the remote write's payload
         uint32_t offset = addr - put->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        doScratchRead(read, outstanding_.find(put->getID())->remoteWrite->getPayload().data() + offset);
         return false;
     }
 }
 
 void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
+    uint32_t count = outstanding_.find(putID)->decrementCount();
     if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
+        MoveEvent * put = static_cast<MoveEvent*>(outstanding_.find(putID)->request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(),
                 put->getSrcBaseAddr(),
                 put->getDstBaseAddr(),
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
+                outstanding_.find(putID)->remoteWrite->getID().first,
+                outstanding_.find(putID)->remoteWrite->getID().second,
+                outstanding_.find(putID)->remoteWrite->getBaseAddr());
 //        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
-//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
-        outstandingEventList_.erase(putID);
+//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstanding_.find(putID)->remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
+        memMsgQueue_.insert(timestamp_, outstanding_.find(putID)->remoteWrite);
+        sendResponse(outstanding_.find(putID)->response);
+        delete outstanding_.find(putID)->request;
+        outstanding_.erase(putID);
     }
 
 }
 
 void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
+    uint32_t count = outstanding_.find(getID)->decrementCount();
     if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
-        outstandingEventList_.erase(getID);
+        sendResponse(outstanding_.find(getID)->response);
+        delete outstanding_.find(getID)->request;
+        outstanding_.erase(getID);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
-    outstandingEventList_.erase(requestID);
+    if (outstanding_.find(requestID)->response != nullptr)
+        sendResponse(outstanding_.find(requestID)->response);
+    delete outstanding_.find(requestID)->request;
+    outstanding_.erase(requestID);
 }
 
 uint32_t Scratchpad::deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize) {
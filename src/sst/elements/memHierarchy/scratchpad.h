@@ -29,6 +29,8 @@
 #include "sst/elements/memHierarchy/moveEvent.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/slotTable.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -100,6 +102,7 @@ private:
     // Parameters - scratchpad
     uint64_t scratchSize_;      // Size of the total scratchpad in bytes - any address above this is assumed to address remote memory
     uint64_t scratchLineSize_;  // Size of each line in the scratchpad in bytes
+    EndpointID nameID_;         // Interned getName()
 
     // Parameters - memory
     uint64_t remoteAddrOffset_;   // Offset for remote addresses, defaults to scratchSize (i.e., CPU addr scratchSize = mem addr 0)
@@ -140,7 +143,7 @@ private:
     // Helper methods
     void updateMSHR(Addr baseAddr);
 
-    std::vector<uint8_t> doScratchRead(MemEvent * read);
+    void doScratchRead(MemEvent * read, uint8_t * data); // Fills getSize() bytes of data from the backing store
     void doScratchWrite(MemEvent * write);
     void sendResponse(MemEventBase * event);
 
@@ -165,6 +168,7 @@ private:
             uint32_t count;             // Number of lines we are waiting on - when 0, the request is complete
                                         // i.e., for a read or write, just 1, for a get or put, the size/lineSize
 
+            OutstandingEvent() : request(nullptr), response(nullptr), remoteWrite(nullptr), count(0) { }
             OutstandingEvent(MemEventBase * request, MemEventBase * response) : request(request), response(response), remoteWrite(nullptr), count(0) { }
             OutstandingEvent(MemEventBase * request, MemEventBase * response, MemEvent * write) : request(request), response(response), remoteWrite(write), count(0) { }
 
@@ -226,15 +230,22 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    // A request we forwarded to scratch or remote memory
+    struct ForwardedRequest {
+        SST::Event::id_type requestID;  // Original request ID
+        Addr baseAddr;                  // For scratch requests, the line being accessed
+        ForwardedRequest() : baseAddr(0) { }
+        ForwardedRequest(SST::Event::id_type id, Addr addr) : requestID(id), baseAddr(addr) { }
+    };
+
+    SlotTable<SST::Event::id_type,ForwardedRequest> forwarded_;     // Map a forwarded request ID to the original request
+    SlotTable<SST::Event::id_type,OutstandingEvent> outstanding_;   // All outstanding events
+    SlotTable<Addr,std::list<MSHREntry> > mshr_;                    // MSHR for scratch accesses
 
 
-    // Outgoing message queues - map send timestamp to event
-    std::multimap<uint64_t, MemEventBase*> procMsgQueue_;
-    std::multimap<uint64_t, MemEvent*> memMsgQueue_;
+    // Outgoing message queues - events wait here until their send timestamp
+    TimingWheel<MemEventBase*> procMsgQueue_;
+    TimingWheel<MemEvent*> memMsgQueue_;
 
     // Throughput limits
     uint32_t responsesPerCycle_;
@@ -243,7 +254,6 @@ private:
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
     std::vector<bool> cacheStatus_; // One entry per scratchpad line, whether line may be cached
-    std::map<SST::Event::id_type, uint64_t> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
 
     // Statistics
     Statistic<uint64_t>* stat_ScratchReadReceived;
@@ -0,0 +1,151 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SLOTTABLE_H
+#define MEMHIERARCHY_SLOTTABLE_H
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <sst/core/event.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/* Key hashes for SlotTable. The table mixes the result, so these only need to be unique-ish. */
+struct SlotKeyHash {
+    uint64_t operator()(uint64_t key) const { return key; }
+    uint64_t operator()(const SST::Event::id_type& id) const { return id.first ^ ((uint64_t)(uint32_t)id.second << 40); }
+};
+
+/*
+ * Key -> value map for short-lived entries, e.g., tracking an event from arrival to response
+ *
+ * Values live in a pool of slots (stable addresses) that are recycled through a free list,
+ * so a steady stream of insert/erase does not allocate. The index is open addressing with
+ * linear probing and backward-shift deletion, as in MSHRBlock.
+ */
+template<class K, class V, class Hash = SlotKeyHash>
+class SlotTable {
+public:
+    SlotTable(size_t expected = 16) : count_(0) {
+        size_t capacity = 16;
+        while (capacity < expected * 2)
+            capacity <<= 1;
+        resize(capacity);
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /* Value for key or nullptr if not present */
+    V* find(const K& key) {
+        for (size_t i = index(key); ; i = (i + 1) & (table_.size() - 1)) {
+            if (table_[i].slot == EMPTY)
+                return nullptr;
+            if (table_[i].key == key)
+                return &pool_[table_[i].slot];
+        }
+    }
+
+    /* Insert key with value, or overwrite the value if key is already present */
+    V* insert(const K& key, const V& value) {
+        if ((count_ + 1) * 2 > table_.size())
+            resize(table_.size() * 2);
+        size_t i = index(key);
+        for (; table_[i].slot != EMPTY; i = (i + 1) & (table_.size() - 1)) {
+            if (table_[i].key == key) {
+                pool_[table_[i].slot] = value;
+                return &pool_[table_[i].slot];
+            }
+        }
+        uint32_t slot;
+        if (free_.empty()) {
+            slot = pool_.size();
+            pool_.push_back(value);
+        } else {
+            slot = free_.back();
+            free_.pop_back();
+            pool_[slot] = value;
+        }
+        table_[i].key = key;
+        table_[i].slot = slot;
+        count_++;
+        return &pool_[slot];
+    }
+
+    /* Remove key. The slot keeps its value's storage (e.g., a container's capacity) for reuse. */
+    void erase(const K& key) {
+        size_t mask = table_.size() - 1;
+        size_t i = index(key);
+        for (; table_[i].slot != EMPTY; i = (i + 1) & mask) {
+            if (table_[i].key == key)
+                break;
+        }
+        if (table_[i].slot == EMPTY)
+            return;
+
+        free_.push_back(table_[i].slot);
+        count_--;
+
+        // Shift later members of the probe run back so lookups never stop early
+        size_t hole = i;
+        for (size_t j = (i + 1) & mask; table_[j].slot != EMPTY; j = (j + 1) & mask) {
+            size_t home = index(table_[j].key);
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                table_[hole] = table_[j];
+                hole = j;
+            }
+        }
+        table_[hole].slot = EMPTY;
+    }
+
+private:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    struct Entry {
+        Entry() : key(), slot(EMPTY) { }
+        K key;
+        uint32_t slot;
+    };
+
+    size_t index(const K& key) const { return (Hash()(key) * 0x9E3779B97F4A7C15ULL) >> shift_; }
+
+    void resize(size_t capacity) {
+        std::vector<Entry> old;
+        old.swap(table_);
+        table_.resize(capacity);
+        shift_ = 64 - __builtin_ctzll(capacity);
+        for (Entry& entry : old) {
+            if (entry.slot == EMPTY)
+                continue;
+            size_t i = index(entry.key);
+            while (table_[i].slot != EMPTY)
+                i = (i + 1) & (capacity - 1);
+            table_[i] = entry;
+        }
+    }
+
+    std::vector<Entry> table_;
+    std::deque<V> pool_;
+    std::vector<uint32_t> free_;
+    size_t count_;
+    uint32_t shift_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_SLOTTABLE_H */
@@ -42,7 +42,9 @@ StandardInterface::StandardInterface(SST::ComponentId_t id, Params &params, Time
     debug.init("", dlevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
 
     rqstr_ = "";
+    nameID_ = EndpointRegistry::intern(getName());
     initDone_ = false;
+    nextSeq_ = 1;
 
     converter_ = new StandardInterface::MemEventConverter(this);
     converter_->output = debug;
@@ -85,6 +87,19 @@ StandardInterface::StandardInterface(SST::ComponentId_t id, Params &params, Time
         reg.end = noncache[i+1];
         noncacheableRegions.insert(std::make_pair(reg.start, reg));
     }
+
+    std::string traceFile = params.find<std::string>("latency_trace", "");
+    if (!traceFile.empty()) {
+#ifdef MEMH_LATENCY_TRACE
+        uint64_t tracePeriod = params.find<uint64_t>("latency_trace_period", 100);
+        if (tracePeriod == 0)
+            output.fatal(CALL_INFO, -1, "%s, Invalid param: latency_trace_period - must be at least 1.\n", getName().c_str());
+        if (!traceWriter_.open(traceFile, tracePeriod, getCoreTimeBase().getDoubleValue() * 1e12))
+            output.fatal(CALL_INFO, -1, "%s, Error: unable to open latency trace '%s' for writing.\n", getName().c_str(), traceFile.c_str());
+#else
+        output.verbose(CALL_INFO, 1, 0, "Warning (%s): 'latency_trace' is ignored since memHierarchy was built without MEMH_LATENCY_TRACE.\n", getName().c_str());
+#endif
+    }
 }
 
 void StandardInterface::setMemoryMappedAddressRegion(Addr start, Addr size) {
@@ -196,21 +211,42 @@ StandardMem::Request* StandardInterface::recvUntimedData() {
 
 /* This could be a request or a response. */
 void StandardInterface::send(StandardMem::Request* req) {
+    link_->send(convertRequest(req));
+}
+
+void StandardInterface::send(const std::vector<StandardMem::Request*>& reqs) {
+    batch_.clear();
+    for (StandardMem::Request* req : reqs)
+        batch_.push_back(convertRequest(req));
+    link_->send(batch_);
+}
+
+inline MemEventBase* StandardInterface::convertRequest(StandardMem::Request* req) {
     MemEventBase *me = static_cast<MemEventBase*>(req->convert(converter_));
 #ifdef __SST_DEBUG_OUTPUT__
       debug.debug(_L5_, "E: %-40" PRIu64 "  %-20s Req:Convert   EventID: <%" PRIu64", %" PRIu32 "> (%s)\n", getCurrentSimCycle(), getName().c_str(), me->getID().first, me->getID().second, req->getString().c_str());
     fflush(stdout);
 #endif
 
-    if (req->needsResponse())
-        requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
-    else
+#ifdef MEMH_LATENCY_TRACE
+    if (req->needsResponse() && traceWriter_.sample())
+        LatencyTraceTable::begin(me->getID(), getCurrentSimCycle());
+#endif
+
+    if (req->needsResponse()) {
+        /* Save this request so we can use it when a response is returned. Responses carry the sequence number back */
+        me->setRqstrSeq(nextSeq_);
+        requests_.insert(nextSeq_, OutstandingRequest(req, me->getCmd()));
+        if (++nextSeq_ == 0)
+            nextSeq_ = 1;
+    } else {
         delete req;
+    }
 #ifdef __SST_DEBUG_OUTPUT__
     debug.debug(_L4_, "E: %-40" PRIu64 "  %-20s Event:Send    (%s)\n", 
         getCurrentSimCycle(), getName().c_str(), me->getBriefString().c_str());
 #endif
-    link_->send(me);
+    return me;
 }
 
 StandardMem::Request* StandardInterface::poll() {
@@ -228,17 +264,24 @@ void StandardInterface::receive(SST::Event* ev) {
 #endif
     /* Handle responses to requests we sent */
     if (isResponse) {
-        MemEventBase::id_type origID = me->getResponseToID();
-        std::map<MemEventBase::id_type,std::pair<StandardMem::Request*,Command>>::iterator reqit = requests_.find(origID);
-        if (reqit == requests_.end()) {
+        uint32_t origSeq = me->getRqstrSeq();
+        OutstandingRequest* reqit = requests_.find(origSeq);
+        if (reqit == nullptr) {
             output.fatal(CALL_INFO, -1, "%s, Error: Received response but cannot locate matching request. Response: %s\n",
                 getName().c_str(), me->getVerboseString(dlevel).c_str());
         }
-        StandardMem::Request* origReq = reqit->second.first;
-        Command origCmd = reqit->second.second;
-        if (origCmd == Command::GetS || origCmd == Command::GetSX)
-            cmd = Command::GetSResp;
-        requests_.erase(reqit);
+        StandardMem::Request* origReq = reqit->req;
+        Command origCmd = reqit->cmd;
+        if (cmd != Command::NACK) { /* A NACKed request is resent with the same ID so keep tracking it */
+            if (origCmd == Command::GetS || origCmd == Command::GetSX)
+                cmd = Command::GetSResp;
+            requests_.erase(origSeq);
+#ifdef MEMH_LATENCY_TRACE
+            LatencyTrace trace;
+            if (LatencyTraceTable::end(me->getResponseToID(), trace))
+                traceWriter_.write(origCmd, trace, getCurrentSimCycle());
+#endif
+        }
         response = me;
         switch (cmd) {
             case Command::GetSResp:
@@ -308,7 +351,7 @@ void StandardInterface::receive(SST::Event* ev) {
                     getName().c_str(), CommandString[(int)cmd], me->getVerboseString(dlevel).c_str());
         };
         if (deliverReq->needsResponse()) /* Endpoint will need to send a response to this */
-            responses_[deliverReq->getID()] = me;
+            responses_.insert(deliverReq->getID(), me);
         else 
             delete me;
     }
@@ -343,10 +386,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::Read* req
     }
 
     Addr bAddr = (iface->lineSize_ == 0 || noncacheable) ? req->pAddr : req->pAddr & iface->baseAddrMask_; // Line address
-    MemEvent* read = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::GetS, req->size);
-    read->setRqstr(iface->getName());
+    MemEvent* read = new MemEvent(iface->nameID_, req->pAddr, bAddr, Command::GetS, req->size);
+    read->setRqstrID(iface->nameID_);
     read->setThreadID(req->tid);
-    read->setDst(iface->link_->getTargetDestination(bAddr));
+    read->setDstID(iface->link_->getTargetDestinationID(bAddr));
     read->setVirtualAddress(req->vAddr);
     read->setInstructionPointer(req->iPtr);
     if (noncacheable)
@@ -377,11 +420,11 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::Write* re
     }
     
     Addr bAddr = (iface->lineSize_ == 0 || noncacheable) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
-    MemEvent* write = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::Write, req->data);
+    MemEvent* write = new MemEvent(iface->nameID_, req->pAddr, bAddr, Command::Write, req->data);
     
-    write->setRqstr(iface->getName());
+    write->setRqstrID(iface->nameID_);
     write->setThreadID(req->tid);
-    write->setDst(iface->link_->getTargetDestination(bAddr));
+    write->setDstID(iface->link_->getTargetDestinationID(bAddr));
     write->setVirtualAddress(req->vAddr);
     write->setInstructionPointer(req->iPtr);
     
@@ -409,10 +452,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::FlushAddr
     Addr bAddr = (iface->lineSize_ == 0 || req->getNoncacheable()) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
     Command cmd = req->inv ? Command::FlushLineInv : Command::FlushLine;
 
-    MemEvent* flush = new MemEvent(iface->getName(), req->pAddr, bAddr, cmd, req->size);
-    flush->setRqstr(iface->getName());
+    MemEvent* flush = new MemEvent(iface->nameID_, req->pAddr, bAddr, cmd, req->size);
+    flush->setRqstrID(iface->nameID_);
     flush->setThreadID(req->tid);
-    flush->setDst(iface->link_->getTargetDestination(bAddr));
+    flush->setDstID(iface->link_->getTargetDestinationID(bAddr));
     flush->setVirtualAddress(req->vAddr);
     flush->setInstructionPointer(req->iPtr);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -426,10 +469,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::FlushAddr
 
 Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadLock* req) {
     Addr bAddr = (iface->lineSize_ == 0 || req->getNoncacheable()) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
-    MemEvent* read = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::GetSX, req->size);
-    read->setRqstr(iface->getName());
+    MemEvent* read = new MemEvent(iface->nameID_, req->pAddr, bAddr, Command::GetSX, req->size);
+    read->setRqstrID(iface->nameID_);
     read->setThreadID(req->tid);
-    read->setDst(iface->link_->getTargetDestination(bAddr));
+    read->setDstID(iface->link_->getTargetDestinationID(bAddr));
     read->setVirtualAddress(req->vAddr);
     read->setInstructionPointer(req->iPtr);
     read->setFlag(MemEvent::F_LOCKED);
@@ -443,10 +486,10 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadLock* req)
 }
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteUnlock* req) {
     Addr bAddr = (iface->lineSize_ == 0 || req->getNoncacheable()) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
-    MemEvent* write = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::Write, req->data);
-    write->setRqstr(iface->getName());
+    MemEvent* write = new MemEvent(iface->nameID_, req->pAddr, bAddr, Command::Write, req->data);
+    write->setRqstrID(iface->nameID_);
     write->setThreadID(req->tid);
-    write->setDst(iface->link_->getTargetDestination(bAddr));
+    write->setDstID(iface->link_->getTargetDestinationID(bAddr));
     write->setVirtualAddress(req->vAddr);
     write->setInstructionPointer(req->iPtr);
     write->setFlag(MemEvent::F_LOCKED);
@@ -464,11 +507,11 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteUnlo
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::LoadLink* req) {
     Addr bAddr = (iface->lineSize_ == 0 || req->getNoncacheable()) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
-    MemEvent* load = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::GetSX, req->size);
+    MemEvent* load = new MemEvent(iface->nameID_, req->pAddr, bAddr, Command::GetSX, req->size);
     load->setFlag(MemEvent::F_LLSC);
-    load->setRqstr(iface->getName());
+    load->setRqstrID(iface->nameID_);
     load->setThreadID(req->tid);
-    load->setDst(iface->link_->getTargetDestination(bAddr));
+    load->setDstID(iface->link_->getTargetDestinationID(bAddr));
     load->setVirtualAddress(req->vAddr);
     load->setInstructionPointer(req->iPtr);
     if (req->getNoncacheable())
@@ -482,11 +525,11 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::LoadLink*
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::StoreConditional* req) {
     Addr bAddr = (iface->lineSize_ == 0 || req->getNoncacheable()) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
-    MemEvent* store = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::Write, req->data);
+    MemEvent* store = new MemEvent(iface->nameID_, req->pAddr, bAddr, Command::Write, req->data);
     store->setFlag(MemEvent::F_LLSC);
-    store->setRqstr(iface->getName());
+    store->setRqstrID(iface->nameID_);
     store->setThreadID(req->tid);
-    store->setDst(iface->link_->getTargetDestination(bAddr));
+    store->setDstID(iface->link_->getTargetDestinationID(bAddr));
     store->setVirtualAddress(req->vAddr);
     store->setInstructionPointer(req->iPtr);
     
@@ -511,7 +554,7 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::MoveData* req)
     // TODO May work to replace both Get/Put with generic Move and let scratchpad/other component decide
     // how to treat it based on the addresses
     Command cmd = (req->pDst > req->pSrc) ? Command::Put : Command::Get;
-    MoveEvent* move = new MoveEvent(iface->getName(), req->pSrc, bAddrSrc, req->pDst, bAddrDst, cmd);
+    MoveEvent* move = new MoveEvent(iface->nameID_, req->pSrc, bAddrSrc, req->pDst, bAddrDst, cmd);
         
     if (req->posted) {
         move->setFlag(MemEventBase::F_NORESPONSE);
@@ -525,7 +568,7 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::MoveData* req)
     return move;
 }
 Event* StandardInterface::MemEventConverter::convert(StandardMem::CustomReq* req) {
-    CustomMemEvent* creq = new CustomMemEvent(iface->getName(), Command::CustomReq, req->data);
+    CustomMemEvent* creq = new CustomMemEvent(iface->nameID_, Command::CustomReq, req->data);
     if (!req->needsResponse())
         creq->setFlag(MemEventBase::F_NORESPONSE);
 
@@ -533,11 +576,11 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::CustomReq* req
 }
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp* resp) { 
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase** it = iface->responses_.find(resp->getID());
+    if (it == nullptr)
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a ReadResp but no matching Read found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(*it); // Matching memEvent req
+    iface->responses_.erase(resp->getID());
     MemEvent* meresp = mereq->makeResponse();
     meresp->setPayload(resp->data);
     if (!resp->getSuccess()) {
@@ -546,11 +589,11 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp*
     return meresp;
 }
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase** it = iface->responses_.find(resp->getID());
+    if (it == nullptr)
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a WriteResp but no matching Write found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(*it); // Matching memEvent req
+    iface->responses_.erase(resp->getID());
     MemEvent* meresp = mereq->makeResponse();
     if (!resp->getSuccess()) {
         meresp->setFail();
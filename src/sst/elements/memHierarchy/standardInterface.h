@@ -29,6 +29,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/slotTable.h"
 
 namespace SST {
 
@@ -79,7 +80,9 @@ public:
         {"debug",       "(uint) Where to send debug output. Options: 0[none], 1[stdout], 2[stderr], 3[file]", "0"},
         {"debug_level", "(uint) Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
         {"port",        "(string) port name to use for interfacing to the memory system. This must be provided if this subcomponent is being loaded anonymously. Otherwise this should not be specified and either the 'port' port should be connected or the 'memlink' subcomponent slot should be filled"},
-        {"noncacheable_regions", "(string) vector of (start, end) address pairs for noncacheable address ranges. Vector format should be [start0, end0, start1, end1, ...].", "[]"}
+        {"noncacheable_regions", "(string) vector of (start, end) address pairs for noncacheable address ranges. Vector format should be [start0, end0, start1, end1, ...].", "[]"},
+        {"latency_trace", "(string) File to write per-request latency breakdowns to. Requires memHierarchy to be built with MEMH_LATENCY_TRACE defined.", ""},
+        {"latency_trace_period", "(uint) Trace one request in every latency_trace_period", "100"}
     )
 
     SST_ELI_DOCUMENT_PORTS( {"port", "Port to memory hierarchy (caches/memory/etc.). Required if subcomponent slot not filled or if 'port' parameter not provided.", {}} )
@@ -103,6 +106,14 @@ public:
     virtual void send(Request* req) override;
     virtual Request* poll() override;
 
+    /*
+     * Send a group of requests, e.g., everything a core issues in one cycle, in order.
+     * The converted events go to the link together, which a MemLink sends as one link event.
+     * This is a StandardInterface extension: StandardMem is defined in SST core and has
+     * no batched send, so endpoints must hold a StandardInterface to use it.
+     */
+    void send(const std::vector<Request*>& reqs);
+
     // SST simulation life cycle hooks - parent must call these
     void init(unsigned int phase) override;
     void setup() override;
@@ -119,12 +130,23 @@ protected:
     Addr        baseAddrMask_;
     Addr        lineSize_;
     std::string rqstr_;
-    std::map<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;   /* Map requests sent by the endpoint */
-    std::map<StandardMem::Request::id_t, MemEventBase*> responses_;     /* Map requests received by the endpoint */
+    EndpointID  nameID_;    // Interned getName()
+    struct OutstandingRequest {
+        OutstandingRequest() : req(nullptr), cmd(Command::NULLCMD) { }
+        OutstandingRequest(StandardMem::Request* req, Command cmd) : req(req), cmd(cmd) { }
+        StandardMem::Request* req;
+        Command cmd;
+    };
+    SlotTable<uint32_t, OutstandingRequest> requests_;      /* Map requests sent by the endpoint, by local sequence number */
+    uint32_t nextSeq_;                                      /* Sequence number for the next request. 0 is not used */
+    std::vector<MemEventBase*> batch_;                      /* Events for send(const std::vector<Request*>&) */
+    SlotTable<uint64_t, MemEventBase*> responses_;                      /* Map requests received by the endpoint, by StandardMem::Request::id_t */
     SST::MemHierarchy::MemLinkBase*  link_;
     bool cacheDst_; // Whether we've got a cache below us to handle certain conversions or we need to 
 
     bool initDone_;
+
+    LatencyTraceWriter traceWriter_;   // Only opened when built with MEMH_LATENCY_TRACE
     std::queue<MemEventInit*> initSendQueue_;
 
     MemRegion region;   // For MMIO
@@ -157,6 +179,9 @@ protected:
 
 private:
 
+    /** Convert a request to an event and track it if it needs a response */
+    inline MemEventBase* convertRequest(StandardMem::Request* req);
+
     /** Callback handler for our link
      * Parses event and calls the parent's handler */
     void receive(SST::Event *ev);
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Compares the analyticalMem backend against timingDRAM. For each
+# testBackendTimingDRAM-<n>.py, testBackendAnalytical.py is run with the
+# same DRAM configuration and the mean memory controller latency per
+# command, the simulated time, and the wall-clock time are compared.
+#
+# Usage: compareAnalyticalMem.py [--sst sst] [config ...]
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+CONFIGS = ["1", "2", "3", "4"]
+COMMANDS = ["GetS", "GetX", "PutM"]
+
+LATENCY_RE = re.compile(r"^ memory\.latency_(\w+) : Accumulator : Sum\.u64 = (\d+); SumSQ\.u64 = \d+; Count\.u64 = (\d+);")
+SIMTIME_RE = re.compile(r"simulated time: ([0-9.]+) (\w+)")
+UNITS = {"ps": 1e-3, "ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def run(sst, sdl, options):
+    """Returns ({command: mean latency in memory cycles}, simulated ns, wall-clock seconds)"""
+    testdir = os.path.dirname(os.path.abspath(__file__))
+    cmd = [sst]
+    if options:
+        cmd.append("--model-options=" + options)
+    cmd.append(sdl)
+    start = time.time()
+    result = subprocess.run(cmd, cwd=testdir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    wall = time.time() - start
+    if result.returncode != 0:
+        sys.exit("%s %s failed:\n%s" % (sdl, options, result.stdout))
+
+    latency = {}
+    simtime = 0.0
+    for line in result.stdout.splitlines():
+        m = LATENCY_RE.match(line)
+        if m:
+            count = int(m.group(3))
+            if count:
+                latency[m.group(1)] = int(m.group(2)) / float(count)
+            continue
+        m = SIMTIME_RE.search(line)
+        if m:
+            simtime = float(m.group(1)) * UNITS.get(m.group(2), 1.0)
+    return latency, simtime, wall
+
+
+def percent(reference, value):
+    return (value - reference) / reference * 100.0 if reference else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Accuracy and speed of analyticalMem against timingDRAM")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("configs", nargs="*", default=CONFIGS, help="testBackendTimingDRAM configurations to compare (default: %s)" % " ".join(CONFIGS))
+    args = parser.parse_args()
+
+    print("%-7s %s %10s %9s" % ("config", " ".join("%16s" % ("lat " + c + " err") for c in COMMANDS), "simtime", "speedup"))
+    for config in args.configs:
+        t_lat, t_simtime, t_wall = run(args.sst, "testBackendTimingDRAM-%s.py" % config, "")
+        a_lat, a_simtime, a_wall = run(args.sst, "testBackendAnalytical.py", "--config=" + config)
+        errors = []
+        for c in COMMANDS:
+            if c in t_lat and c in a_lat:
+                errors.append("%+15.2f%%" % percent(t_lat[c], a_lat[c]))
+            else:
+                errors.append("%16s" % "-")
+        print("%-7s %s %+9.2f%% %8.2fx" % (config, " ".join(errors), percent(t_simtime, a_simtime), t_wall / a_wall if a_wall else 0.0))
+
+
+if __name__ == "__main__":
+    main()
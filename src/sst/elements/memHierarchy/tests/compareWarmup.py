@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Measures functional warm-up with perfWarmup.py. The same request stream is
+# run three ways:
+#   detailed   - no warm-up, detailed timing throughout
+#   functional - warm-up covers the whole run
+#   switched   - warm-up for --warmup, detailed afterwards
+# and the wall-clock time, simulated time, and the mean cache hit latencies
+# (after the switch) are printed. 'functional' against 'detailed' is the
+# warm-up speedup. The switched run's latencies are also printed as a percent
+# difference from the detailed run's, which should be close to zero.
+#
+# Usage: compareWarmup.py [--sst sst] [--ops N] [--warmup time]
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+STATS = ["l1cache.latency_GetS_hit", "l2cache.latency_GetS_hit", "l2cache.latency_GetS_miss"]
+
+LATENCY_RE = re.compile(r"^ (\w+\.latency_\w+) : Accumulator : Sum\.u64 = (\d+); SumSQ\.u64 = \d+; Count\.u64 = (\d+);")
+SIMTIME_RE = re.compile(r"simulated time: ([0-9.]+) (\w+)")
+UNITS = {"ps": 1e-3, "ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def run(sst, ops, warmup):
+    """Returns ({statistic: mean latency in cycles}, simulated ns, wall-clock seconds)"""
+    testdir = os.path.dirname(os.path.abspath(__file__))
+    options = "--ops=%d --warmup=%s" % (ops, warmup)
+    start = time.time()
+    result = subprocess.run([sst, "--model-options=" + options, "perfWarmup.py"], cwd=testdir,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    wall = time.time() - start
+    if result.returncode != 0:
+        sys.exit("perfWarmup.py %s failed:\n%s" % (options, result.stdout))
+
+    latency = {}
+    simtime = 0.0
+    for line in result.stdout.splitlines():
+        m = LATENCY_RE.match(line)
+        if m:
+            count = int(m.group(3))
+            if count:
+                latency[m.group(1)] = int(m.group(2)) / float(count)
+            continue
+        m = SIMTIME_RE.search(line)
+        if m:
+            simtime = float(m.group(1)) * UNITS.get(m.group(2), 1.0)
+    return latency, simtime, wall
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Speed and accuracy of functional warm-up")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("--ops", type=int, default=200000, help="requests issued by the core (default: 200000)")
+    parser.add_argument("--warmup", default="50us", help="warm-up time for the switched run (default: 50us)")
+    args = parser.parse_args()
+
+    runs = [("detailed", "0ns"), ("functional", "1s"), ("switched", args.warmup)]
+    results = {}
+    latencies = {}
+    print("%-11s %10s %12s %s" % ("run", "wall (s)", "simtime (ns)", " ".join("%26s" % s for s in STATS)))
+    for name, warmup in runs:
+        latency, simtime, wall = run(args.sst, args.ops, warmup)
+        results[name] = wall
+        latencies[name] = latency
+        print("%-11s %10.2f %12.0f %s" % (name, wall, simtime,
+              " ".join("%26s" % ("%.2f" % latency[s] if s in latency else "-") for s in STATS)))
+
+    for s in STATS:
+        detailed = latencies["detailed"].get(s)
+        switched = latencies["switched"].get(s)
+        if detailed and switched is not None:
+            print("post-switch %s: %.2f vs %.2f detailed (%+.1f%%)" % (s, switched, detailed, 100.0 * (switched - detailed) / detailed))
+        else:
+            print("post-switch %s: not recorded in both runs" % s)
+    if results["functional"]:
+        print("warm-up speedup (detailed / functional wall time): %.1fx" % (results["detailed"] / results["functional"]))
+    if results["switched"]:
+        print("switched run speedup (detailed / switched wall time): %.1fx" % (results["detailed"] / results["switched"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -86,6 +86,7 @@ sst testBackendTimingDRAM-1.py > refFiles/test_memHA_BackendTimingDRAM_1.out &
 sst testBackendTimingDRAM-2.py > refFiles/test_memHA_BackendTimingDRAM_2.out &    
 sst testBackendTimingDRAM-3.py > refFiles/test_memHA_BackendTimingDRAM_3.out &    
 sst testBackendTimingDRAM-4.py > refFiles/test_memHA_BackendTimingDRAM_4.out &    
+sst testBackendAnalytical.py > refFiles/test_memHA_BackendAnalytical.out &
 sst testBackendVaultSim.py > refFiles/test_memHA_BackendVaultSim.out &
 wait
 
@@ -112,9 +113,20 @@ sst testFlushes.py > refFiles/test_memHA_Flushes.out &
 sst testFlushes-2.py > refFiles/test_memHA_Flushes_2.out &
 sst testHashXor.py > refFiles/test_memHA_HashXor.out &    
 sst testIncoherent.py > refFiles/test_memHA_Incoherent.out &
+# Packed replacement policies. The L2 is 6-way for tree-plru to cover a tree over a
+# non-power-of-two set, and 24-way for lru-stack to cover sets too wide for the
+# single-word stack. srrip inserts every line below the eviction threshold, so the
+# first eviction from each full set goes through aging. brrip covers the
+# mostly-distant insertion path.
+sst testIncoherent.py --model-options="--replacement=tree-plru --l2assoc=6 --l2size=12KiB" > refFiles/test_memHA_Replacement_tree_plru.out &
+sst testIncoherent.py --model-options="--replacement=bit-plru" > refFiles/test_memHA_Replacement_bit_plru.out &
+sst testIncoherent.py --model-options="--replacement=srrip" > refFiles/test_memHA_Replacement_srrip.out &
+sst testIncoherent.py --model-options="--replacement=brrip" > refFiles/test_memHA_Replacement_brrip.out &
+sst testIncoherent.py --model-options="--replacement=lru-stack --l2assoc=24 --l2size=24KiB" > refFiles/test_memHA_Replacement_lru_stack.out &
 sst testNoninclusive-1.py > refFiles/test_memHA_Noninclusive_1.out &   
 sst testNoninclusive-2.py > refFiles/test_memHA_Noninclusive_2.out &   
 sst testPrefetchParams.py > refFiles/test_memHA_PrefetchParams.out &
+sst testSparseDirectory.py > refFiles/test_memHA_SparseDirectory.out &
 sst testThroughputThrottling.py > refFiles/test_memHA_ThroughputThrottling.out &  
 wait
 
@@ -25,6 +25,7 @@ componentlist = (
     "memHierarchy.MemoryManagerSieve",
     "memHierarchy.Messier",
     "memHierarchy.defCustomCmdHandler",
+    "memHierarchy.analyticalMem",
     "memHierarchy.cramsim",
     "memHierarchy.emptyCacheListener",
     "memHierarchy.extMemBackendConvertor",
@@ -39,11 +40,16 @@ componentlist = (
     "memHierarchy.reorderByRow",
     "memHierarchy.reorderSimple",
     "memHierarchy.reorderTransactionQ",
+    "memHierarchy.replacement.bit-plru",
+    "memHierarchy.replacement.brrip",
     "memHierarchy.replacement.lfu",
     "memHierarchy.replacement.lru",
+    "memHierarchy.replacement.lru-stack",
     "memHierarchy.replacement.mru",
     "memHierarchy.replacement.nmru",
     "memHierarchy.replacement.rand",
+    "memHierarchy.replacement.srrip",
+    "memHierarchy.replacement.tree-plru",
     "memHierarchy.scratchInterface",
     "memHierarchy.simpleDRAM",
     "memHierarchy.simpleMem",
@@ -55,3 +61,15 @@ componentlist = (
     "memHierarchy.timingDRAM",
     "memHierarchy.vaultsim"
 )
+
+def colocate(rank, thread, *components):
+    """Partitioning hint for parallel runs: place 'components' on the same rank and thread.
+
+    Use it to keep a cache and the directory slice (or memory) that its MemNIC/MemLink
+    talks to most on one partition so that their events never cross a rank boundary.
+    Only partitioners that honor setRank() use it, e.g., 'sst --partitioner=sst.self'.
+    For components joined by a direct link, link.setNoCut() has the same effect with
+    any partitioner.
+    """
+    for comp in components:
+        comp.setRank(rank, thread)
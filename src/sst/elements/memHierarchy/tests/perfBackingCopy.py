@@ -0,0 +1,70 @@
+import sst
+from mhlib import componentlist
+
+# Functional data path throughput
+#
+# A miranda core copies a large array through a tiny L1 backed by a memory
+# controller with a malloc backing store. Nearly every access misses, so each
+# request moves a full cache line between the backing store and an event payload
+# (reads fill GetS responses, writebacks store PutM payloads). Memory timing is
+# kept short so that simulation time is dominated by these copies.
+#
+# Run with:
+#   sst --print-timing-info perfBackingCopy.py
+# and compute requests/second as (memory requests_received_GetS + requests_received_PutM) / wall-clock time.
+
+copy_count = 1000000
+line_size = 256             # Large lines so that the data copy dominates per-event overhead
+array_size = copy_count * 8
+
+cpu = sst.Component("core", "miranda.BaseCPU")
+cpu.addParams({
+    "clock" : "2GHz",
+    "max_reqs_cycle" : 4,
+    "maxmemreqpending" : 64,
+})
+gen = cpu.setSubComponent("generator", "miranda.CopyGenerator")
+gen.addParams({
+    "read_start_address" : 0,
+    "write_start_address" : array_size,
+    "operandwidth" : 8,
+    "request_count" : copy_count,
+    "n_per_call" : 4,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "1",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "2",
+    "cache_line_size" : line_size,
+    "L1" : "1",
+    "cache_size" : str(4 * line_size) + "B",
+    "max_requests_per_cycle" : 4,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "2GHz",
+    "addr_range_end" : 2 * array_size - 1,
+    "backing" : "malloc",
+    "request_width" : line_size,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "1ns",
+    "mem_size" : str(2 * array_size) + "B",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+link_l1_mem = sst.Link("link_l1_mem")
+link_l1_mem.connect( (l1cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
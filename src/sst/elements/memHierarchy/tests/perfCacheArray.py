@@ -0,0 +1,81 @@
+import sst
+from mhlib import componentlist
+
+# Cache array lookup throughput
+#
+# A single core streams random requests through a small L1 into a large,
+# highly associative LLC so that simulation time is dominated by LLC tag lookups
+# and victim selection.
+#
+# Run with:
+#   sst --print-timing-info perfCacheArray.py
+# and compute lookups/second as (l2cache CacheHits + CacheMisses) / wall-clock time.
+
+ops = 500000
+llc_size = "32MiB"
+llc_assoc = 32
+llc_replacement = "lru"   # Compare with "tree-plru", "bit-plru", "srrip", "brrip", or "lru-stack"
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 1,
+    "memSize" : "1GiB",
+    "clock" : "2GHz",
+    "maxOutstanding" : 32,
+    "opCount" : ops,
+    "reqsPerIssue" : 4,
+    "write_freq" : 25,
+    "read_freq" : 75,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "L1" : "1",
+    "cache_size" : "4KiB",
+    "max_requests_per_cycle" : 4,
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "1",
+    "tag_access_latency_cycles" : "1",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : llc_replacement,
+    "coherence_protocol" : "MESI",
+    "associativity" : llc_assoc,
+    "cache_line_size" : "64",
+    "cache_size" : llc_size,
+    "max_requests_per_cycle" : 4,
+    "mshr_num_entries" : 64,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "2GHz",
+    "addr_range_end" : 1024*1024*1024-1,
+    "backing" : "none",
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "1ns",
+    "mem_size" : "1GiB",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "500ps"), (l2cache, "high_network_0", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
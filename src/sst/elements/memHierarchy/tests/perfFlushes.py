@@ -0,0 +1,93 @@
+import sst
+from mhlib import componentlist
+
+# Memory controller flush handling
+#
+# Several cores issue a stream of flushes and flush-invs mixed with reads and
+# writes over a small footprint, as a program taking frequent checkpoints would.
+# The flushes reach the memory controller while earlier requests to the same lines
+# are still queued, so each one has to find and wait on those requests. With a
+# large queue in front of a slow backend, simulation time is dominated by that
+# bookkeeping.
+#
+# Run with:
+#   sst --print-timing-info perfFlushes.py
+# and compute requests/second as (sum of core0..coreN read_reqs + write_reqs + flushes + flushinvs) / wall-clock time.
+
+cores = 4
+ops = 100000
+mem_size = 64*1024         # Small footprint so that flushes find queued requests to their line
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+for i in range(cores):
+    cpu = sst.Component("core" + str(i), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 1,
+        "memSize" : str(mem_size) + "B",
+        "clock" : "2GHz",
+        "rngseed" : 11 + i,
+        "maxOutstanding" : 64,
+        "opCount" : ops,
+        "reqsPerIssue" : 4,
+        "write_freq" : 35,
+        "read_freq" : 35,
+        "flush_freq" : 20,
+        "flushinv_freq" : 10,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(i), "memHierarchy.Cache")
+    l1cache.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "4",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "4KiB",
+        "max_requests_per_cycle" : 4,
+        "mshr_num_entries" : 64,
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(i))
+    link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+    link_l1_bus = sst.Link("link_l1_bus_" + str(i))
+    link_l1_bus.connect( (l1cache, "low_network_0", "500ps"), (bus, "high_network_" + str(i), "500ps") )
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "4",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "8",
+    "cache_line_size" : "64",
+    "cache_size" : "32KiB",
+    "max_requests_per_cycle" : 4,
+    "mshr_num_entries" : 256,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "2GHz",
+    "addr_range_end" : mem_size - 1,
+    "backing" : "none",
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "200ns",
+    "mem_size" : str(mem_size) + "B",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+link_bus_l2 = sst.Link("link_bus_l2")
+link_bus_l2.connect( (bus, "low_network_0", "500ps"), (l2cache, "high_network_0", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
@@ -0,0 +1,89 @@
+import sst
+from mhlib import componentlist
+
+# MSHR throughput
+#
+# Several cores keep many misses outstanding to a shared L2 in front of a slow
+# memory. The L2 MSHR stays close to full and, because the cores share a small
+# footprint, most addresses collect several waiting requests, writebacks, and
+# eviction pointers. Simulation time is dominated by MSHR lookups and queue updates.
+#
+# Run with:
+#   sst --print-timing-info perfMSHR.py
+# and compute requests/second as (sum of core0..coreN read_reqs + write_reqs) / wall-clock time.
+
+cores = 4
+ops = 200000
+mem_size = 256*1024        # Small footprint so that misses conflict in the MSHR
+l2_mshr_entries = 256
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "4",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "cache_size" : "16KiB",
+    "max_requests_per_cycle" : 4,
+    "mshr_num_entries" : l2_mshr_entries,
+})
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+for i in range(cores):
+    cpu = sst.Component("core" + str(i), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 1,
+        "memSize" : str(mem_size) + "B",
+        "clock" : "2GHz",
+        "rngseed" : 7 + i,
+        "maxOutstanding" : 64,
+        "opCount" : ops,
+        "reqsPerIssue" : 4,
+        "write_freq" : 40,
+        "read_freq" : 60,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(i), "memHierarchy.Cache")
+    l1cache.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "2",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "2KiB",
+        "max_requests_per_cycle" : 4,
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(i))
+    link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+    link_l1_bus = sst.Link("link_l1_bus_" + str(i))
+    link_l1_bus.connect( (l1cache, "low_network_0", "500ps"), (bus, "high_network_" + str(i), "500ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "2GHz",
+    "addr_range_end" : mem_size - 1,
+    "backing" : "none",
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "100ns",
+    "mem_size" : str(mem_size) + "B",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+link_bus_l2 = sst.Link("link_bus_l2")
+link_bus_l2.connect( (bus, "low_network_0", "500ps"), (l2cache, "high_network_0", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
@@ -0,0 +1,91 @@
+import sst
+import sys, getopt
+from mhlib import componentlist
+
+# Functional warm-up
+#
+# A single core streams random requests through an L1 and a large L2. Until
+# 'warmup' the caches and memory run functionally: no clocks, access latencies,
+# or bandwidth limits, and the memory answers from its backing store without
+# the backend. Afterwards everything switches to the detailed timing model.
+#
+# Run with:
+#   sst --print-timing-info perfWarmup.py
+# and compare wall-clock time with --model-options="--warmup=0ns" (no warm-up),
+# or use compareWarmup.py, which does this and prints the speedup.
+# Statistics are only collected after the switch ("startat" below).
+# Options: --ops=<requests> (default 200000), --warmup=<time> (default 50us)
+
+ops = 200000
+warmup = "50us"
+
+opts, args = getopt.getopt(sys.argv[1:], "", ["ops=", "warmup="])
+for o, a in opts:
+    if o == "--ops":
+        ops = int(a)
+    elif o == "--warmup":
+        warmup = a
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 1,
+    "memSize" : "64MiB",
+    "clock" : "2GHz",
+    "maxOutstanding" : 16,
+    "opCount" : ops,
+    "reqsPerIssue" : 2,
+    "write_freq" : 25,
+    "read_freq" : 75,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "8",
+    "cache_line_size" : "64",
+    "L1" : "1",
+    "cache_size" : "32KiB",
+    "warmup_time" : warmup,
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "10",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "16",
+    "cache_line_size" : "64",
+    "cache_size" : "4MiB",
+    "mshr_num_entries" : 32,
+    "warmup_time" : warmup,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : 64*1024*1024-1,
+    "backing" : "malloc",
+    "warmup_time" : warmup,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "64MiB",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a, {"startat" : warmup})
+
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "500ps"), (l2cache, "high_network_0", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
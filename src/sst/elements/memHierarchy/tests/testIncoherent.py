@@ -1,4 +1,5 @@
 import sst
+import sys, getopt
 from mhlib import componentlist
 
 DEBUG_L1 = 0
@@ -6,6 +7,23 @@ DEBUG_L2 = 0
 DEBUG_MEM = 0
 DEBUG_LEV = 10
 
+# Optional overrides so that the testsuite can rerun this test with other replacement policies
+#   --replacement=<policy>  Replacement policy for both caches
+#   --l2assoc=<n>           L2 associativity
+#   --l2size=<size>         L2 size, must be a multiple of 64B * l2assoc
+replacement = "lru"
+l2assoc = "8"
+l2size = "16 KB"
+
+opts, args = getopt.getopt(sys.argv[1:], "", ["replacement=", "l2assoc=", "l2size="])
+for o, a in opts:
+    if o == "--replacement":
+        replacement = a
+    elif o == "--l2assoc":
+        l2assoc = a
+    elif o == "--l2size":
+        l2size = a
+
 # Define the simulation components
 comp_cpu = sst.Component("core", "memHierarchy.standardCPU")
 comp_cpu.addParams({
@@ -26,7 +44,7 @@ comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
 comp_l1cache.addParams({
       "access_latency_cycles" : "4",
       "cache_frequency" : "2 Ghz",
-      "replacement_policy" : "lru",
+      "replacement_policy" : replacement,
       "coherence_protocol" : "none",
       "associativity" : "4",
       "cache_line_size" : "64",
@@ -40,11 +58,11 @@ comp_l2cache.addParams({
       "access_latency_cycles" : "10",
       "mshr_latency_cycles" : 2,
       "cache_frequency" : "2 Ghz",
-      "replacement_policy" : "lru",
+      "replacement_policy" : replacement,
       "coherence_protocol" : "none",
-      "associativity" : "8",
+      "associativity" : l2assoc,
       "cache_line_size" : "64",
-      "cache_size" : "16 KB",
+      "cache_size" : l2size,
       "cache_type" : "noninclusive",
       "debug" : DEBUG_L2,
       "debug_level" : DEBUG_LEV
@@ -0,0 +1,121 @@
+import sst
+import os, sys, getopt
+from mhlib import componentlist
+
+# Address region profiler
+#
+# Four cores share a small footprint through private L1s and a directory, so lines
+# move between caches and get invalidated often. The L1s and the directory each
+# load a region profiler; at the end of simulation each writes a heatmap of
+# accesses, misses, evictions, and invalidations per region:
+#   l1cache<N>.regions.csv       (1KiB regions, every event)
+#   directory.regions.bin        (4KiB regions, binary, one event in 4 sampled)
+# Pass --model-options="--outdir=<dir>" to write them somewhere other than the current directory.
+
+cores = 4
+ops = 5000
+mem_size = 64*1024
+
+outdir = "."
+opts, args = getopt.getopt(sys.argv[1:], "", ["outdir="])
+for o, a in opts:
+    if o == "--outdir":
+        outdir = a
+
+chiprtr = sst.Component("network", "merlin.hr_router")
+chiprtr.addParams({
+      "xbar_bw" : "1GB/s",
+      "link_bw" : "1GB/s",
+      "input_buf_size" : "1KB",
+      "num_ports" : str(cores + 1),
+      "flit_size" : "72B",
+      "output_buf_size" : "1KB",
+      "id" : "0",
+      "topology" : "merlin.singlerouter"
+})
+chiprtr.setSubComponent("topology","merlin.singlerouter")
+
+for i in range(cores):
+    cpu = sst.Component("core" + str(i), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 1,
+        "memSize" : str(mem_size) + "B",
+        "clock" : "2GHz",
+        "rngseed" : 3 + i,
+        "maxOutstanding" : 16,
+        "opCount" : ops,
+        "reqsPerIssue" : 2,
+        "write_freq" : 40,
+        "read_freq" : 60,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(i), "memHierarchy.Cache")
+    l1cache.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "4",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "4KiB",
+    })
+    profiler = l1cache.setSubComponent("profiler", "memHierarchy.regionProfiler")
+    profiler.addParams({
+        "region_size" : "1KiB",
+        "output" : os.path.join(outdir, "l1cache" + str(i) + ".regions.csv"),
+    })
+    l1NIC = l1cache.setSubComponent("memlink", "memHierarchy.MemNIC")
+    l1NIC.addParams({
+        "network_bw" : "25GB/s",
+        "group" : 1,
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(i))
+    link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+    link_l1_net = sst.Link("link_l1_net_" + str(i))
+    link_l1_net.connect( (l1NIC, "port", "1000ps"), (chiprtr, "port" + str(i + 1), "1000ps") )
+
+dirctrl = sst.Component("directory", "memHierarchy.DirectoryController")
+dirctrl.addParams({
+      "coherence_protocol" : "MESI",
+      "entry_cache_size" : 1024,
+      "addr_range_start" : "0x0",
+      "addr_range_end" : mem_size - 1,
+})
+dirProfiler = dirctrl.setSubComponent("profiler", "memHierarchy.regionProfiler")
+dirProfiler.addParams({
+      "region_size" : "4KiB",
+      "sample_period" : 4,
+      "format" : "binary",
+      "output" : os.path.join(outdir, "directory.regions.bin"),
+})
+dirNIC = dirctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+dirNIC.addParams({
+      "network_bw" : "25GB/s",
+      "group" : 2,
+})
+dirMemLink = dirctrl.setSubComponent("memlink", "memHierarchy.MemLink")
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : mem_size - 1,
+})
+memToDir = memctrl.setSubComponent("cpulink", "memHierarchy.MemLink")
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+      "access_time" : "100 ns",
+      "mem_size" : str(mem_size) + "B",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+link_dir_net = sst.Link("link_dir_net")
+link_dir_net.connect( (chiprtr, "port0", "1000ps"), (dirNIC, "port", "1000ps") )
+link_dir_mem = sst.Link("link_dir_mem")
+link_dir_mem.connect( (dirMemLink, "port", "1000ps"), (memToDir, "port", "1000ps") )
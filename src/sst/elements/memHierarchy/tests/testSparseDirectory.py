@@ -0,0 +1,117 @@
+import sst
+from mhlib import componentlist
+
+# Sparse directory
+#
+# Four cores with private L1/L2 caches share a directory over a network. The directory
+# tracks lines in a 512-entry sparse directory, which is half the combined capacity of the
+# L2s, so it regularly evicts entries and invalidates the corresponding lines in the L2s.
+# See the 'directory_evictions' statistic.
+
+DEBUG_DIR = 0
+
+cores = 4
+ops = 10000
+mem_size = 1024*1024
+
+chiprtr = sst.Component("network", "merlin.hr_router")
+chiprtr.addParams({
+      "xbar_bw" : "1GB/s",
+      "link_bw" : "1GB/s",
+      "input_buf_size" : "1KB",
+      "num_ports" : str(cores + 1),
+      "flit_size" : "72B",
+      "output_buf_size" : "1KB",
+      "id" : "0",
+      "topology" : "merlin.singlerouter"
+})
+chiprtr.setSubComponent("topology","merlin.singlerouter")
+
+for i in range(cores):
+    cpu = sst.Component("core" + str(i), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 1,
+        "memSize" : str(mem_size) + "B",
+        "clock" : "2GHz",
+        "rngseed" : 11 + i,
+        "maxOutstanding" : 16,
+        "opCount" : ops,
+        "reqsPerIssue" : 2,
+        "write_freq" : 40,
+        "read_freq" : 60,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(i), "memHierarchy.Cache")
+    l1cache.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "4",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "4KiB",
+    })
+
+    l2cache = sst.Component("l2cache" + str(i), "memHierarchy.Cache")
+    l2cache.addParams({
+        "access_latency_cycles" : "8",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "8",
+        "cache_line_size" : "64",
+        "cache_size" : "8KiB",
+    })
+    l2NIC = l2cache.setSubComponent("memlink", "memHierarchy.MemNIC")
+    l2NIC.addParams({
+        "network_bw" : "25GB/s",
+        "group" : 1,
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(i))
+    link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+    link_l1_l2 = sst.Link("link_l1_l2_" + str(i))
+    link_l1_l2.connect( (l1cache, "low_network_0", "500ps"), (l2cache, "high_network_0", "500ps") )
+    link_l2_net = sst.Link("link_l2_net_" + str(i))
+    link_l2_net.connect( (l2NIC, "port", "1000ps"), (chiprtr, "port" + str(i + 1), "1000ps") )
+
+dirctrl = sst.Component("directory", "memHierarchy.DirectoryController")
+dirctrl.addParams({
+      "coherence_protocol" : "MESI",
+      "debug" : DEBUG_DIR,
+      "debug_level" : "10",
+      "sparse_entries" : 512,
+      "sparse_associativity" : 8,
+      "addr_range_start" : "0x0",
+      "addr_range_end" : mem_size - 1,
+})
+dirNIC = dirctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+dirNIC.addParams({
+      "network_bw" : "25GB/s",
+      "group" : 2,
+})
+dirMemLink = dirctrl.setSubComponent("memlink", "memHierarchy.MemLink")
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : mem_size - 1,
+})
+memToDir = memctrl.setSubComponent("cpulink", "memHierarchy.MemLink")
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+      "access_time" : "100 ns",
+      "mem_size" : str(mem_size) + "B",
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+link_dir_net = sst.Link("link_dir_net")
+link_dir_net.connect( (chiprtr, "port0", "1000ps"), (dirNIC, "port", "1000ps") )
+link_dir_mem = sst.Link("link_dir_mem")
+link_dir_mem.connect( (dirMemLink, "port", "1000ps"), (memToDir, "port", "1000ps") )
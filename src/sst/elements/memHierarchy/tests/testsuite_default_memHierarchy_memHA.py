@@ -3,6 +3,7 @@
 from sst_unittest import *
 from sst_unittest_support import *
 import os.path
+import re
 
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
@@ -86,6 +87,10 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_Incoherent(self):
         self.memHA_Template("Incoherent")
 
+    # The packed replacement policies are exercised by rerunning testIncoherent.py with
+    # --replacement (see genRefs.sh). They are not registered until genRefs.sh has produced
+    # refFiles/test_memHA_Replacement_*.out.
+
     def test_memHA_Noninclusive_1(self):
         self.memHA_Template("Noninclusive_1")
 
@@ -133,6 +138,12 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_BackendTimingDRAM_4(self):
         self.memHA_Template("BackendTimingDRAM_4")
 
+    # testBackendTimingDRAM-5.py is TimingDRAM_3 in event-driven mode. It is not registered until a run has
+    # confirmed that its output matches refFiles/test_memHA_BackendTimingDRAM_3.out (then use refcase="BackendTimingDRAM_3")
+
+    # testBackendAnalytical.py is not registered until genRefs.sh has produced refFiles/test_memHA_BackendAnalytical.out.
+    # compareAnalyticalMem.py reports its accuracy and speed against the TimingDRAM configurations.
+
     @skip_on_sstsimulator_conf_empty_str("DRAMSIM", "LIBDIR", "DRAMSIM is not included as part of this build")
     @skip_on_sstsimulator_conf_empty_str("HBMDRAMSIM", "LIBDIR", "HBMDRAMSIM is not included as part of this build")
     def test_memHA_BackendHBMDramsim(self):
@@ -147,6 +158,48 @@ class testcase_memHierarchy_memHA(SSTTestCase):
 
     def test_memHA_Kingsley(self):
         self.memHA_Template("Kingsley")
+
+    # testSparseDirectory.py is not registered until genRefs.sh has produced refFiles/test_memHA_SparseDirectory.out
+
+    # There is no reference output for testRegionProfiler.py, so this checks the
+    # heatmaps it writes rather than diffing the statistics
+    def test_memHA_RegionProfiler(self):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/testRegionProfiler.py".format(test_path)
+        outfile = "{0}/test_memHA_RegionProfiler.out".format(outdir)
+        errfile = "{0}/test_memHA_RegionProfiler.err".format(outdir)
+        mpioutfiles = "{0}/test_memHA_RegionProfiler.testfile".format(outdir)
+
+        otherargs = '--model-options="--outdir={0}"'.format(outdir)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=otherargs,
+                     timeout_sec=240, mpi_out_files=mpioutfiles)
+
+        # Each L1 profiles 1KiB regions of a 64KiB footprint, every event
+        for i in range(4):
+            csvfile = "{0}/l1cache{1}.regions.csv".format(outdir, i)
+            self.assertTrue(os_test_file(csvfile, "-s"), "Region profiler output {0} is missing or empty".format(csvfile))
+            with open(csvfile, 'r') as fp:
+                header = fp.readline().strip()
+                rows = [line.strip().split(",") for line in fp if line.strip()]
+            self.assertEqual(header, "region_start,accesses,misses,evictions,invalidations,sharers")
+            self.assertTrue(rows, "Region profiler output {0} has no regions".format(csvfile))
+            total = 0
+            for row in rows:
+                self.assertEqual(len(row), 6, "Malformed row in {0}: {1}".format(csvfile, ",".join(row)))
+                if row[0] != "other":
+                    start = int(row[0], 16)
+                    self.assertTrue(start % 1024 == 0 and start < 64 * 1024, "Bad region in {0}: {1}".format(csvfile, row[0]))
+                accesses, misses = int(row[1]), int(row[2])
+                self.assertTrue(misses <= accesses, "More misses than accesses in {0}: {1}".format(csvfile, ",".join(row)))
+                total += accesses
+            self.assertTrue(total > 0, "Region profiler output {0} counted no accesses".format(csvfile))
+
+        binfile = "{0}/directory.regions.bin".format(outdir)
+        self.assertTrue(os_test_file(binfile, "-s"), "Region profiler output {0} is missing or empty".format(binfile))
+        with open(binfile, 'rb') as fp:
+            self.assertEqual(fp.read(4), b"MHRP")
     
     def test_memHA_ScratchCache_1(self):
         self.memHA_Template("ScratchCache_1")
@@ -186,22 +239,57 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     
     def test_memHA_StdMem_mmio3(self):
         self.memHA_Template("StdMem_mmio3")
+
+    def test_memHA_Warmup(self):
+        # Hits after a functional warm-up should be as fast as hits in a run
+        # that was detailed throughout; timestamps left behind by warm-up must not stall them
+        cold = self.memHA_WarmupRun("cold", "0ns")
+        warm = self.memHA_WarmupRun("warm", "2us")
+        for stat in ["l1cache.latency_GetS_hit", "l2cache.latency_GetS_hit"]:
+            self.assertTrue(stat in cold and stat in warm, "Warmup: statistic {0} is missing".format(stat))
+            self.assertTrue(warm[stat] <= cold[stat] * 1.25 + 1,
+                "Warmup: mean {0} after warm-up is {1:.2f}, cold run is {2:.2f}".format(stat, warm[stat], cold[stat]))
 #####
 
+    # Runs perfWarmup.py with a shortened request stream and returns {statistic: mean} for the hit/miss latencies
+    def memHA_WarmupRun(self, name, warmup):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/perfWarmup.py".format(test_path)
+        outfile = "{0}/test_memHA_Warmup_{1}.out".format(outdir, name)
+        errfile = "{0}/test_memHA_Warmup_{1}.err".format(outdir, name)
+        mpioutfiles = "{0}/test_memHA_Warmup_{1}.testfile".format(outdir, name)
+
+        otherargs = '--model-options="--ops=20000 --warmup={0}"'.format(warmup)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=otherargs,
+                     timeout_sec=240, mpi_out_files=mpioutfiles)
+
+        means = {}
+        latency = re.compile(r"^ (\w+\.latency_\w+) : Accumulator : Sum\.u64 = (\d+); SumSQ\.u64 = \d+; Count\.u64 = (\d+);")
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                m = latency.match(line)
+                if m and int(m.group(3)):
+                    means[m.group(1)] = int(m.group(2)) / float(m.group(3))
+        return means
+
+    # sdlcase: run the sdl file for this testcase instead, e.g., to rerun it with different model_options
+    # refcase: diff against this testcase's reference file instead, e.g., for an equivalent configuration
     def memHA_Template(self, testcase,
-                       ignore_err_file=False, testtimeout=240):
+                       ignore_err_file=False, testtimeout=240, sdlcase=None, model_options="", refcase=None):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
         tmpdir = self.get_test_output_tmp_dir()
 
         # Some tweeking of file names are due to inconsistencys with testcase name
-        testcasename_sdl = testcase.replace("_", "-")
+        testcasename_sdl = (sdlcase if sdlcase else testcase).replace("_", "-")
 
         # Set the various file paths
         testDataFileName=("test_memHA_{0}".format(testcase))
         sdlfile = "{0}/test{1}.py".format(test_path, testcasename_sdl)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/test_memHA_{1}.out".format(test_path, refcase if refcase else testcase)
         
         tmpfile = "{0}/{1}.tmp".format(outdir, testDataFileName)
 
@@ -215,7 +303,9 @@ class testcase_memHierarchy_memHA(SSTTestCase):
         log_debug("ref file = {0}".format(reffile))
 
         # Run SST in the tests directory
-        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path,
+        # model_options may refer to the test's output directory as {outdir}
+        otherargs = '--model-options="{0}"'.format(model_options.format(outdir=outdir)) if model_options else ""
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=otherargs,
                      timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
         
         # Lines to ignore
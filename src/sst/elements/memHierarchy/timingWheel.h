@@ -0,0 +1,117 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_TIMINGWHEEL_H
+#define MEMHIERARCHY_TIMINGWHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Queue of items keyed by delivery cycle, for components that hold outgoing events until a
+ * later cycle. Items come out in the same order as a std::multimap<cycle, T>: by cycle, then
+ * by insertion order.
+ *
+ * Each cycle within 'slots' of the current one has a bucket, so inserting and popping are
+ * constant time and, once buckets have grown, allocation free. Items further out wait in an
+ * overflow map and move into their bucket when it comes within range, which keeps them
+ * ahead of anything inserted directly into that bucket later.
+ *
+ * Cycles passed to insert() must not be earlier than the last limit passed to ready().
+ */
+template<class T>
+class TimingWheel {
+public:
+    TimingWheel(size_t slots = 64) : now_(0), count_(0) {
+        size_t size = 1;
+        while (size < slots)
+            size <<= 1;
+        buckets_.resize(size);
+        mask_ = size - 1;
+    }
+
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+
+    void insert(uint64_t cycle, const T& item) {
+        if (cycle < now_)
+            cycle = now_;
+        if (cycle - now_ > mask_)
+            overflow_.insert(std::make_pair(cycle, item));
+        else
+            buckets_[cycle & mask_].push(item);
+        count_++;
+    }
+
+    /* Whether an item with a delivery cycle before 'limit' is waiting. If so, front() is the earliest. */
+    bool ready(uint64_t limit) {
+        if (count_ == 0) {
+            if (now_ < limit)
+                now_ = limit;
+            return false;
+        }
+        while (now_ < limit) {
+            if (!buckets_[now_ & mask_].empty())
+                return true;
+            now_++;
+            // The bucket for now_ + mask_ just came into range
+            while (!overflow_.empty() && overflow_.begin()->first - now_ <= mask_) {
+                buckets_[overflow_.begin()->first & mask_].push(overflow_.begin()->second);
+                overflow_.erase(overflow_.begin());
+            }
+        }
+        return false;
+    }
+
+    T& front() { return buckets_[now_ & mask_].front(); }
+
+    void pop() {
+        buckets_[now_ & mask_].pop();
+        count_--;
+    }
+
+private:
+    /* FIFO that reuses its storage once drained */
+    struct Bucket {
+        Bucket() : head(0) { }
+        std::vector<T> items;
+        size_t head;
+
+        bool empty() const { return head == items.size(); }
+        void push(const T& item) { items.push_back(item); }
+        T& front() { return items[head]; }
+        void pop() {
+            if (++head == items.size()) {
+                items.clear();
+                head = 0;
+            }
+        }
+    };
+
+    std::vector<Bucket> buckets_;
+    std::multimap<uint64_t, T> overflow_;
+    uint64_t mask_;
+    uint64_t now_;      // Earliest cycle that may have items
+    size_t count_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_TIMINGWHEEL_H */
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+#
+# Summarize memHierarchy latency traces
+#
+# memHierarchy built with -DMEMH_LATENCY_TRACE writes a trace for each StandardInterface
+# with the 'latency_trace' parameter set (see latencyTrace.h for the format). This script
+# reports, per stage, the mean and percentiles of the time sampled requests spent there.
+#
+# Usage: latencyReport.py [--by-command] [--percentiles 50,90,99] trace [trace ...]
+#
+import argparse
+import math
+import struct
+import sys
+
+STAGES = ["link", "network", "wait", "access", "memory"]
+
+
+def read_trace(path):
+    """Returns (command names, rows). Each row is [command, total, stage...] in ps."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[0:4] != b"MHLT":
+        sys.exit("%s: not a memHierarchy latency trace" % path)
+    version, stage_count, command_count, ps_per_tick = struct.unpack_from("=IIId", data, 4)
+    if version != 1:
+        sys.exit("%s: unsupported trace version %d" % (path, version))
+    if stage_count != len(STAGES):
+        sys.exit("%s: expected %d stages, found %d" % (path, len(STAGES), stage_count))
+
+    offset = 24
+    commands = []
+    for _ in range(command_count):
+        end = data.index(b"\0", offset)
+        commands.append(data[offset:end].decode())
+        offset = end + 1
+
+    row = struct.Struct("=%dQ" % (2 + stage_count))
+    rows = []
+    for values in row.iter_unpack(data[offset:offset + (len(data) - offset) // row.size * row.size]):
+        rows.append([values[0]] + [v * ps_per_tick for v in values[1:]])
+    return commands, rows
+
+
+def percentile(values, p):
+    """Nearest-rank percentile of a sorted list"""
+    rank = max(0, min(len(values) - 1, int(math.ceil(p / 100.0 * len(values))) - 1))
+    return values[rank]
+
+
+def report(title, rows, percentiles):
+    print("%s: %d requests" % (title, len(rows)))
+    print("  %-8s %12s %7s" % ("stage", "mean(ns)", "share") +
+          "".join(" %10s" % ("p%g(ns)" % p) for p in percentiles))
+    total_mean = sum(r[1] for r in rows) / len(rows)
+    for i, name in enumerate(["total"] + STAGES):
+        values = sorted(r[1 + i] for r in rows)
+        mean = sum(values) / len(values)
+        share = 100.0 * mean / total_mean if total_mean else 0.0
+        print("  %-8s %12.3f %6.1f%%" % (name, mean / 1000.0, share) +
+              "".join(" %10.3f" % (percentile(values, p) / 1000.0) for p in percentiles))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Per-stage latency percentiles from memHierarchy latency traces")
+    parser.add_argument("traces", nargs="+", help="trace files written by StandardInterface 'latency_trace'")
+    parser.add_argument("--by-command", action="store_true", help="report each request command separately")
+    parser.add_argument("--percentiles", default="50,90,99,100", help="comma-separated percentiles (default: 50,90,99,100)")
+    args = parser.parse_args()
+
+    percentiles = [float(p) for p in args.percentiles.split(",")]
+    groups = {}
+    for path in args.traces:
+        commands, rows = read_trace(path)
+        for r in rows:
+            key = commands[r[0]] if args.by_command and r[0] < len(commands) else "all"
+            groups.setdefault(key, []).append(r)
+
+    if not groups:
+        sys.exit("No requests traced")
+    for key in sorted(groups):
+        report(key, groups[key], percentiles)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_WARMUP_H
+#define MEMHIERARCHY_WARMUP_H
+
+#include <sst/core/sst_types.h>
+
+#include "sst/elements/memHierarchy/memEvent.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Functional warm-up state for caches, directories, and memory controllers
+ *
+ * During warm-up a component handles each event as soon as it arrives and sends whatever
+ * results right away. No clock runs, access latencies and bandwidth limits are ignored, and
+ * memory controllers answer from the backing store without using their backend. The coherence
+ * protocols run unchanged, so tags, coherence and replacement state, and data end up as they
+ * would if the same requests had been simulated in detail. Link latencies still apply since
+ * components only communicate over links.
+ *
+ * Each component leaves warm-up at the first event that arrives at or after the end time, or
+ * at the first request to the signal address. To signal from a core, issue a noncacheable
+ * access to that address so that every level along the path sees it.
+ *
+ * Statistics are not paused: events handled during warm-up are counted like any other.
+ * Enable statistics with a 'startat' of the warm-up end time to leave them out.
+ */
+class Warmup {
+public:
+    Warmup() : active_(false), endCycle_(0), hasSignal_(false), signalAddr_(0) { }
+
+    /* endCycle is in core time, 0 for no end time */
+    void configure(SimTime_t endCycle, bool hasSignal, Addr signalAddr) {
+        endCycle_ = endCycle;
+        hasSignal_ = hasSignal;
+        signalAddr_ = signalAddr;
+        active_ = endCycle_ != 0 || hasSignal_;
+    }
+
+    bool active() const { return active_; }
+
+    /* Whether an event arriving at 'now' ends warm-up */
+    bool endsWith(MemEventBase* ev, SimTime_t now) const {
+        if (endCycle_ != 0 && now >= endCycle_)
+            return true;
+        return hasSignal_ && MemEventTypeArr[(int)ev->getCmd()] == MemEventType::Cache
+            && CommandClassArr[(int)ev->getCmd()] == CommandClass::Request
+            && static_cast<MemEvent*>(ev)->getAddr() == signalAddr_;
+    }
+
+    void end() { active_ = false; }
+
+private:
+    bool active_;
+    SimTime_t endCycle_;
+    bool hasSignal_;
+    Addr signalAddr_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_WARMUP_H */
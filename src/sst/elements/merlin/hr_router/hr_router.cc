@@ -136,6 +136,13 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     }
 
 
+    std::string network_model = params.find<std::string>("network_model","detailed");
+    if ( network_model != "detailed" && network_model != "analytical" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router: network_model must be either detailed or analytical: %s\n",
+                           network_model.c_str());
+    }
+    analytical = (network_model == "analytical");
+
     // Get the number of VNs
     num_vns = params.find<int>("num_vns",2);
     vcs_per_vn.resize(num_vns);
@@ -244,6 +251,8 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     if (pc_params.contains("network_inspectors")) pc_params.insert("network_inspectors", params.find<std::string>("network_inspectors", ""));
     pc_params.insert("oql_track_port", params.find<std::string>("oql_track_port","false"));
     pc_params.insert("oql_track_remote", params.find<std::string>("oql_track_remote","false"));
+    pc_params.insert("network_model", network_model);
+    pc_params.insert("compact", params.find<std::string>("compact","false"));
 
     for ( int i = 0; i < num_ports; i++ ) {
         in_port_busy[i] = 0;
@@ -283,8 +292,16 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     arb =
         loadAnonymousSubComponent<XbarArbitration>(xbar_arb, "XbarArb", 0, ComponentInfo::INSERT_STATS, empty_params);
 
-    my_clock_handler = new Clock::Handler<hr_router>(this,&hr_router::clock_handler);
-    xbar_tc = registerClock( xbar_clock, my_clock_handler);
+    // The analytical model forwards packets as they arrive, so there
+    // is no crossbar to clock
+    if ( analytical ) {
+        my_clock_handler = NULL;
+        xbar_tc = NULL;
+    }
+    else {
+        my_clock_handler = new Clock::Handler<hr_router>(this,&hr_router::clock_handler);
+        xbar_tc = registerClock( xbar_clock, my_clock_handler);
+    }
     num_routers++;
 
 #if VERIFY_DECLOCKING
@@ -616,10 +633,18 @@ hr_router::init_vcs()
     // Now that we have the number of VCs we can finish initializing
     // arbitration logic
     arb->setPorts(num_ports,num_vcs);
+    initActiveVCs(num_ports,num_vcs);
+    arb->setActiveMasks(getActiveVCMask(),getActivePortMask());
 
 
 }
 
+SimTime_t
+hr_router::forwardPacket(internal_router_event* ev)
+{
+    return ports[ev->getNextPort()]->sendAnalytical(ev);
+}
+
 void
 hr_router::reportIncomingEvent(internal_router_event* ev)
 {
@@ -68,6 +68,13 @@ public:
         {"num_vns",            "Number of VNs.","2"},
         {"vn_remap",           "Array that specifies the vn remapping for each node in the systsm."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
+        {"network_model",      "Timing model: detailed or analytical.  The analytical model skips buffering, crossbar arbitration and "
+                               "credits and computes each packet's departure from a reservation calendar on each output link.  "
+                               "Adaptive routing sees an idle network, so UGAL behaves like minimal routing.  Only ejection is flow "
+                               "controlled: packets wait at the router for credits from the endpoint, but that wait does not back "
+                               "pressure the rest of the network.  It must be set the same on all routers.", "detailed"},
+        {"compact",            "Reduce per-router memory for very large networks.  Ports do not create the self links used for "
+                               "adaptive link widths unless dlink_thresh is set.", "false"},
         {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"}
     )
 
@@ -100,6 +107,7 @@ private:
     int vn_remap_shm_size;
     int num_vcs;
     std::vector<int> vcs_per_vn;
+    bool analytical;
 
     Topology* topo;
     XbarArbitration* arb;
@@ -157,6 +165,7 @@ public:
     void printStatus(Output& out);
 
     void reportIncomingEvent(internal_router_event* ev);
+    SimTime_t forwardPacket(internal_router_event* ev);
 };
 
 }
@@ -0,0 +1,188 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_SPARSE_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_SPARSE_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+// Round robin arbitration that only looks at VCs with a packet at the
+// head of their input buffer.  It walks the router's active port and
+// VC bitmasks with find-first-set instead of checking every port/VC
+// pair, so the cost per cycle scales with the number of active VCs
+// rather than num_ports * num_vcs.
+//
+// Ports get first pick in round robin order.  Within a port, the
+// search starts at the VC after the one last granted.
+class xbar_arb_sparse : public XbarArbitration {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        xbar_arb_sparse,
+        "merlin",
+        "xbar_arb_sparse",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Round robin arbitration unit for hr_router that only visits active VCs",
+        SST::Merlin::XbarArbitration
+    )
+
+
+private:
+    int num_ports;
+    int num_vcs;
+    int vc_words;
+    int port_words;
+
+    const uint64_t* vc_mask;
+    const uint64_t* port_mask;
+
+    int rr_port;
+    std::vector<int> rr_vcs;
+
+    // Ports whose progress_vc entry was written last cycle
+    std::vector<int> reported;
+
+    // Visits the set bits of a multi-word mask in order, starting at
+    // bit start and wrapping around, until visit returns true.
+    template <typename F>
+    static inline bool scan(const uint64_t* mask, int words, int start, F visit) {
+        int w = start >> 6;
+        uint64_t bits = mask[w] & (~(uint64_t)0 << (start & 63));
+        for ( int n = 0; n <= words; n++ ) {
+            while ( bits ) {
+                int bit = (w << 6) + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                // Back where we started
+                if ( n == words && bit >= start ) return false;
+                if ( visit(bit) ) return true;
+            }
+            w = (w + 1 == words) ? 0 : w + 1;
+            bits = mask[w];
+        }
+        return false;
+    }
+
+public:
+
+    xbar_arb_sparse(ComponentId_t cid, Params& params) :
+        XbarArbitration(cid),
+        vc_mask(NULL),
+        port_mask(NULL),
+        rr_port(0)
+    {
+    }
+
+    ~xbar_arb_sparse() {
+    }
+
+    void setPorts(int num_ports_s, int num_vcs_s) {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+        vc_words = (num_vcs + 63) / 64;
+        port_words = (num_ports + 63) / 64;
+
+        rr_vcs.assign(num_ports, 0);
+        reported.reserve(num_ports);
+    }
+
+    void setActiveMasks(const uint64_t* vc_mask_s, const uint64_t* port_mask_s) {
+        vc_mask = vc_mask_s;
+        port_mask = port_mask_s;
+    }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   )
+    {
+        // Only the entries written last cycle can be stale
+        for ( int port : reported ) progress_vc[port] = -1;
+        reported.clear();
+
+        scan(port_mask, port_words, rr_port, [&](int port) {
+            // if the output of this port is busy, nothing to do.
+            if ( in_port_busy[port] > 0 ) return false;
+
+            internal_router_event** vc_heads = ports[port]->getVCHeads();
+            int granted = -1;
+            scan(&vc_mask[port * vc_words], vc_words, rr_vcs[port], [&](int vc) {
+                internal_router_event* src_event = vc_heads[vc];
+                int next_port = src_event->getNextPort();
+
+                // We can progress if the next port's input is not
+                // busy and there are enough credits.
+                if ( out_port_busy[next_port] > 0 ) return false;
+                if ( !ports[next_port]->spaceToSend(src_event->getVC(), src_event->getFlitCount()) ) return false;
+
+                // Need to set the busy values
+                in_port_busy[port] = src_event->getFlitCount();
+                out_port_busy[next_port] = src_event->getFlitCount();
+                granted = vc;
+                return true;
+            });
+
+            if ( granted != -1 ) {
+                // Tell the router what to move
+                progress_vc[port] = granted;
+                rr_vcs[port] = (granted + 1 == num_vcs) ? 0 : granted + 1;
+            }
+            else {
+                progress_vc[port] = -2;
+            }
+            reported.push_back(port);
+            return false;
+        });
+
+        rr_port = (rr_port + 1 == num_ports) ? 0 : rr_port + 1;
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) {
+        rr_port = (rr_port + cycles) % num_ports;
+    }
+
+    void dumpState(std::ostream& stream) {
+        stream << "Current round robin port: " << rr_port << std::endl;
+        stream << "  Active ports:";
+        scan(port_mask, port_words, 0, [&](int port) {
+            stream << " " << port;
+            return false;
+        });
+        stream << std::endl;
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_SPARSE_H
@@ -66,6 +66,19 @@ LinkControl::LinkControl(ComponentId_t cid, Params &params, int vns) :
     }
     if ( outbuf_size.hasUnits("B") ) outbuf_size *= UnitAlgebra("8b/B");
 
+    // Packet bundling
+    bundle_packets = params.find<int>("bundle_packets",1);
+    if ( bundle_packets < 1 ) {
+        merlin_abort.fatal(CALL_INFO,-1,"LinkControl: bundle_packets must be at least 1: %d\n",bundle_packets);
+    }
+    UnitAlgebra bundle_max_size = params.find<UnitAlgebra>("bundle_max_size","64B");
+    if ( !bundle_max_size.hasUnits("b") && !bundle_max_size.hasUnits("B") ) {
+        merlin_abort.fatal(CALL_INFO,-1,"bundle_max_size must be specified in either "
+                           "bits or bytes: %s\n",bundle_max_size.toStringBestSI().c_str());
+    }
+    if ( bundle_max_size.hasUnits("B") ) bundle_max_size *= UnitAlgebra("8b/B");
+    bundle_max_bits = bundle_max_size.getRoundedValue();
+
     // Configure the links
     // For now give it a fake timebase.  Will give it the real timebase during init
 
@@ -467,6 +480,18 @@ bool LinkControl::send(SimpleNetwork::Request* req, int vn) {
 }
 
 
+size_t LinkControl::send(const std::vector<SimpleNetwork::Request*>& reqs, int vn) {
+    // Packets are bundled as they leave the output queue, so all this
+    // needs to do is get them into the queue together
+    size_t accepted = 0;
+    for ( SimpleNetwork::Request* req : reqs ) {
+        if ( !send(req,vn) ) break;
+        accepted++;
+    }
+    return accepted;
+}
+
+
 // Returns true if there is space in the output buffer and false
 // otherwise.
 bool LinkControl::spaceToSend(int vn, int bits) {
@@ -691,6 +716,15 @@ void LinkControl::handle_output(Event* ev)
             break;
         }
     }
+    // See if the packets behind this one can go in the same event
+    if ( found && bundle_packets > 1 ) {
+        RtrBundleEvent* bundle = buildBundle(vn_to_send, send_event);
+        if ( bundle != nullptr ) {
+            sendBundle(vn_to_send, bundle);
+            return;
+        }
+    }
+
     // If we found an event to send, go ahead and send it
     if ( found ) {
         // Need to return credits to the output buffer
@@ -775,6 +809,85 @@ void LinkControl::handle_output(Event* ev)
     }
 }
 
+RtrBundleEvent* LinkControl::buildBundle(int vn_to_send, RtrEvent* first)
+{
+    // Throttled streams are counted per packet, so nothing is bundled
+    // while congestion management is throttling any destination
+    if ( !congestion_state.empty() ) return nullptr;
+    if ( first->getSizeInBits() > bundle_max_bits ) return nullptr;
+
+    output_queue_bundle_t& out_handle = output_queues[vn_to_send];
+    int credits = router_credits[out_handle.vn] - first->getSizeInFlits();
+    RtrBundleEvent* bundle = nullptr;
+    int count = 1;
+    while ( count < bundle_packets && !out_handle.queue.empty() ) {
+        RtrEvent* next = out_handle.queue.front();
+        if ( next->getSizeInBits() > bundle_max_bits ) break;
+        if ( next->getSizeInFlits() > credits ) break;
+
+        out_handle.queue.pop();
+        if ( bundle == nullptr ) {
+            bundle = new RtrBundleEvent();
+            bundle->addEvent(first);
+        }
+        bundle->addEvent(next);
+        credits -= next->getSizeInFlits();
+        count++;
+    }
+    return bundle;
+}
+
+void LinkControl::sendBundle(int vn_to_send, RtrBundleEvent* bundle)
+{
+    // Same as sending a single event in handle_output(), but the link
+    // is busy for all the packets in the bundle.  Each packet is
+    // stamped with the time it would have been sent on its own, and
+    // the router delays it by its flit offset to match.
+    int size = bundle->getSizeInFlits();
+    output_queues[vn_to_send].credits += size;
+    output_timing->send(size,nullptr);
+
+    curr_out_vn = vn_to_send + 1;
+    if ( curr_out_vn == used_vns ) curr_out_vn = 0;
+
+    router_credits[output_queues[vn_to_send].vn] -= size;
+
+    if (is_idle){
+        idle_time->addData(getCurrentSimCycle() - idle_start);
+        is_idle = false;
+    }
+
+    SimTime_t now = getCurrentSimTimeNano();
+    double flit_ns = (getCoreTimeBase() * output_timing->getDefaultTimeBase()->getFactor()).getDoubleValue() * 1e9;
+    const std::vector<RtrEvent*>& events = bundle->getEvents();
+    for ( size_t i = 0; i < events.size(); i++ ) {
+        RtrEvent* ev = events[i];
+        SimTime_t inject = now + (SimTime_t)(bundle->getFlitOffset(i) * flit_ns);
+        ev->setInjectionTime(inject);
+        send_bit_count->addData(ev->getSizeInBits());
+        if ( ev->getTraceType() == SimpleNetwork::Request::FULL ) {
+            output.output("TRACE(%d): %" PRIu64 " ns: Sent an event to router from LinkControl"
+                          " in NIC: %s on VN %d to dest %" PRIu64 " in a bundle of %zu.\n",
+                          ev->getTraceID(),
+                          inject,
+                          getName().c_str(),
+                          ev->getRouteVN(),
+                          ev->getDest(),
+                          bundle->getEvents().size());
+        }
+    }
+    sent += bundle->getEvents().size();
+    int logical_vn = bundle->getEvents().front()->getLogicalVN();
+
+    rtr_link->send(bundle);
+    last_recv_time = getCurrentSimCycle();
+
+    if (sendFunctor != nullptr ) {
+        bool keep = (*sendFunctor)(logical_vn);
+        if ( !keep ) sendFunctor = nullptr;
+    }
+}
+
 void LinkControl::handle_congestion(Event* ev)
 {
     if ( waiting ) output_timing->send(0,nullptr);
@@ -69,6 +69,11 @@ public:
         {"use_nid_remap",      "If true, will remap logical nids in job to physical ids", "false" },
         {"nid_map_name",       "Base name of shared region where my NID map will be located.  If empty, no NID map will be used.",""},
         {"vn_remap",           "Remap VNs onto/off of the network.  If empty, no vn remapping is done", "" },
+        {"bundle_packets",     "Maximum number of packets sent to the router in a single link event.  Small packets queued on the same VN "
+                               "are packed together when there are credits for all of them.  The router must be a merlin.hr_router.  1 turns bundling off.  "
+                               "Each packet carries the injection time it would have had on its own and the router holds it back by the "
+                               "serialization time of the packets ahead of it, so only the number of link events changes.", "1" },
+        {"bundle_max_size",    "Largest packet, in b or B, that will be packed into a bundle.", "64B" },
 
     )
 
@@ -197,6 +202,10 @@ private:
 
     std::map<int,CongestionState> congestion_state;
 
+    // Packet bundling (see bundle_packets)
+    int bundle_packets;
+    int bundle_max_bits;
+
     // Functors for notifying the parent when there is more space in
     // output queue or when a new packet arrives
     HandlerBase* receiveFunctor;
@@ -230,6 +239,13 @@ public:
     // otherwise.
     bool send(SST::Interfaces::SimpleNetwork::Request* req, int vn);
 
+    // Sends the requests, in order, on a single VN.  Returns the
+    // number of requests accepted; the ones that did not fit in the
+    // output buffer are left with the caller.  With bundle_packets
+    // set, requests sent together reach the router in as few link
+    // events as the credits allow.
+    size_t send(const std::vector<SST::Interfaces::SimpleNetwork::Request*>& reqs, int vn);
+
     // Returns true if there is space in the output buffer and false
     // otherwise.
     bool spaceToSend(int vn, int flits);
@@ -268,6 +284,9 @@ private:
     void handle_output(Event* ev);
     void handle_congestion(Event* ev);
 
+    RtrBundleEvent* buildBundle(int vn_to_send, RtrEvent* first);
+    void sendBundle(int vn_to_send, RtrBundleEvent* bundle);
+
     int sent;
 
     SimTime_t foo;
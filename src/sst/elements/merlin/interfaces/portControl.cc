@@ -34,9 +34,10 @@ PortControl::recvCtrlEvent(CtrlRtrEvent* ev)
     // This packet is for me.  An endpoint is telling me they're done
     // sending data.
     CongestionEvent* cev = static_cast<CongestionEvent*>(ev);
+    if ( !cm_state ) return;
     int src = cev->getTarget();
-    auto cs = congestion_map.find(src);
-    if ( cs != congestion_map.end() ) cs->second.reported_done = true;
+    auto cs = cm_state->congestion_map.find(src);
+    if ( cs != cm_state->congestion_map.end() ) cs->second.reported_done = true;
 }
 
 void
@@ -49,6 +50,14 @@ PortControl::sendCtrlEvent(CtrlRtrEvent* ev)
 	    return;
 	}
 
+    // In the analytical model the event just takes its turn on the
+    // link
+    if ( analytical ) {
+        SimTime_t delay = reserveOutput(ev->getSizeInFlits());
+        port_link->send(delay + output_latency_ticks, core_tc, ev);
+        return;
+    }
+
 	// Put event into buffer that will take priority over the VCs
 	// for sending.  The event will be sent next time the port is
 	// free and it will consume the port for the appropriate time
@@ -122,6 +131,7 @@ PortControl::recv(int vc)
 	if ( input_buf[vc].empty() ) {
 	    vc_heads[vc] = NULL;
 	    parent->dec_vcs_with_data();
+	    parent->markVCIdle(port_number, vc);
 	}
 	else {
         auto event = input_buf[vc].front();
@@ -158,6 +168,9 @@ PortControl::reportIncomingEvent(internal_router_event* ev)
         return;
     }
 
+    auto& congestion_map = cm_state->congestion_map;
+    auto& expiration_queue = cm_state->expiration_queue;
+
     // Record the event
     int src = ev->getSrc();
     auto cs = congestion_map.emplace(src,src);
@@ -249,6 +262,7 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
     parent(rif),
     output(getSimulationOutput()),
     cm_activated(false),
+    cm_state(NULL),
     current_incast(0),
     total_flits_incoming(0),
     total_incast_flits(0)
@@ -291,6 +305,11 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
 
     std::string output_latency_timebase = params.find<std::string>("output_latency","0ns");
 
+    analytical = (params.find<std::string>("network_model","detailed") == "analytical");
+    core_tc = getTimeConverter(getCoreTimeBase());
+    output_latency_ticks = (UnitAlgebra(output_latency_timebase) / getCoreTimeBase()).getRoundedValue();
+    output_free_time = 0;
+
 
     // Configure the links.  output_timing will have a temporary time bases.  It will be
     // changed once the final link BW is set.
@@ -302,6 +321,8 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
         if ( port_link != NULL ) {
             output_timing = configureSelfLink(link_port_name + "_output_timing", "1GHz",
                                               new Event::Handler<PortControl>(this,&PortControl::handle_output));
+            bundle_timing = configureSelfLink(link_port_name + "_bundle_timing", "1GHz",
+                                              new Event::Handler<PortControl>(this,&PortControl::handle_bundle));
         }
         break;
     case Topology::R2R:
@@ -327,11 +348,19 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
 
 	// This is the self link to enable the logic for adaptive link widths.
 	// The initial call to the handler dynlink_timing->send is made in setup.
-	dynlink_timing = configureSelfLink(link_port_name + "_dynlink_timing", "10us",
-                                       new Event::Handler<PortControl>(this,&PortControl::handleSAIWindow));
-
-	disable_timing = configureSelfLink(link_port_name + "_disable_timing", "1us",
-                                       new Event::Handler<PortControl>(this,&PortControl::reenablePort));
+    // In compact mode the links are only created if they will be used.
+    if ( !params.find<bool>("compact",false) ||
+         (port_link != NULL && params.find<float>("dlink_thresh",-1.0) >= 0) ) {
+        dynlink_timing = configureSelfLink(link_port_name + "_dynlink_timing", "10us",
+                                           new Event::Handler<PortControl>(this,&PortControl::handleSAIWindow));
+
+        disable_timing = configureSelfLink(link_port_name + "_disable_timing", "1us",
+                                           new Event::Handler<PortControl>(this,&PortControl::reenablePort));
+    }
+    else {
+        dynlink_timing = NULL;
+        disable_timing = NULL;
+    }
     connected = true;
 
     if ( port_link == NULL ) {
@@ -369,6 +398,7 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
     }
 
     enable_congestion_management = params.find<bool>("enable_congestion_management","false");
+    if ( enable_congestion_management && host_port ) cm_state = new CongestionState();
 
     found = false;
     UnitAlgebra cm_ot = params.find<UnitAlgebra>("cm_outstanding_threshold", found);
@@ -549,6 +579,7 @@ PortControl::~PortControl() {
     if ( output_buf_count != NULL ) delete [] output_buf_count;
     if ( port_ret_credits != NULL ) delete [] port_ret_credits;
     if ( port_out_credits != NULL ) delete [] port_out_credits;
+    delete cm_state;
     for ( unsigned int i = 0; i < network_inspectors.size(); i++ ) {
         delete network_inspectors[i];
     }
@@ -561,7 +592,8 @@ PortControl::setup() {
         port_link->replaceFunctor(new Event::Handler<PortControl>(this,&PortControl::handle_failed));
         output_timing->replaceFunctor(new Event::Handler<PortControl>(this,&PortControl::handle_failed));
     }
-	if (dlink_thresh >= 0) dynlink_timing->send(1,NULL);
+	// Link width adjustment is not modeled in the analytical model
+	if (dlink_thresh >= 0 && !analytical) dynlink_timing->send(1,NULL);
     while ( init_events.size() ) {
         delete init_events.front();
         init_events.pop_front();
@@ -573,7 +605,12 @@ PortControl::finish() {
     if ( !connected ) return;
 
     // Any links that ended in an idle state need to add stats
-    if (is_idle && connected) {
+    if ( analytical ) {
+        if ( getCurrentSimCycle() > output_free_time ) {
+            idle_time->addData(getCurrentSimCycle() - output_free_time);
+        }
+    }
+    else if (is_idle && connected) {
         idle_time->addData(getCurrentSimCycle() - idle_start);
         is_idle = false;
     }
@@ -914,6 +951,15 @@ PortControl::handle_input_n2r(Event* ev)
 	    credit_event* ce = static_cast<credit_event*>(ev);
 	    port_out_credits[ce->vc] += ce->credits;
 
+        // The analytical model only flow controls ejection: credits
+        // from the LinkControl release packets waiting for space in
+        // the endpoint's input buffer
+        if ( analytical ) {
+            delete ce;
+            drainAnalytical();
+            break;
+        }
+
         if ( oql_track_remote ) {
             if ( oql_track_port ) {
                 for ( int i = 0; i < num_vcs; ++i ) {
@@ -941,44 +987,11 @@ PortControl::handle_input_n2r(Event* ev)
 	}
     break;
 	case BaseRtrEvent::PACKET:
-	{
-	    RtrEvent* event = static_cast<RtrEvent*>(ev);
-	    // Simply put the event into the right virtual network queue
-
-	    // Need to process input and do the routing
-        int vn = event->getRouteVN();
-        internal_router_event* rtr_event = topo->process_input(event);
-        if ( enable_congestion_management ) parent->reportIncomingEvent(rtr_event);
-        rtr_event->setCreditReturnVC(vn);
-        int curr_vc = rtr_event->getVC();
-
-	    input_buf[curr_vc].push(rtr_event);
-	    input_buf_count[curr_vc]++;
-
-	    // If this becomes vc_head we need to put it into the vc_heads
-	    // array and do the routing decision here using route_packet()
-	    if ( vc_heads[curr_vc] == NULL ) {
-            topo->route_packet(port_number, rtr_event->getVC(), rtr_event);
-            vc_heads[curr_vc] = rtr_event;
-            parent->inc_vcs_with_data();
-	    }
-
-	    if ( event->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
-            output.output("TRACE(%d): %" PRIu64 " ns: Received an event on port %d in router %d"
-                          " (%s) on VC %d from src %" PRIu64 " to dest %" PRIu64 ".\n",
-                          event->getTraceID(),
-                          getCurrentSimTimeNano(),
-                          port_number,
-                          rtr_id,
-                          getName().c_str(),
-                          curr_vc,
-                          event->getTrustedSrc(),
-                          event->getDest());
-	    }
-
-	    if ( parent->getRequestNotifyOnEvent() ) parent->notifyEvent();
-	}
-    break;
+	    acceptHostPacket(static_cast<RtrEvent*>(ev));
+	    break;
+	case BaseRtrEvent::BUNDLE:
+	    handle_bundle(ev);
+	    break;
 	case BaseRtrEvent::INTERNAL:
 	    // Should never get here
 	    break;
@@ -990,6 +1003,68 @@ PortControl::handle_input_n2r(Event* ev)
 	}
 }
 
+void
+PortControl::handle_bundle(Event* ev)
+{
+    // Packets the endpoint packed into one event are accepted one at a
+    // time, each when it would have arrived if sent on its own.  The
+    // bundle waits on bundle_timing until its next packet is due.
+    RtrBundleEvent* bundle = static_cast<RtrBundleEvent*>(ev);
+    int offset = bundle->nextFlitOffset();
+    while ( !bundle->empty() && bundle->nextFlitOffset() == offset ) {
+        acceptHostPacket(bundle->takeNext());
+    }
+    if ( bundle->empty() ) {
+        delete bundle;
+        return;
+    }
+    bundle_timing->send(bundle->nextFlitOffset() - offset, output_timing->getDefaultTimeBase(), bundle);
+}
+
+void
+PortControl::acceptHostPacket(RtrEvent* event)
+{
+    // Simply put the event into the right virtual network queue
+
+    // Need to process input and do the routing
+    int vn = event->getRouteVN();
+    internal_router_event* rtr_event = topo->process_input(event);
+    if ( enable_congestion_management ) parent->reportIncomingEvent(rtr_event);
+    rtr_event->setCreditReturnVC(vn);
+    if ( analytical ) {
+        forwardAnalytical(rtr_event);
+        return;
+    }
+    int curr_vc = rtr_event->getVC();
+
+    input_buf[curr_vc].push(rtr_event);
+    input_buf_count[curr_vc]++;
+
+    // If this becomes vc_head we need to put it into the vc_heads
+    // array and do the routing decision here using route_packet()
+    if ( vc_heads[curr_vc] == NULL ) {
+        topo->route_packet(port_number, rtr_event->getVC(), rtr_event);
+        vc_heads[curr_vc] = rtr_event;
+        parent->inc_vcs_with_data();
+        parent->markVCActive(port_number, curr_vc);
+    }
+
+    if ( event->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Received an event on port %d in router %d"
+                      " (%s) on VC %d from src %" PRIu64 " to dest %" PRIu64 ".\n",
+                      event->getTraceID(),
+                      getCurrentSimTimeNano(),
+                      port_number,
+                      rtr_id,
+                      getName().c_str(),
+                      curr_vc,
+                      event->getTrustedSrc(),
+                      event->getDest());
+    }
+
+    if ( parent->getRequestNotifyOnEvent() ) parent->notifyEvent();
+}
+
 void
 PortControl::handle_input_r2r(Event* ev)
 {
@@ -1030,6 +1105,10 @@ PortControl::handle_input_r2r(Event* ev)
     {
 	    internal_router_event* event = static_cast<internal_router_event*>(ev);
         if ( enable_congestion_management ) parent->reportIncomingEvent(event);
+        if ( analytical ) {
+            forwardAnalytical(event);
+            break;
+        }
 	    // Simply put the event into the right virtual network queue
 
 	    // Need to do the routing
@@ -1044,6 +1123,7 @@ PortControl::handle_input_r2r(Event* ev)
             topo->route_packet(port_number, event->getVC(), event);
             vc_heads[curr_vc] = event;
             parent->inc_vcs_with_data();
+            parent->markVCActive(port_number, curr_vc);
 	    }
 
 	    if ( event->getTraceType() != SimpleNetwork::Request::NONE ) {
@@ -1201,6 +1281,120 @@ PortControl::handle_output(Event* ev) {
 #endif
 }
 
+void
+PortControl::forwardAnalytical(internal_router_event* ev)
+{
+    topo->route_packet(port_number, ev->getVC(), ev);
+
+    if ( ev->getTraceType() != SimpleNetwork::Request::NONE ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Received an event on port %d in router %d"
+                      " (%s) on VC %d from src %d to dest %d, forwarding to port %d.\n",
+                      ev->getTraceID(),
+                      getCurrentSimTimeNano(),
+                      port_number,
+                      rtr_id,
+                      getName().c_str(),
+                      ev->getVC(),
+                      ev->getSrc(),
+                      ev->getDest(),
+                      ev->getNextPort());
+    }
+
+    // The event may be gone once it is forwarded
+    int flits = ev->getFlitCount();
+    int vc_return = ev->getCreditReturnVC();
+    SimTime_t delay = parent->forwardPacket(ev);
+
+    // Only endpoints are flow controlled.  The input buffer space is
+    // returned once the packet starts to leave the router, or right
+    // away if it is held at an ejection port waiting for credits.
+    if ( host_port ) {
+        port_link->send(delay + output_latency_ticks, core_tc, new credit_event(vc_return,flits));
+    }
+}
+
+SimTime_t
+PortControl::reserveOutput(int flits)
+{
+    SimTime_t now = getCurrentSimCycle();
+    SimTime_t start = output_free_time;
+    if ( start < now ) {
+        idle_time->addData(now - start);
+        start = now;
+    }
+    output_free_time = start + flits * flit_cycle->getFactor();
+    return start - now;
+}
+
+SimTime_t
+PortControl::sendAnalytical(internal_router_event* ev)
+{
+    // Host ports wait for credits from the endpoint, which are per
+    // VN.  Packets that cannot be ejected yet wait in order in the
+    // output buffer for their VN.
+    if ( host_port ) {
+        int vn = ev->getVN();
+        int flits = ev->getFlitCount();
+        if ( !output_buf[vn].empty() || port_out_credits[vn] < flits ) {
+            output_buf[vn].push(ev);
+            return 0;
+        }
+        port_out_credits[vn] -= flits;
+    }
+    return transmitAnalytical(ev);
+}
+
+void
+PortControl::drainAnalytical()
+{
+    for ( int vn = 0; vn < num_vns; vn++ ) {
+        while ( !output_buf[vn].empty() && port_out_credits[vn] >= output_buf[vn].front()->getFlitCount() ) {
+            internal_router_event* ev = output_buf[vn].front();
+            output_buf[vn].pop();
+            port_out_credits[vn] -= ev->getFlitCount();
+            transmitAnalytical(ev);
+        }
+    }
+}
+
+SimTime_t
+PortControl::transmitAnalytical(internal_router_event* ev)
+{
+    SimTime_t delay = reserveOutput(ev->getFlitCount());
+
+    if ( ev->getTraceType() == SimpleNetwork::Request::FULL ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Reserved output port %d in router %d"
+                      " (%s) after a wait of %" PRIu64 " core cycles for event from src %d to dest %d.\n",
+                      ev->getTraceID(),
+                      getCurrentSimTimeNano(),
+                      port_number,
+                      rtr_id,
+                      getName().c_str(),
+                      delay,
+                      ev->getSrc(),
+                      ev->getDest());
+    }
+    send_bit_count->addData(ev->getEncapsulatedEvent()->getSizeInBits());
+    send_packet_count->addData(1);
+
+    for ( unsigned int i = 0; i < network_inspectors.size(); i++ ) {
+        network_inspectors[i]->inspectNetworkData(ev->inspectRequest());
+    }
+
+    if ( host_port ) {
+        if ( enable_congestion_management ) {
+            updateCongestionState(ev);
+        }
+        port_link->send(delay + output_latency_ticks, core_tc, ev->getEncapsulatedEvent());
+        ev->setEncapsulatedEvent(NULL);
+        delete ev;
+    }
+    else {
+        port_link->send(delay + output_latency_ticks, core_tc, ev);
+    }
+    return delay;
+}
+
 void
 PortControl::handle_failed(Event* ev) {
     merlin_abort.fatal(CALL_INFO, 1, "INTERNAL ERROR: Event sent to port that has been marked as failed.  There must be something wrong with the routing algorithm being used.\n");
@@ -1269,8 +1463,10 @@ PortControl::decreaseLinkWidth() {
         output_timing->setDefaultTimeBase(tc);
         width_adj_count->addData(1);
         // I need to add a delay before messages can transmit on the link
-        disable_timing->send(1,NULL);
-        sai_port_disabled = true;
+        if ( disable_timing ) {
+            disable_timing->send(1,NULL);
+            sai_port_disabled = true;
+        }
         return true;
     }
     else return false;
@@ -1296,8 +1492,10 @@ PortControl::increaseLinkWidth()
         output_timing->setDefaultTimeBase(tc);
         width_adj_count->addData(1);
         // I need to add a delay before messages can transmit on the link
-        disable_timing->send(1,NULL);
-        sai_port_disabled = true;
+        if ( disable_timing ) {
+            disable_timing->send(1,NULL);
+            sai_port_disabled = true;
+        }
         return true;
     }
 
@@ -1311,6 +1509,9 @@ PortControl::updateCongestionState(internal_router_event* send_event)
     // Adjust the total number of incoming flits
     total_flits_incoming -= send_event->getFlitCount();
 
+    auto& congestion_map = cm_state->congestion_map;
+    auto& expiration_queue = cm_state->expiration_queue;
+
     // Update the congestion state.  We react slightly differently
     // depending on if cm has been activated or not.
     int src = send_event->getSrc();
@@ -74,7 +74,9 @@ public:
         {"enable_congestion_management", "Turn on congestion management","false"},
         {"cm_outstanding_threshold", "Threshold for the amount of data outstanding to a host before congestion management can trigger","2*output_buf_size"},
         {"cm_pktsize_threshold", "Minimum size of a packet to be considered part of a stream with regards to congestion management","128B"},
-        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"}
+        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"},
+        {"network_model",      "Timing model used by the parent router: detailed or analytical.  See hr_router.","detailed"},
+        {"compact",            "Only create the self links used for adaptive link widths when dlink_thresh is set.  See hr_router.","false"}
     )
 
     // SST_ELI_DOCUMENT_STATISTICS(
@@ -100,6 +102,7 @@ private:
     // Self link for timing output.  This is how we manage bandwidth
     // usage
     Link* output_timing;
+    Link* bundle_timing;    // Host ports only.  Spaces out packets that arrive in a bundle
     TimeConverter* flit_cycle;
 
 	// Self link for dynamic link additions
@@ -296,14 +299,31 @@ private:
     int cm_pktsize_threshold;
     double cm_window_factor;
 
-    std::map<uint32_t,CongestionInfo> congestion_map;
-    std::priority_queue<CongestionInfo*, std::vector<CongestionInfo* >, congestion_info_expiration_pq_order> expiration_queue;
+    // Only allocated for host ports with congestion management
+    // turned on
+    struct CongestionState {
+        std::map<uint32_t,CongestionInfo> congestion_map;
+        std::priority_queue<CongestionInfo*, std::vector<CongestionInfo* >, congestion_info_expiration_pq_order> expiration_queue;
+    };
+    CongestionState* cm_state;
     int current_incast;
     int total_flits_incoming;
     int total_incast_flits;
     int congestion_events;
     int congestion_count_at_last_throttle;
 
+    // Analytical network model.  Packets are forwarded as soon as
+    // they arrive and the output link is modeled as a reservation
+    // calendar: output_free_time is the time (in core time base) at
+    // which everything reserved so far has finished transmitting.
+    // Adaptive routing sees an idle network.  Only ejection is flow
+    // controlled: host ports hold packets in output_buf until the
+    // endpoint returns credits.
+    bool analytical;
+    TimeConverter* core_tc;
+    SimTime_t output_latency_ticks;
+    SimTime_t output_free_time;
+
 public:
 
     void recvCtrlEvent(CtrlRtrEvent* ev);
@@ -321,6 +341,7 @@ public:
     	return vc_heads;
     }
     virtual void reportIncomingEvent(internal_router_event* ev);
+    SimTime_t sendAnalytical(internal_router_event* ev);
 
     // time_base is a frequency which represents the bandwidth of the link in flits/second.
     PortControl(ComponentId_t cid, Params& params, Router* rif, int rtr_id, int port_number, Topology *topo);
@@ -352,7 +373,9 @@ private:
     void dumpQueueState(port_queue_t& q, Output& out);
 
     void handle_input_n2r(Event* ev);
+    void handle_bundle(Event* ev);
     void handle_input_r2r(Event* ev);
+    void acceptHostPacket(RtrEvent* event);
     void handle_output(Event* ev);
     void handle_failed(Event* ev);
     void handleSAIWindow(Event* ev);
@@ -360,6 +383,11 @@ private:
 
 	uint64_t increaseActive();
 
+    void forwardAnalytical(internal_router_event* ev);
+    SimTime_t reserveOutput(int flits);
+    SimTime_t transmitAnalytical(internal_router_event* ev);
+    void drainAnalytical();
+
     void updateCongestionState(internal_router_event* send_event);
 };
 
@@ -25,6 +25,7 @@
 #include "bridge.h"
 
 #include "hr_router/xbar_arb_rr.h"
+#include "hr_router/xbar_arb_sparse.h"
 #include "hr_router/xbar_arb_lru.h"
 #include "hr_router/xbar_arb_age.h"
 #include "hr_router/xbar_arb_rand.h"
@@ -79,6 +79,7 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
         if_params.insert("link_bw",params.find<std::string>("link_bw"));
         if_params.insert("input_buf_size",params.find<std::string>("buffer_size"));
         if_params.insert("output_buf_size",params.find<std::string>("buffer_size"));
+        if_params.insert("bundle_packets",params.find<std::string>("bundle_packets","1"));
         if_params.insert("port_name","rtr");
 
         link_if = loadAnonymousSubComponent<SST::Interfaces::SimpleNetwork>
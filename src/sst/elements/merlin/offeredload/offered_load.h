@@ -129,6 +129,7 @@ public:
         {"link_bw",          "Bandwidth of the router link specified in either b/s or B/s (can include SI prefix)."},
         {"linkcontrol",      "SimpleNetwork object to use as interface to network.","merlin.linkcontrol"},
         {"buffer_size",      "Size of input and output buffers.","1kB"},
+        {"bundle_packets",   "Maximum number of packets the default LinkControl sends to the router in one event.  See merlin.linkcontrol.","1"},
         {"packet_size",      "Packet size specified in either b or B (can include SI prefix).","32B"},
         {"pattern",          "Traffic pattern to use.","merlin.targetgen.uniform"},
         {"offered_load",     "Load to be offered to network.  Valid range: 0 < offered_load <= 1.0."},
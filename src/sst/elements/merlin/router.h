@@ -27,7 +27,11 @@
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <queue>
+#include <vector>
 
 namespace SST {
 namespace Merlin {
@@ -52,12 +56,29 @@ protected:
 
     int vcs_with_data;
 
+    // Bitmasks of the input VCs that have a packet at the head of
+    // their buffer (vc_mask_words words per port) and of the ports
+    // that have any such VC.  The ports keep these current as heads
+    // come and go so arbitration can visit only VCs with work.  The
+    // updates run on every head arrival and drain whichever arbiter is
+    // in use; only merlin.xbar_arb_sparse reads the masks.
+    std::vector<uint64_t> active_vc_mask;
+    std::vector<uint64_t> active_port_mask;
+    int vc_mask_words;
+
+    inline void initActiveVCs(int num_ports, int num_vcs) {
+        vc_mask_words = (num_vcs + 63) / 64;
+        active_vc_mask.assign(num_ports * vc_mask_words, 0);
+        active_port_mask.assign((num_ports + 63) / 64, 0);
+    }
+
 public:
 
     Router(ComponentId_t id) :
         Component(id),
         requestNotifyOnEvent(false),
-        vcs_with_data(0)
+        vcs_with_data(0),
+        vc_mask_words(0)
     {}
 
     virtual ~Router() {}
@@ -70,12 +91,32 @@ public:
     inline void dec_vcs_with_data() { vcs_with_data--; }
     inline int get_vcs_with_data() { return vcs_with_data; }
 
+    inline void markVCActive(int port, int vc) {
+        active_vc_mask[port * vc_mask_words + (vc >> 6)] |= (uint64_t)1 << (vc & 63);
+        active_port_mask[port >> 6] |= (uint64_t)1 << (port & 63);
+    }
+    inline void markVCIdle(int port, int vc) {
+        uint64_t* mask = &active_vc_mask[port * vc_mask_words];
+        mask[vc >> 6] &= ~((uint64_t)1 << (vc & 63));
+        for ( int i = 0; i < vc_mask_words; i++ ) {
+            if ( mask[i] ) return;
+        }
+        active_port_mask[port >> 6] &= ~((uint64_t)1 << (port & 63));
+    }
+    inline const uint64_t* getActiveVCMask() const { return active_vc_mask.data(); }
+    inline const uint64_t* getActivePortMask() const { return active_port_mask.data(); }
+
     virtual int const* getOutputBufferCredits() = 0;
     virtual void sendCtrlEvent(CtrlRtrEvent* ev, int port = -1) = 0;
     virtual void recvCtrlEvent(int port, CtrlRtrEvent* ev) = 0;
 
     virtual void reportIncomingEvent(internal_router_event* ev) = 0;
 
+    // Used by routers running the analytical network model.  Hands
+    // the routed packet to its output port and returns how long (in
+    // core time base) until the packet starts to leave the router.
+    virtual SimTime_t forwardPacket(internal_router_event* ev) { return 0; }
+
 };
 
 #define MERLIN_ENABLE_TRACE
@@ -84,7 +125,7 @@ public:
 class BaseRtrEvent : public Event {
 
 public:
-    enum RtrEventType {CREDIT, PACKET, INTERNAL, INITIALIZATION, CTRL};
+    enum RtrEventType {CREDIT, PACKET, INTERNAL, INITIALIZATION, CTRL, BUNDLE};
 
     inline RtrEventType getType() const { return type; }
 
@@ -190,6 +231,73 @@ private:
 };
 
 
+// Several packets sent from an endpoint to its router as one event.
+// LinkControl packs packets queued on the same VN together (see its
+// bundle_packets parameter) and PortControl hands them to the router
+// one at a time, each when it would have arrived if sent on its own,
+// so bundles are only seen on endpoint to router links.
+class RtrBundleEvent : public BaseRtrEvent {
+
+public:
+
+    RtrBundleEvent() :
+        BaseRtrEvent(BaseRtrEvent::BUNDLE),
+        size_in_flits(0),
+        head(0)
+    {}
+
+    ~RtrBundleEvent()
+    {
+        for ( size_t i = head; i < events.size(); i++ ) delete events[i];
+    }
+
+    // A packet's flit offset is the number of flits ahead of it in
+    // the bundle, i.e., how long after the first packet it would have
+    // been sent on its own
+    inline void addEvent(RtrEvent* ev) {
+        events.push_back(ev);
+        flit_offsets.push_back(size_in_flits);
+        size_in_flits += ev->getSizeInFlits();
+    }
+
+    inline const std::vector<RtrEvent*>& getEvents() const { return events; }
+    inline int getFlitOffset(size_t index) const { return flit_offsets[index]; }
+    inline int getSizeInFlits() const { return size_in_flits; }
+
+    // Packets are handed over to the caller in order
+    inline bool empty() const { return head == events.size(); }
+    inline int nextFlitOffset() const { return flit_offsets[head]; }
+    RtrEvent* takeNext() {
+        RtrEvent* ev = events[head];
+        events[head++] = nullptr;
+        return ev;
+    }
+
+    virtual void print(const std::string& header, Output &out) const  override {
+        out.output("%s RtrBundleEvent to be delivered at %" PRI_SIMTIME " with priority %d. %zu packets, %d flits\n",
+                   header.c_str(), getDeliveryTime(), getPriority(), events.size() - head, size_in_flits);
+        for ( size_t i = head; i < events.size(); i++ ) events[i]->print(header + "  ", out);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        BaseRtrEvent::serialize_order(ser);
+        ser & events;
+        ser & flit_offsets;
+        ser & size_in_flits;
+        ser & head;
+    }
+
+private:
+    std::vector<RtrEvent*> events;
+    std::vector<int> flit_offsets;
+    int size_in_flits;
+    size_t head;
+
+    ImplementSerializable(SST::Merlin::RtrBundleEvent)
+
+};
+
+
 class CtrlRtrEvent : public BaseRtrEvent {
 
 public:
@@ -554,6 +662,78 @@ protected:
 };
 
 
+// Storage for the port queues (used through std::queue).  A
+// std::deque allocates a block as soon as it is constructed, which
+// adds up to several kB per port with one input and one output queue
+// per VC.  This allocates nothing until the first push, so VCs that
+// never see traffic cost only the size of the object.  The capacity
+// doubles as needed and is kept until the queue is destroyed.
+template <typename T>
+class ring_buffer {
+public:
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+
+    ring_buffer() : buf(NULL), cap(0), head(0), count(0) {}
+
+    ring_buffer(const ring_buffer& other) : buf(NULL), cap(0), head(0), count(0) {
+        for ( size_type i = 0; i < other.count; i++ ) push_back(other.at(i));
+    }
+
+    ~ring_buffer() { delete [] buf; }
+
+    ring_buffer& operator=(const ring_buffer& other) {
+        if ( this != &other ) {
+            clear();
+            for ( size_type i = 0; i < other.count; i++ ) push_back(other.at(i));
+        }
+        return *this;
+    }
+
+    bool empty() const { return count == 0; }
+    size_type size() const { return count; }
+
+    reference front() { return buf[head]; }
+    const_reference front() const { return buf[head]; }
+    reference back() { return buf[(head + count - 1) & (cap - 1)]; }
+    const_reference back() const { return buf[(head + count - 1) & (cap - 1)]; }
+
+    void push_back(const T& value) {
+        if ( count == cap ) grow();
+        buf[(head + count) & (cap - 1)] = value;
+        count++;
+    }
+
+    void pop_front() {
+        head = (head + 1) & (cap - 1);
+        count--;
+    }
+
+    void clear() { head = 0; count = 0; }
+
+private:
+    T* buf;
+    // Capacity is always zero or a power of two
+    uint32_t cap;
+    uint32_t head;
+    uint32_t count;
+
+    const T& at(size_type i) const { return buf[(head + i) & (cap - 1)]; }
+
+    void grow() {
+        uint32_t new_cap = cap == 0 ? 4 : cap * 2;
+        T* new_buf = new T[new_cap];
+        for ( uint32_t i = 0; i < count; i++ ) new_buf[i] = at(i);
+        delete [] buf;
+        buf = new_buf;
+        cap = new_cap;
+        head = 0;
+    }
+};
+
+
 // Class to manage link between NIC and router.  A single NIC can have
 // more than one link_control (and thus link to router).
 class PortInterface : public SubComponent{
@@ -563,8 +743,8 @@ public:
     // params are: parent router, router id, port number, topology object
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::Merlin::PortInterface, Router*, int, int, Topology*)
 
-    typedef std::queue<internal_router_event*> port_queue_t;
-    typedef std::queue<CtrlRtrEvent*> ctrl_queue_t;
+    typedef std::queue<internal_router_event*, ring_buffer<internal_router_event*> > port_queue_t;
+    typedef std::queue<CtrlRtrEvent*, ring_buffer<CtrlRtrEvent*> > ctrl_queue_t;
 
     virtual void recvCtrlEvent(CtrlRtrEvent* ev) = 0;
     virtual void sendCtrlEvent(CtrlRtrEvent* ev) = 0;
@@ -581,6 +761,13 @@ public:
 
     virtual void reportIncomingEvent(internal_router_event* ev) = 0;
 
+    // Analytical network model only.  Reserves the output link for
+    // the packet after everything already reserved on it and sends
+    // the packet on.  Returns the delay (in core time base) before the
+    // packet starts transmitting.  A host port without credits from
+    // its endpoint holds the packet until they arrive and returns 0.
+    virtual SimTime_t sendAnalytical(internal_router_event* ev) { return 0; }
+
 
     // time_base is a frequency which represents the bandwidth of the link in flits/second.
     PortInterface(ComponentId_t cid) :
@@ -643,6 +830,10 @@ public:
     virtual void arbitrate(PortInterface** ports, int* port_busy, int* out_port_busy, int* progress_vc) = 0;
 #endif
     virtual void setPorts(int num_ports, int num_vcs) = 0;
+    // Called after setPorts() with the router's active VC and port
+    // bitmasks (see Router).  Arbiters that don't use them can ignore
+    // this.
+    virtual void setActiveMasks(const uint64_t* vc_mask, const uint64_t* port_mask) {}
     virtual bool isOkayToPauseClock() { return true; }
     virtual void reportSkippedCycles(Cycle_t cycles) {};
     virtual void dumpState(std::ostream& stream) {};
@@ -0,0 +1,133 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "sst/elements/merlin/test/route_test/route_bench.h"
+
+#include <chrono>
+
+#include <sst/core/params.h>
+#include <sst/core/rng/xorshift.h>
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+using namespace SST::Interfaces;
+
+namespace Merlin {
+
+
+route_bench::route_bench(ComponentId_t cid, Params& params) :
+    Component(cid)
+{
+    out.init(getName() + ": ", 0, 0, Output::STDOUT);
+
+    id = params.find<int>("id", 0);
+    num_ports = params.find<int>("num_ports", -1);
+    if ( num_ports <= 0 ) {
+        out.fatal(CALL_INFO, -1, "route_bench: num_ports must be specified\n");
+    }
+    num_vns = params.find<int>("num_vns", 1);
+    num_endpoints = params.find<int>("num_endpoints", -1);
+    if ( num_endpoints <= 0 ) {
+        out.fatal(CALL_INFO, -1, "route_bench: num_endpoints must be specified\n");
+    }
+    packets = params.find<int>("packets", 4096);
+    batches = params.find<int>("batches", 100);
+    buffer_size = params.find<int>("buffer_size", 32);
+    label = params.find<std::string>("label", getName());
+
+    rng = new RNG::XORShiftRNG(params.find<uint32_t>("seed", 1));
+
+    topo = loadUserSubComponent<SST::Merlin::Topology>
+        ("topology", ComponentInfo::SHARE_NONE, num_ports, id, num_vns);
+    if ( !topo ) {
+        out.fatal(CALL_INFO, -1, "route_bench requires topology to be specified in input file\n");
+    }
+
+    std::vector<int> vcs_per_vn(num_vns);
+    topo->getVCsPerVN(vcs_per_vn);
+    num_vcs = 0;
+    for ( int vcs : vcs_per_vn ) num_vcs += vcs;
+
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( topo->getPortState(i) == Topology::R2N ) host_ports.push_back(i);
+    }
+    if ( host_ports.empty() ) {
+        out.fatal(CALL_INFO, -1, "route_bench: router %d has no endpoint ports\n", id);
+    }
+
+    // Topologies take their adaptive thresholds from the credit
+    // array, so it starts out full
+    credits.assign(num_ports * num_vcs, buffer_size);
+    queue_lengths.assign(num_ports * num_vcs, 0);
+    topo->setOutputBufferCreditArray(credits.data(), num_vcs);
+    topo->setOutputQueueLengthsArray(queue_lengths.data(), num_vcs);
+}
+
+
+route_bench::~route_bench()
+{
+    delete topo;
+    delete rng;
+}
+
+
+void route_bench::randomizeLoad()
+{
+    for ( size_t i = 0; i < queue_lengths.size(); i++ ) {
+        queue_lengths[i] = rng->generateNextUInt32() % (buffer_size + 1);
+        credits[i] = buffer_size - queue_lengths[i];
+    }
+}
+
+
+void route_bench::setup()
+{
+    std::vector<internal_router_event*> events(packets);
+    std::vector<int> ports(packets);
+    std::chrono::duration<double> elapsed(0);
+
+    // Batch -1 is a warm up and isn't timed.  Topologies that build
+    // their route tables on first use do it there.
+    for ( int batch = -1; batch < batches; batch++ ) {
+        randomizeLoad();
+        for ( int i = 0; i < packets; i++ ) {
+            ports[i] = host_ports[rng->generateNextUInt32() % host_ports.size()];
+            int src = topo->getEndpointID(ports[i]);
+            int dest = rng->generateNextUInt32() % num_endpoints;
+            SimpleNetwork::Request* req = new SimpleNetwork::Request(dest, src, 64, true, true);
+            events[i] = topo->process_input(new RtrEvent(req, src, rng->generateNextUInt32() % num_vns));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < packets; i++ ) {
+            topo->route_packet(ports[i], events[i]->getVC(), events[i]);
+        }
+        auto end = std::chrono::steady_clock::now();
+        if ( batch >= 0 ) elapsed += end - start;
+
+        for ( int i = 0; i < packets; i++ ) delete events[i];
+    }
+
+    uint64_t routes = (uint64_t)packets * batches;
+    out.output("%s: %" PRIu64 " routes in %.6f s, %.4g routes/s\n", label.c_str(), routes,
+               elapsed.count(), elapsed.count() > 0 ? routes / elapsed.count() : 0.0);
+}
+
+
+} // namespace Merlin
+} // namespace SST
@@ -0,0 +1,99 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TEST_ROUTE_BENCH_H
+#define COMPONENTS_MERLIN_TEST_ROUTE_BENCH_H
+
+#include <sst/core/component.h>
+#include <sst/core/output.h>
+#include <sst/core/rng/rng.h>
+
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+class Topology;
+
+// Measures how fast a topology routes packets.  The component loads a
+// topology object as if it were router id, with no links attached,
+// and in setup() routes batches of packets from its endpoint ports to
+// random destinations, timing only the calls to route_packet().
+// Output queue lengths and credits are randomized between batches so
+// adaptive algorithms see varying load.
+class route_bench : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        route_bench,
+        "merlin",
+        "route_bench",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Routing microbenchmark.  Reports routes per second for a topology.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",            "Router ID to route as.", "0"},
+        {"num_ports",     "Number of ports on the router."},
+        {"num_vns",       "Number of VNs.", "1"},
+        {"num_endpoints", "Total number of endpoints in the network.  Destinations are chosen uniformly from all of them."},
+        {"packets",       "Number of packets routed per batch.", "4096"},
+        {"batches",       "Number of timed batches.", "100"},
+        {"buffer_size",   "Output buffer credits per VC.  Queue lengths are drawn from [0, buffer_size].", "32"},
+        {"seed",          "Seed for the random number generator.", "1"},
+        {"label",         "Name printed with the results.  Defaults to the component name.", ""}
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"topology", "Topology object to benchmark", "SST::Merlin::Topology" }
+    )
+
+private:
+    Output out;
+
+    int id;
+    int num_ports;
+    int num_vns;
+    int num_vcs;
+    int num_endpoints;
+    int packets;
+    int batches;
+    int buffer_size;
+    std::string label;
+
+    Topology* topo;
+    RNG::Random* rng;
+
+    std::vector<int> credits;
+    std::vector<int> queue_lengths;
+    std::vector<int> host_ports;
+
+    void randomizeLoad();
+
+public:
+    route_bench(ComponentId_t cid, Params& params);
+    ~route_bench();
+
+    void setup();
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TEST_ROUTE_BENCH_H
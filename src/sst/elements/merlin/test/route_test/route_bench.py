@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Routing microbenchmark.  Creates a merlin.route_bench component for
+# each topology and routing algorithm, once computing routes per packet
+# and once with precompute_routes, and prints routes per second for
+# each.  polarfly and polarstar read their graphs from the current
+# directory, so they are generated there first.
+#
+# Usage: sst route_bench.py [--model-options="--packets=N --batches=N --only=topology"]
+
+import sys
+import sst
+from sst.merlin.topology import *
+
+packets = 4096
+batches = 100
+only = None
+for arg in sys.argv[1:]:
+    if arg.startswith("--packets="):
+        packets = int(arg.split("=",1)[1])
+    elif arg.startswith("--batches="):
+        batches = int(arg.split("=",1)[1])
+    elif arg.startswith("--only="):
+        only = arg.split("=",1)[1]
+
+
+def bench(name, topology, num_ports, num_endpoints, params, algorithms, algorithm_param = "algorithm"):
+    if only is not None and only != topology:
+        return
+    for algorithm in algorithms:
+        for precompute in [False, True]:
+            label = "%s %s%s" % (topology, algorithm, " (precomputed)" if precompute else "")
+            comp = sst.Component("bench_%s_%s_%d" % (name, algorithm, precompute), "merlin.route_bench")
+            comp.addParams({
+                "id" : 0,
+                "num_ports" : num_ports,
+                "num_endpoints" : num_endpoints,
+                "packets" : packets,
+                "batches" : batches,
+                "label" : label
+            })
+            topo = comp.setSubComponent("topology", "merlin." + topology)
+            topo.addParams(params)
+            topo.addParams({
+                algorithm_param : algorithm,
+                "precompute_routes" : precompute
+            })
+
+
+# Dragonfly: 33 groups of 8 routers, 4 hosts per router and one link
+# between each pair of groups.  Router 0 writes the global link map
+# that all the dragonfly components share, so every configuration has
+# to use the same shape.
+hosts_per_router = 4
+routers_per_group = 8
+num_groups = 33
+intergroup_links = 1
+intergroup_per_router = ((num_groups - 1) * intergroup_links + routers_per_group - 1) // routers_per_group
+global_link_map = [i for i in range(intergroup_per_router * routers_per_group)]
+bench("dragonfly", "dragonfly",
+      hosts_per_router + (routers_per_group - 1) + intergroup_per_router,
+      hosts_per_router * routers_per_group * num_groups,
+      { "hosts_per_router" : hosts_per_router,
+        "routers_per_group" : routers_per_group,
+        "intergroup_per_router" : intergroup_per_router,
+        "intergroup_links" : intergroup_links,
+        "num_groups" : num_groups,
+        "global_link_map" : global_link_map },
+      [ "minimal", "adaptive-local", "ugal", "min-a" ])
+
+# HyperX: 8x8x8 routers with 4 hosts each
+bench("hyperx", "hyperx", 3 * 7 + 4, 8 * 8 * 8 * 4,
+      { "shape" : "8x8x8",
+        "width" : "1x1x1",
+        "local_ports" : 4 },
+      [ "DOR", "DOR-ND", "MIN-A" ])
+
+# Fattree: 512 hosts, 16 down and 16 up ports on the edge routers.
+# There is no route table for fattree, so the precomputed runs are
+# the same as the others.
+bench("fattree", "fattree", 32, 512,
+      { "shape" : "16,16:32" },
+      [ "deterministic", "adaptive" ], algorithm_param = "routing_alg")
+
+# PolarFly: q = 7, 57 routers
+if only is None or only == "polarfly":
+    pf = topoPolarFly(q=7)
+    pf.generate(save=True)
+    bench("polarfly", "polarfly", pf.total_radix, pf.total_endnodes,
+          { "q" : pf.q,
+            "hosts_per_router" : pf.hosts_per_router,
+            "network_radix" : pf.network_radix,
+            "total_radix" : pf.total_radix,
+            "total_routers" : pf.total_routers,
+            "total_endnodes" : pf.total_endnodes },
+          [ "MINIMAL", "UGAL", "UGAL_PF" ])
+
+# PolarStar: degree 8
+if only is None or only == "polarstar":
+    ps = topoPolarStar(d=8)
+    ps.generate(save=True)
+    bench("polarstar", "polarstar", ps.total_radix, ps.total_endnodes,
+          { "d" : ps.d,
+            "sn_type" : ps.sn_type,
+            "pfq" : ps.pfq,
+            "snq" : ps.snq,
+            "hosts_per_router" : ps.hosts_per_router,
+            "network_radix" : ps.network_radix,
+            "total_radix" : ps.total_radix,
+            "total_routers" : ps.total_routers,
+            "total_endnodes" : ps.total_endnodes },
+          [ "MINIMAL", "UGAL" ])
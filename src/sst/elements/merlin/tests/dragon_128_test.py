@@ -11,6 +11,7 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import sys
 import sst
 from sst.merlin.base import *
 from sst.merlin.endpoint import *
@@ -19,6 +20,17 @@ from sst.merlin.topology import *
 
 if __name__ == "__main__":
 
+    # Use --model-options="--network-model=analytical" to run with the
+    # analytical network model and --xbar-arb=<arbiter> to change the
+    # crossbar arbiter
+    network_model = "detailed"
+    xbar_arb = "merlin.xbar_arb_lru"
+    for arg in sys.argv[1:]:
+        if arg.startswith("--network-model="):
+            network_model = arg.split("=",1)[1]
+        elif arg.startswith("--xbar-arb="):
+            xbar_arb = arg.split("=",1)[1]
+
 
     ### Setup the topology
     topo = topoDragonFly()
@@ -40,7 +52,8 @@ if __name__ == "__main__":
     router.input_buf_size = "4kB"
     router.output_buf_size = "4kB"
     router.num_vns = 2
-    router.xbar_arb = "merlin.xbar_arb_lru"
+    router.xbar_arb = xbar_arb
+    router.network_model = network_model
 
     topo.router = router
     topo.link_latency = "20ns"
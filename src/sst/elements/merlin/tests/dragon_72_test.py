@@ -11,11 +11,19 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import sys
 import sst
 from sst.merlin import *
 
 if __name__ == "__main__":
 
+    # Use --model-options="--network-model=analytical" to run with the
+    # analytical network model
+    network_model = "detailed"
+    for arg in sys.argv[1:]:
+        if arg.startswith("--network-model="):
+            network_model = arg.split("=",1)[1]
+
     topo = topoDragonFly()
     endPoint = TestEndPoint()
 
@@ -47,6 +55,7 @@ if __name__ == "__main__":
 
     #sst.merlin._params["checkerboard"] = "1"
     sst.merlin._params["xbar_arb"] = "merlin.xbar_arb_lru"
+    sst.merlin._params["network_model"] = network_model
 
     topo.prepParams()
     endPoint.prepParams()
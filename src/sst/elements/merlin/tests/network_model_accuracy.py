@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Compares hr_router's analytical network model against the detailed
+# model on the dragonfly and fattree tests.  Each test is run once per
+# model and, for every NIC, the time it finished sending (limited by
+# injection bandwidth and back pressure) and the time it received all
+# of its packets (latency and delivered bandwidth) are compared.
+#
+# Usage: network_model_accuracy.py [--sst sst] [test ...]
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+TESTS = ["dragon_128_test", "dragon_72_test", "fattree_128_test", "fattree_256_test"]
+
+SENT_RE = re.compile(r"^(\d+):\s+(\d+) Finished sending packets")
+RECV_RE = re.compile(r"^(\d+): NIC (\d+) received all packets")
+SIMTIME_RE = re.compile(r"simulated time: ([0-9.]+) (\w+)")
+UNITS = {"ps": 1e-3, "ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def run(sst, test, model):
+    """Returns (per-NIC send times, per-NIC receive times, simulated ns, wall-clock seconds)"""
+    sdl = os.path.join(os.path.dirname(os.path.abspath(__file__)), test + ".py")
+    start = time.time()
+    result = subprocess.run([sst, "--model-options=--network-model=" + model, sdl],
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    wall = time.time() - start
+    if result.returncode != 0:
+        sys.exit("%s (%s) failed:\n%s" % (test, model, result.stdout))
+
+    sent = {}
+    recv = {}
+    simtime = 0.0
+    # The test NICs run at 1GHz, so cycles are ns
+    for line in result.stdout.splitlines():
+        m = SENT_RE.match(line)
+        if m:
+            sent[int(m.group(2))] = int(m.group(1))
+            continue
+        m = RECV_RE.match(line)
+        if m:
+            recv[int(m.group(2))] = int(m.group(1))
+            continue
+        m = SIMTIME_RE.search(line)
+        if m:
+            simtime = float(m.group(1)) * UNITS.get(m.group(2), 1.0)
+    return sent, recv, simtime, wall
+
+
+def error(detailed, analytical):
+    """Mean and max relative error (in percent) over the NICs present in both runs"""
+    errors = [abs(analytical[n] - detailed[n]) / float(detailed[n]) * 100.0
+              for n in detailed if n in analytical and detailed[n] != 0]
+    if not errors:
+        return 0.0, 0.0
+    return sum(errors) / len(errors), max(errors)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Accuracy of the analytical network model against the detailed model")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("tests", nargs="*", default=TESTS, help="tests to run (default: %s)" % " ".join(TESTS))
+    args = parser.parse_args()
+
+    print("%-18s %-20s %-20s %10s %9s" % ("test", "send err mean/max", "recv err mean/max", "simtime", "speedup"))
+    for test in args.tests:
+        d_sent, d_recv, d_simtime, d_wall = run(args.sst, test, "detailed")
+        a_sent, a_recv, a_simtime, a_wall = run(args.sst, test, "analytical")
+        send_mean, send_max = error(d_sent, a_sent)
+        recv_mean, recv_max = error(d_recv, a_recv)
+        simtime_err = (a_simtime - d_simtime) / d_simtime * 100.0 if d_simtime else 0.0
+        print("%-18s %8.2f%% / %6.2f%% %8.2f%% / %6.2f%% %+9.2f%% %8.2fx" %
+              (test, send_mean, send_max, recv_mean, recv_max, simtime_err, d_wall / a_wall if a_wall else 0.0))
+
+
+if __name__ == "__main__":
+    main()
@@ -2,6 +2,7 @@
 
 from sst_unittest import *
 from sst_unittest_support import *
+import re
 
 try:
     from sympy.polys.domains import ZZ
@@ -95,6 +96,36 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_polarstar_504(self):
         self.merlin_test_template("polarstar_504_test")
 
+    def test_merlin_dragon_128_analytical(self):
+        # Timing differs from the detailed model, so only check that every NIC
+        # sent and received all of its packets
+        outfile = self.merlin_options_template("dragon_128_test", "analytical", "--network-model=analytical")
+        self.check_nic_counts(outfile, 128, 64)
+
+    def test_merlin_dragon_128_xbar_arb_sparse(self):
+        # The sparse arbiter grants in a different order than xbar_arb_lru,
+        # so only check that every NIC sent and received all of its packets
+        outfile = self.merlin_options_template("dragon_128_test", "xbar_arb_sparse", "--xbar-arb=merlin.xbar_arb_sparse")
+        self.check_nic_counts(outfile, 128, 64)
+
+    def test_merlin_torus_16_offered_load_bundle(self):
+        # Bundled packets are spaced out again at the router, but event
+        # ordering can still differ from unbundled runs.  Check that every
+        # packet sent was received.
+        outfile = self.merlin_options_template("torus_16_offered_load", "bundle", "--bundle-packets=4")
+        sent = 0
+        recv = 0
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                m = re.match(r"^ offered_load_\d+\S*\.(send_bit_count|packet_latency)\S* : Accumulator : Sum\.u64 = \d+; SumSQ\.u64 = \d+; Count\.u64 = (\d+);", line)
+                if m:
+                    if m.group(1) == "send_bit_count":
+                        sent += int(m.group(2))
+                    else:
+                        recv += int(m.group(2))
+        self.assertTrue(sent > 0, "{0}: no packets were sent".format(outfile))
+        self.assertEqual(recv, sent, "{0}: {1} packets received, {2} sent".format(outfile, recv, sent))
+
 
 #####
 
@@ -132,3 +163,47 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    # Runs testcase with model_options and returns the output file.  Used
+    # for variants whose timing has no reference file of its own.
+    def merlin_options_template(self, testcase, variant, model_options, cwd=False):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_merlin_{0}_{1}".format(testcase, variant)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = '--model-options="{0}"'.format(model_options)
+        if cwd:
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path, other_args=otherargs)
+        else:
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, other_args=otherargs)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+        return outfile
+
+    # Checks merlin.test_nic output: num_nics NICs finished sending and
+    # received one message from each of their num_peers peers for every
+    # message they sent.  NIC ids are per job, so lines are counted
+    # rather than matched by id.
+    def check_nic_counts(self, outfile, num_nics, num_peers):
+        sent = []
+        recv = []
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                m = re.match(r"^\d+:\s+\d+ Finished sending packets \(total of (\d+)\)", line)
+                if m:
+                    sent.append(int(m.group(1)) * num_peers)
+                    continue
+                m = re.match(r"^\d+: NIC \d+ received all packets \(total of (\d+)\)", line)
+                if m:
+                    recv.append(int(m.group(1)))
+
+        self.assertEqual(len(sent), num_nics, "{0}: {1} of {2} NICs finished sending".format(outfile, len(sent), num_nics))
+        self.assertEqual(len(recv), num_nics, "{0}: {1} of {2} NICs received all packets".format(outfile, len(recv), num_nics))
+        self.assertEqual(sum(recv), sum(sent), "{0}: {1} packets received, {2} expected".format(outfile, sum(recv), sum(sent)))
@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sys
+import sst
+from sst.merlin import *
+
+if __name__ == "__main__":
+
+    # Use --model-options="--bundle-packets=<n>" to let the endpoints'
+    # LinkControls send up to n packets to the router in one event
+    bundle_packets = 1
+    for arg in sys.argv[1:]:
+        if arg.startswith("--bundle-packets="):
+            bundle_packets = int(arg.split("=",1)[1])
+
+    topo = topoTorus()
+    endPoint = OfferedLoadEndPoint()
+
+
+    sst.merlin._params["torus.shape"] = "4x4"
+    sst.merlin._params["torus.width"] = "1x1"
+    sst.merlin._params["torus.local_ports"] = "1"
+    sst.merlin._params["num_dims"] = "2"
+
+
+    sst.merlin._params["link_bw"] = "4GB/s"
+    sst.merlin._params["link_lat"] = "20ns"
+    sst.merlin._params["flit_size"] = "8B"
+    sst.merlin._params["xbar_bw"] = "4GB/s"
+    sst.merlin._params["input_latency"] = "20ns"
+    sst.merlin._params["output_latency"] = "20ns"
+    sst.merlin._params["input_buf_size"] = "4kB"
+    sst.merlin._params["output_buf_size"] = "4kB"
+    sst.merlin._params["xbar_arb"] = "merlin.xbar_arb_lru"
+
+    # Small packets at close to full load so they queue up in the
+    # LinkControl and can be bundled
+    sst.merlin._params["offered_load"] = "0.9"
+    sst.merlin._params["num_peers"] = "16"
+    sst.merlin._params["message_size"] = "16B"
+    sst.merlin._params["buffer_size"] = "1kB"
+    sst.merlin._params["pattern"] = "merlin.targetgen.uniform"
+    sst.merlin._params["warmup_time"] = "1us"
+    sst.merlin._params["collect_time"] = "5us"
+    sst.merlin._params["drain_time"] = "10us"
+    sst.merlin._params["bundle_packets"] = bundle_packets
+
+    # The LinkControl statistics count the packets each endpoint sent
+    # (send_bit_count) and received (packet_latency)
+    sst.setStatisticLoadLevel(1)
+    sst.setStatisticOutput("sst.statOutputConsole")
+    endPoint.enableAllStatistics("0ns")
+
+    topo.prepParams()
+    endPoint.prepParams()
+    topo.setEndPoint(endPoint)
+    topo.build()
@@ -269,6 +269,8 @@ topo_dragonfly::topo_dragonfly(ComponentId_t cid, Params &p, int num_ports, int
 
     bool config_failed_links = p.find<bool>("config_failed_links","false");
 
+    precompute_routes = p.find<bool>("precompute_routes","false");
+
     // Set up the RouteToGroup object
 
     if ( rtr_id == 0 ) {
@@ -859,6 +861,7 @@ void topo_dragonfly::route_adaptive_local(int port, int vc, internal_router_even
 }
 
 void topo_dragonfly::route_packet(int port, int vc, internal_router_event* ev) {
+    if ( precompute_routes && group_routes.empty() ) initRouteTable();
     int vn = ev->getVN();
     if ( vns[vn].algorithm == UGAL ) return route_ugal(port,vc,ev);
     if ( vns[vn].algorithm == MIN_A ) return route_mina(port,vc,ev);
@@ -935,6 +938,8 @@ topo_dragonfly::routeControlPacket(CtrlRtrEvent* ev)
 
     int dest_id = dest.addr;
 
+    if ( precompute_routes && group_routes.empty() ) initRouteTable();
+
     // Check to see if this event is for the current router. If so,
     // return -1/
     if ( dest.addr_is_router ) {
@@ -1123,6 +1128,11 @@ int32_t topo_dragonfly::router_to_group(uint32_t group)
 
 int32_t topo_dragonfly::hops_to_router(uint32_t group, uint32_t router, uint32_t slice)
 {
+    if ( !group_routes.empty() ) {
+        const GroupRoute& route = group_routes.get(group, slice * params.m);
+        return route.hops + (route.landing != router ? 1 : 0);
+    }
+
     int hops = 1;
     const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,slice);
     if ( pair.router != router_id ) hops++;
@@ -1134,6 +1144,8 @@ int32_t topo_dragonfly::hops_to_router(uint32_t group, uint32_t router, uint32_t
 /* returns local router port if group can't be reached from this router */
 int32_t topo_dragonfly::port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice)
 {
+    if ( !group_routes.empty() ) return group_routes.get(group, global_slice * params.m + local_slice).port;
+
     const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,global_slice);
     if ( group_to_global_port.isFailedPort(pair) ) {
         // printf("******** Skipping failed port ********\n");
@@ -1147,6 +1159,32 @@ int32_t topo_dragonfly::port_for_group(uint32_t group, uint32_t global_slice, ui
     }
 }
 
+void topo_dragonfly::initRouteTable()
+{
+    for ( uint32_t group = 0; group < params.g; group++ ) {
+        if ( group != group_id ) {
+            for ( uint32_t i = 0; i < params.n; i++ ) {
+                const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,i);
+                const RouterPortPair& landing = group_to_global_port.getRouterPortPairForGroup(group, group_id, i);
+                bool failed = group_to_global_port.isFailedPort(pair);
+                for ( uint32_t j = 0; j < params.m; j++ ) {
+                    GroupRoute route;
+                    if ( failed ) route.port = -1;
+                    else if ( pair.router == router_id ) route.port = pair.port;
+                    else route.port = port_for_router(pair.router, j);
+                    route.hops = (pair.router == router_id) ? 1 : 2;
+                    route.landing = landing.router;
+                    group_routes.add(route);
+                }
+            }
+        }
+        group_routes.next();
+    }
+    group_routes.finalize();
+
+    output.verbose(CALL_INFO, 1, 1, "%u:%u:  Route table uses %zu bytes\n", group_id, router_id, group_routes.bytes());
+}
+
 // Always ignore failed links during init
 int32_t topo_dragonfly::port_for_group_init(uint32_t group, uint32_t global_slice)
 {
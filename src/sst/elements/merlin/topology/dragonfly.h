@@ -27,6 +27,7 @@
 #include <sst/core/rng/rng.h>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/routeTable.h"
 
 
 
@@ -212,6 +213,7 @@ public:
         {"global_route_mode",     "Mode for intepreting global link map [absolute (default) | relative].","absolute"},
         {"config_failed_links",   "Controls whether or not failed links are considered","False"},
         {"failed_links",          "List of global links to mark as failed.  Only needs to be passed to router 0. Format is \"group1:group2:slice\"",""},
+        {"precompute_routes",     "Build a table of the routes to every other group the first time a packet is routed instead of looking them up in the global link map for each packet.","false"},
     )
 
     enum RouteAlgo {
@@ -244,6 +246,19 @@ public:
 
     global_route_mode_t global_route_mode;
 
+    // One route to a group over a given global and local slice
+    struct GroupRoute {
+        int32_t port;      // -1 if the global link is failed
+        uint16_t hops;     // hops to reach the other group
+        uint16_t landing;  // router the global link lands on in the other group
+    };
+
+    // Entry per group, candidate (global_slice * m + local_slice)
+    // within each entry.  Built on first use, since the global link
+    // map and failed links are not complete until after init.
+    bool precompute_routes;
+    RouteTable<GroupRoute> group_routes;
+
 public:
     struct dgnflyAddr {
         uint32_t group;
@@ -286,6 +301,7 @@ private:
     int32_t port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice);
     int32_t port_for_group_init(uint32_t group, uint32_t global_slice);
     int32_t hops_to_router(uint32_t group, uint32_t router, uint32_t slice);
+    void initRouteTable();
 
     inline bool is_port_endpoint(uint32_t port) const { return ( port < params.p ); }
     inline bool is_port_local_group(uint32_t port) const { return (port >= params.p && port < (params.p + params.a -1 )); }
@@ -137,6 +137,10 @@ topo_hyperx::topo_hyperx(ComponentId_t cid, Params& params, int num_ports, int r
         total_routers *= dim_size[i];
     }
 
+    if ( params.find<bool>("precompute_routes", false) ) {
+        initRouteTable();
+    }
+
     
     
 }
@@ -363,6 +367,30 @@ topo_hyperx::setOutputQueueLengthsArray(int const* array, int vcs)
 }
 
 
+void
+topo_hyperx::initRouteTable()
+{
+    int* loc = new int[dimensions];
+    for ( int rtr = 0; rtr < total_routers; ++rtr ) {
+        idToLocation(rtr, loc);
+        for ( int dim = 0; dim < dimensions; ++dim ) {
+            if ( loc[dim] == id_loc[dim] ) continue;
+            int offset = loc[dim] - ((loc[dim] > id_loc[dim]) ? 1 : 0);
+            offset = port_start[dim] + (offset * dim_width[dim]);
+            for ( int i = offset; i < offset + dim_width[dim]; ++i ) {
+                MinRoute route = { i, dim };
+                dest_routes.add(route);
+            }
+        }
+        dest_routes.next();
+    }
+    dest_routes.finalize();
+    delete[] loc;
+
+    output.verbose(CALL_INFO, 1, 1, "%d: Route table uses %zu bytes\n", router_id, dest_routes.bytes());
+}
+
+
 // Routing algorithms
 
 // This will return the first port for the correct next router.
@@ -387,9 +415,21 @@ topo_hyperx::routeDORBase(int* dest_loc) {
     return std::make_pair(-1,-1);
 }
 
+// Same as routeDORBase(ev->dest_loc), but looks the route up in the
+// route table if there is one.
+std::pair<int,int>
+topo_hyperx::routeDORDest(topo_hyperx_event* ev) {
+    if ( dest_routes.empty() ) return routeDORBase(ev->dest_loc);
+
+    int dest_router = get_dest_router(ev->getDest());
+    if ( dest_routes.size(dest_router) == 0 ) return std::make_pair(-1,-1);
+    const MinRoute& route = dest_routes.get(dest_router, 0);
+    return std::make_pair(route.dim,route.port);
+}
+
 void
 topo_hyperx::routeDOR(int port, int vc, topo_hyperx_event* ev) {
-    std::pair<int,int> next_port = routeDORBase(ev->dest_loc);
+    std::pair<int,int> next_port = routeDORDest(ev);
 
     if ( next_port.first == -1 ) {
         ev->setNextPort(get_dest_local_port(ev->getDest()));
@@ -405,7 +445,7 @@ topo_hyperx::routeDOR(int port, int vc, topo_hyperx_event* ev) {
 
 void
 topo_hyperx::routeDORND(int port, int vc, topo_hyperx_event* ev) {
-    std::pair<int,int> next_port = routeDORBase(ev->dest_loc);
+    std::pair<int,int> next_port = routeDORDest(ev);
 
     if ( next_port.first == -1 ) {
         ev->setNextPort(get_dest_local_port(ev->getDest()));
@@ -453,7 +493,7 @@ topo_hyperx::routeValiant(int port, int vc, topo_hyperx_event* ev) {
 
     // Made it to the valiant route (or the function has already
     // returned), so just route minimally to dest
-    std::pair<int,int> next_port = routeDORBase(ev->dest_loc);
+    std::pair<int,int> next_port = routeDORDest(ev);
     if ( next_port.first == -1 ) {
         ev->setNextPort(get_dest_local_port(ev->getDest()));
         ev->setVC(vc);
@@ -575,21 +615,35 @@ topo_hyperx::routeMINA(int port, int vc, topo_hyperx_event* ev) {
 
     int min_weight = 0x7fffffff;;
     int min_port = -1;
-    for ( int dim = 0; dim < dimensions; ++dim ) {
-        if ( ev->dest_loc[dim] == id_loc[dim] ) continue;
-
-        // Find the minimum weight, minimally-routed port
-        int offset = ev->dest_loc[dim] - ((ev->dest_loc[dim] > id_loc[dim]) ? 1 : 0);
-        offset = port_start[dim] + (offset * dim_width[dim]);
-
-        for ( int i = offset; i < offset + dim_width[dim]; ++i ) {
-            int weight = output_queue_lengths[(i * num_vcs) + vns[vn].start_vc + vc_in_vn + 1];
+    if ( !dest_routes.empty() ) {
+        // The table has the same ports in the same order as the loop
+        // below
+        int next_vc = vns[vn].start_vc + vc_in_vn + 1;
+        for ( const MinRoute* r = dest_routes.begin(dest_router); r != dest_routes.end(dest_router); ++r ) {
+            int weight = output_queue_lengths[(r->port * num_vcs) + next_vc];
             if ( weight < min_weight ) {
-                min_port = i;
+                min_port = r->port;
                 min_weight = weight;
             }
         }
     }
+    else {
+        for ( int dim = 0; dim < dimensions; ++dim ) {
+            if ( ev->dest_loc[dim] == id_loc[dim] ) continue;
+
+            // Find the minimum weight, minimally-routed port
+            int offset = ev->dest_loc[dim] - ((ev->dest_loc[dim] > id_loc[dim]) ? 1 : 0);
+            offset = port_start[dim] + (offset * dim_width[dim]);
+
+            for ( int i = offset; i < offset + dim_width[dim]; ++i ) {
+                int weight = output_queue_lengths[(i * num_vcs) + vns[vn].start_vc + vc_in_vn + 1];
+                if ( weight < min_weight ) {
+                    min_port = i;
+                    min_weight = weight;
+                }
+            }
+        }
+    }
     // Route on the minimally weighted port
     ev->setNextPort(min_port);
     ev->setVC(vns[vn].start_vc + vc_in_vn + 1);
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/routeTable.h"
 
 namespace SST {
 namespace Merlin {
@@ -170,7 +171,8 @@ public:
         {"width", "Number of links between routers in each dimension, specified in same manner as for shape.  "
                   "For example, 2x2x1 denotes 2 links in the x and y dimensions and one in the z dimension."},
         {"local_ports", "Number of endpoints attached to each router."},
-        {"algorithm", "Routing algorithm to use.", "DOR"}
+        {"algorithm", "Routing algorithm to use.", "DOR"},
+        {"precompute_routes", "Build a table of the minimal routes to every router at startup instead of computing them for each packet.", "false"}
     )
 
     enum RouteAlgo {
@@ -212,6 +214,16 @@ private:
 
     vn_info* vns;
 
+    struct MinRoute {
+        int port;
+        int dim;
+    };
+
+    // Entry per destination router holding every port on a minimal
+    // route, ordered by dimension.  Empty unless precompute_routes is
+    // set.
+    RouteTable<MinRoute> dest_routes;
+
 
 public:
     topo_hyperx(ComponentId_t cid, Params& p, int num_ports, int rtr_id, int num_vns);
@@ -244,7 +256,10 @@ private:
     int get_dest_router(int dest_id) const;
     int get_dest_local_port(int dest_id) const;
 
+    void initRouteTable();
+
     std::pair<int,int> routeDORBase(int* dest_loc);
+    std::pair<int,int> routeDORDest(topo_hyperx_event* ev);
     void routeDOR(int port, int vc, topo_hyperx_event* ev);
     void routeDORND(int port, int vc, topo_hyperx_event* ev);
     void routeMINA(int port, int vc, topo_hyperx_event* ev);
@@ -60,6 +60,10 @@ topo_polarfly::topo_polarfly(ComponentId_t cid, Params& params, int num_ports, i
      nodes and links to set the globals */
     initPolarGraph();
 
+    /* Keep all the minimal next hops before the graph is freed */
+    if (params.find<bool>("precompute_routes", false))
+        buildMinimalRoutes(polar, router_id, min_routes);
+
     /* Initialize the routing table*/
     initRouteTable();
 
@@ -94,6 +98,9 @@ topo_polarfly::setOutputQueueLengthsArray(int const* array, int vcs)
 
 bool topo_polarfly::isNeighbor(int node)
 {
+    if (!min_routes.empty())
+        return min_routes.getClass(node) == 1;
+
     for (int i=0; i<node_links; i++)
     {
         if (neighbor_list[i]==node)
@@ -501,6 +508,29 @@ int topo_polarfly::getRouterID(int endpoint) {
 }
 
 
+//Output port of the minimal route to a router. With precompute_routes, the least loaded of all the minimal next hops
+int topo_polarfly::getMinimalChannel(int dest_node, int vc){
+
+    if (min_routes.empty())
+        return route_table[dest_node] + hosts_per_router;
+
+    int min_channel = -1;
+    int min_queue   = std::numeric_limits<int>::max();
+    for (const int* link = min_routes.begin(dest_node); link != min_routes.end(dest_node); ++link)
+    {
+        int channel = *link + hosts_per_router;
+        int queue   = output_queue_lengths[channel*num_vcs + vc];
+        if (queue < min_queue)
+        {
+            min_queue   = queue;
+            min_channel = channel;
+        }
+    }
+    return min_channel;
+
+}
+
+
 int topo_polarfly::getDestLocalPort(int node){
 
     return (int) node % hosts_per_router ; 
@@ -535,7 +565,7 @@ void topo_polarfly::routeUgal(int port, int vc, internal_router_event* ev){
     else if (port < hosts_per_router)
     {
         //minpath details
-        int min_channel = route_table[dest_node] + hosts_per_router;
+        int min_channel = getMinimalChannel(dest_node, out_vc);
         int min_queue   = output_queue_lengths[min_channel*num_vcs + out_vc];
 
         //find valiant intermediate node
@@ -575,15 +605,15 @@ void topo_polarfly::routeUgal(int port, int vc, internal_router_event* ev){
     }
     else if ((tt_ev->valiant == router_id && tt_ev->non_minimal) || (!tt_ev->non_minimal))
     {
-        out_channel         = route_table[dest_node] + hosts_per_router;
         out_vc              = vc + 1;
+        out_channel         = getMinimalChannel(dest_node, out_vc);
         tt_ev->non_minimal  = false;
         assert(tt_ev->hop_count < 4);
     }
     else
     {
-        out_channel         = route_table[tt_ev->valiant] + hosts_per_router;
         out_vc              = vc + 1;
+        out_channel         = getMinimalChannel(tt_ev->valiant, out_vc);
         assert(tt_ev->hop_count < 3);
     }
 
@@ -621,7 +651,7 @@ void topo_polarfly::routeUgalpf(int port, int vc, internal_router_event* ev){
         bool adj_dst    = isNeighbor(dest_node);
 
         //minpath details
-        int min_channel = route_table[dest_node] + hosts_per_router;
+        int min_channel = getMinimalChannel(dest_node, out_vc);
         int min_queue   = output_queue_lengths[min_channel*num_vcs + out_vc];
 
         //find valiant intermediate node
@@ -666,15 +696,15 @@ void topo_polarfly::routeUgalpf(int port, int vc, internal_router_event* ev){
     }
     else if ((tt_ev->valiant == router_id && tt_ev->non_minimal) || (!tt_ev->non_minimal))
     {
-        out_channel         = route_table[dest_node] + hosts_per_router;
         out_vc              = vc + 1;
+        out_channel         = getMinimalChannel(dest_node, out_vc);
         tt_ev->non_minimal  = false;
         assert(tt_ev->hop_count < 4);
     }
     else
     {
-        out_channel         = route_table[tt_ev->valiant] + hosts_per_router;
         out_vc              = vc + 1;
+        out_channel         = getMinimalChannel(tt_ev->valiant, out_vc);
         assert(tt_ev->hop_count < 3);
     }
 
@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/routeTable.h"
 
 
 namespace SST {
@@ -122,6 +123,7 @@ public:
         {"total_radix", "Radix of the router."},
         {"total_routers", "Number of total routers in the network."},
         {"total_endnodes", "Number of total endpoints in the network."},
+        {"precompute_routes", "Also keep every minimal next hop to each router, not just the first, and let UGAL take the least loaded one.", "false"},
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -151,6 +153,7 @@ public:
     int node_links;
     std::vector<int> route_table; //output port for each destination
     std::vector<int> neighbor_list; //all neighbors of current router
+    RouteTable<int> min_routes; //all minimal next hops for each destination, class is the hop count
 
     int num_vns;
     int num_vcs;
@@ -209,6 +212,7 @@ private:
    void initRouteTable();
 
    int getRouterID(int endpoint);
+   int getMinimalChannel(int dest_node, int vc);
    int getDestLocalPort(int node);
    void dumpHopCount(topo_polarfly_event* ev);
 
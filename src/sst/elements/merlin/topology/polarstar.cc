@@ -68,6 +68,10 @@ topo_polarstar::topo_polarstar(ComponentId_t cid, Params& params, int num_ports,
     
     assert(total_routers == polar.size());
 
+    /* Keep all the minimal next hops before the graph is freed */
+    if (params.find<bool>("precompute_routes", false))
+        buildMinimalRoutes(polar, router_id, min_routes);
+
     /* Initialize the routing table*/
     initRouteTable();
 
@@ -225,7 +229,7 @@ void topo_polarstar::routeUgal(int port, int vc, internal_router_event* ev){
     else if (port < hosts_per_router)
     {
         //minpath details
-        int min_channel = route_table[dest_node] + hosts_per_router;
+        int min_channel = getMinimalChannel(dest_node, out_vc);
         int min_queue   = output_queue_lengths[min_channel*num_vcs + out_vc];
 
         //find valiant intermediate node
@@ -266,13 +270,13 @@ void topo_polarstar::routeUgal(int port, int vc, internal_router_event* ev){
     }
     else if ((tt_ev->valiant == router_id && tt_ev->non_minimal) || (!tt_ev->non_minimal))
     {
-        out_channel         = route_table[dest_node] + hosts_per_router;
+        out_channel         = getMinimalChannel(dest_node, out_vc);
         tt_ev->non_minimal  = false;
         assert(tt_ev->hop_count < 6);
     }
     else
     {
-        out_channel         = route_table[tt_ev->valiant] + hosts_per_router;
+        out_channel         = getMinimalChannel(tt_ev->valiant, out_vc);
         assert(tt_ev->hop_count < 3);
     }
 
@@ -583,6 +587,29 @@ int topo_polarstar::getRouterID(int endpoint) {
 }
 
 
+//Output port of the minimal route to a router. With precompute_routes, the least loaded of all the minimal next hops
+int topo_polarstar::getMinimalChannel(int dest_node, int vc){
+
+    if (min_routes.empty())
+        return route_table[dest_node] + hosts_per_router;
+
+    int min_channel = -1;
+    int min_queue   = std::numeric_limits<int>::max();
+    for (const int* link = min_routes.begin(dest_node); link != min_routes.end(dest_node); ++link)
+    {
+        int channel = *link + hosts_per_router;
+        int queue   = output_queue_lengths[channel*num_vcs + vc];
+        if (queue < min_queue)
+        {
+            min_queue   = queue;
+            min_channel = channel;
+        }
+    }
+    return min_channel;
+
+}
+
+
 int topo_polarstar::getDestLocalPort(int node){
 
     return (int) node % hosts_per_router ; 
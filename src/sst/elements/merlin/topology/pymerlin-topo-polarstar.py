@@ -351,7 +351,7 @@ class topoPolarStar(Topology):
         self._declareClassVariables(["link_latency", "host_link_latency", "global_link_map", "bundleEndpoints"])
         self._declareParams("main",["topo","phi","d","sn_type","pfq","snq","pfV", "snV", "phi", "hosts_per_router","network_radix","total_radix","total_routers",
                                     "total_endnodes","edge","name","algorithm","adaptive_threshold","global_routes","config_failed_links",
-                                    "failed_links"])
+                                    "failed_links", "precompute_routes"])
         self.global_routes      = "absolute"
         self._subscribeToPlatformParamSet("topology")
 
@@ -0,0 +1,143 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_ROUTETABLE_H
+#define COMPONENTS_MERLIN_TOPOLOGY_ROUTETABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+// Forwarding table used by topologies that precompute their routes
+// (precompute_routes = true).  It is filled once, before any packets
+// are routed, and holds an entry for each destination (router, group
+// or endpoint, depending on the topology).  Each entry is the list of
+// candidate next hops on a minimal route to that destination plus a
+// small integer class whose meaning is up to the topology.
+//
+// Candidates are stored back to back in a single array, so looking up
+// an entry is two loads and the candidates of an entry share cache
+// lines.
+template <typename T>
+class RouteTable {
+    std::vector<uint32_t> start;
+    std::vector<int> classes;
+    std::vector<T> candidates;
+
+public:
+    RouteTable() : start(1, 0) {}
+
+    // Adds a candidate to the entry currently being built
+    void add(const T& candidate) { candidates.push_back(candidate); }
+
+    // Finishes the entry currently being built.  Entries are numbered
+    // in the order they are finished.
+    void next(int cls = 0) {
+        start.push_back(candidates.size());
+        classes.push_back(cls);
+    }
+
+    // Releases any extra capacity once the table is filled
+    void finalize() {
+        start.shrink_to_fit();
+        classes.shrink_to_fit();
+        candidates.shrink_to_fit();
+    }
+
+    bool empty() const { return classes.empty(); }
+    int entries() const { return classes.size(); }
+
+    int size(int entry) const { return start[entry+1] - start[entry]; }
+    int getClass(int entry) const { return classes[entry]; }
+    const T& get(int entry, int index) const { return candidates[start[entry] + index]; }
+    const T* begin(int entry) const { return candidates.data() + start[entry]; }
+    const T* end(int entry) const { return candidates.data() + start[entry+1]; }
+
+    size_t bytes() const {
+        return start.capacity() * sizeof(uint32_t) + classes.capacity() * sizeof(int) +
+            candidates.capacity() * sizeof(T);
+    }
+};
+
+// Fills table with an entry for every vertex of graph (an adjacency
+// list) as seen from root.  The candidates for a vertex are the
+// indices, into graph[root], of every neighbor of root that lies on a
+// shortest path to it, in increasing order, and the class is the
+// length of that path.  The entry for root itself is empty with class
+// 0.
+inline void
+buildMinimalRoutes(const std::vector<std::vector<int> >& graph, int root, RouteTable<int>& table)
+{
+    int nodes = graph.size();
+    int links = graph[root].size();
+    int words = (links + 63) / 64;
+
+    // Breadth first search from root, collecting for each vertex the
+    // set of first hops (as a bit mask) that reach it on a shortest
+    // path.
+    std::vector<int> dist(nodes, -1);
+    std::vector<uint64_t> first_hops((size_t)nodes * words, 0);
+    std::vector<int> frontier;
+    std::vector<int> nxt;
+
+    dist[root] = 0;
+    for ( int i = 0; i < links; i++ ) {
+        int v = graph[root][i];
+        if ( dist[v] == -1 ) {
+            dist[v] = 1;
+            frontier.push_back(v);
+        }
+        first_hops[(size_t)v * words + i / 64] |= (uint64_t)1 << (i % 64);
+    }
+
+    while ( !frontier.empty() ) {
+        for ( int v : frontier ) {
+            for ( int u : graph[v] ) {
+                if ( dist[u] == -1 ) {
+                    dist[u] = dist[v] + 1;
+                    nxt.push_back(u);
+                }
+                if ( dist[u] == dist[v] + 1 ) {
+                    for ( int w = 0; w < words; w++ ) {
+                        first_hops[(size_t)u * words + w] |= first_hops[(size_t)v * words + w];
+                    }
+                }
+            }
+        }
+        frontier.swap(nxt);
+        nxt.clear();
+    }
+
+    for ( int v = 0; v < nodes; v++ ) {
+        if ( v != root ) {
+            for ( int i = 0; i < links; i++ ) {
+                if ( first_hops[(size_t)v * words + i / 64] & ((uint64_t)1 << (i % 64)) ) table.add(i);
+            }
+        }
+        table.next(dist[v] < 0 ? 0 : dist[v]);
+    }
+    table.finalize();
+}
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_ROUTETABLE_H
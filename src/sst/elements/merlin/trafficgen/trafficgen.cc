@@ -78,6 +78,7 @@ TrafficGen::TrafficGen(ComponentId_t cid, Params& params) :
         if_params.insert("link_bw",params.find<std::string>("link_bw"));
         if_params.insert("input_buf_size",params.find<std::string>("buffer_length","1kB"));
         if_params.insert("output_buf_size",params.find<std::string>("buffer_length","1kB"));
+        if_params.insert("bundle_packets",params.find<std::string>("bundle_packets","1"));
         if_params.insert("port_name","rtr");
 
         link_control = loadAnonymousSubComponent<SST::Interfaces::SimpleNetwork>
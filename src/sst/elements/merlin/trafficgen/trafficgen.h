@@ -60,6 +60,7 @@ public:
         {"link_bw",                               "Bandwidth of the router link specified in either b/s or B/s (can include SI prefix)."},
         {"topology",                              "Name of the topology subcomponent that should be loaded to control routing."},
         {"buffer_length",                         "Length of input and output buffers.","1kB"},
+        {"bundle_packets",                        "Maximum number of packets the default LinkControl sends to the router in one event.  See merlin.linkcontrol.","1"},
         {"packets_to_send",                       "Number of packets to send in the test.","1000"},
         {"packet_size",                           "Packet size specified in either b or B (can include SI prefix).","5"},
         {"delay_between_packets",                 "","0"},
@@ -70,7 +70,7 @@ void OpalMemNIC::send(MemHierarchy::MemEventBase * ev) {
     SST::Interfaces::SimpleNetwork::Request * req = new SST::Interfaces::SimpleNetwork::Request();
     MemRtrEvent * mre = new MemRtrEvent(ev);
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev->getDstID());
     req->size_in_bits = 8 * (packetHeaderBytes + ev->getPayloadSize());
     req->vn = 0;
     req->givePayload(mre);
@@ -107,15 +107,18 @@ void OpalMemNIC::processInitMemRtrEvent(MemHierarchy::MemNICBase::InitMemRtrEven
 
 
 std::string OpalMemNIC::findTargetDestination(MemHierarchy::Addr addr) {
-    for (std::set<MemHierarchy::MemLinkBase::EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-        if (it->region.contains(addr)) return it->name;
-    }
+    return MemHierarchy::EndpointRegistry::getName(findTargetDestinationID(addr));
+}
+
+
+MemHierarchy::EndpointID OpalMemNIC::findTargetDestinationID(MemHierarchy::Addr addr) {
+    MemHierarchy::EndpointID dst = destIndex.findID(addr);
+    if (dst != MemHierarchy::EndpointRegistry::NO_ENDPOINT) return dst;
 
     if (enable && localMemSize) {
         MemHierarchy::Addr tempAddr = addr & (localMemSize-1);
-        for (std::set<MemHierarchy::MemLinkBase::EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-            if(it->region.contains(tempAddr)) return it->name;
-        }
+        dst = destIndex.findID(tempAddr);
+        if (dst != MemHierarchy::EndpointRegistry::NO_ENDPOINT) return dst;
     }
 
     /* Build error string */
@@ -126,5 +129,5 @@ std::string OpalMemNIC::findTargetDestination(MemHierarchy::Addr addr) {
         error << it->name << " " << it->region.toString() << endl;
     }
     dbg.fatal(CALL_INFO, -1, "%s", error.str().c_str());
-    return "";
+    return MemHierarchy::EndpointRegistry::NO_ENDPOINT;
 }
@@ -93,6 +93,7 @@ public:
     void setup() { link_control->setup(); MemLinkBase::setup(); }
 
     virtual std::string findTargetDestination(MemHierarchy::Addr addr);
+    virtual MemHierarchy::EndpointID findTargetDestinationID(MemHierarchy::Addr addr);
 
 protected:
     virtual MemHierarchy::MemNICBase::InitMemRtrEvent* createInitMemRtrEvent();
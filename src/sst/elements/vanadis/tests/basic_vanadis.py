@@ -200,7 +200,6 @@ memCtrlParams = {
       "clock" : cpu_clock,
       "backend.mem_size" : physMemSize,
       "backing" : "malloc",
-      "initBacking": 1,
       "addr_range_start": 0,
       "addr_range_end": 0xffffffff,
       "debug_level" : mh_debug_level,
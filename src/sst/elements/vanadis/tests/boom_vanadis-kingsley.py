@@ -585,7 +585,6 @@ class MemBuilder:
             "clock" : mem_clock,
             "backend.mem_size" : physMemSize,
             "backing" : "malloc",
-            "initBacking": 1,
             "debug_level" : mh_debug_level,
             "debug" : mh_debug,
             "interleave_size" : "64B",    # Interleave at line granularity between memories
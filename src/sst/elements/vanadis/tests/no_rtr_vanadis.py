@@ -282,7 +282,6 @@ memctrl.addParams({
       "clock" : cpu_clock,
       "backend.mem_size" : "4GiB",
       "backing" : "malloc",
-      "initBacking": 1,
       "addr_range_start": 0, 
       "addr_range_end": 0xffffffff, 
       "debug" : mh_dbg,